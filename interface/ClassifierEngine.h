@@ -0,0 +1,180 @@
+#ifndef ClassifierEngine_HH
+#define ClassifierEngine_HH
+
+/*
+The algorithms of the track classifier as engines, chosen once when the producer is constructed
+from a factory keyed by the Algorithm parameter, so the event loop never compares algorithm names.
+An engine scores all the tracks of an event into one MVA field, from the tracks themselves (Cut,
+None), from their track word fields (the fixed point emulations) or from the rows of transformed
+features (the ONNX runtime and native models). The engines are called once per event and run a
+loop over the tracks specialised for their model, they are const and shared by every stream.
+A new engine is added by writing its class here and registering it under its Algorithm name in
+src/ClassifierEngine.cc
+*/
+
+#include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModel.h"
+#include "L1Trigger/TrackQuality/interface/TrackCuts.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace edm {
+  class ParameterSet;
+}
+class ONNXModelCache;
+
+class ClassifierEngine {
+public:
+  typedef TTTrack<Ref_Phase2TrackerDigi_> Track;
+  typedef std::vector<std::unique_ptr<const ClassifierEngine>> Engines;
+
+  // What the engine scores the tracks from
+  enum class Input { Tracks, TrackWords, Features };
+
+  ClassifierEngine(const std::string& name, Input input, unsigned int mva_field)
+      : name_(name), input_(input), mva_field_(mva_field) {}
+  virtual ~ClassifierEngine() = default;
+
+  const std::string& name() const { return name_; }
+  Input input() const { return input_; }
+  // Field (1 to 3) of the track MVA the scores are written to
+  unsigned int mvaField() const { return mva_field_; }
+
+  // Input Tracks, one score per track
+  virtual void scoreTracks(const Track* /*tracks*/, size_t /*n_tracks*/, float* /*scores*/) const {
+    unsupported("tracks");
+  }
+  // Input TrackWords, one score per track from its digitised track word fields
+  virtual void scoreTrackWords(const TrackWordBits* /*bits*/, size_t /*n_tracks*/, float* /*scores*/) const {
+    unsupported("track words");
+  }
+  // Input Features, the positive class probability of n_tracks rows of features in input order.
+  // features may be lent to ONNX runtime, it is given back unchanged
+  virtual void predict(std::vector<float>& /*features*/,
+                       unsigned int /*n_tracks*/,
+                       std::vector<float>& /*scores*/) const {
+    unsupported("features");
+  }
+  // predict takes features away while it runs, engines run at the same time need their own copy
+  virtual bool lendsFeatures() const { return false; }
+
+  // The engines of an Algorithm in the order they are run, None has one per MVA field and All
+  // those of allEngines, the i-th writing MVA i+1. Throws for an Algorithm that is not registered
+  static Engines make(const std::string& algorithm, const ONNXModelCache& models, const edm::ParameterSet& iConfig);
+  // The registered Algorithm names
+  static std::vector<std::string> algorithms();
+  // Names of the engines of the configured Algorithm, allEngines for All and the Algorithm itself
+  // otherwise. Throws unless allEngines holds one to three different engines run on the tracks
+  // or on the features
+  static std::vector<std::string> engineNames(const edm::ParameterSet& iConfig);
+
+private:
+  void unsupported(const char* input) const {
+    throw cms::Exception("LogicError") << "engine " << name_ << " does not score " << input;
+  }
+
+  std::string name_;
+  Input input_;
+  unsigned int mva_field_;
+};
+
+// 1 if the track passes the cuts, 0 otherwise
+class CutEngine final : public ClassifierEngine {
+public:
+  CutEngine(const TrackCuts& cuts, unsigned int mva_field = 1)
+      : ClassifierEngine("Cut", Input::Tracks, mva_field), cuts_(cuts) {}
+
+  void scoreTracks(const Track* tracks, size_t n_tracks, float* scores) const override {
+    for (size_t i = 0; i < n_tracks; ++i)
+      scores[i] = cuts_.pass(tracks[i]) ? 1.0 : 0.0;
+  }
+
+private:
+  TrackCuts cuts_;
+};
+
+// The same value for every track, -999 for the fields of None
+class ConstantEngine final : public ClassifierEngine {
+public:
+  ConstantEngine(float value, unsigned int mva_field)
+      : ClassifierEngine("None", Input::Tracks, mva_field), value_(value) {}
+
+  void scoreTracks(const Track* /*tracks*/, size_t n_tracks, float* scores) const override {
+    std::fill(scores, scores + n_tracks, value_);
+  }
+
+private:
+  float value_;
+};
+
+// Integer emulation of the firmware, the rows of fixed point features of the event computed from
+// the digitised track words and scored together
+class FixedPointEngine final : public ClassifierEngine {
+public:
+  FixedPointEngine(const std::string& name,
+                   const TrackWordFeatures& features,
+                   const FixedPointModel& model,
+                   unsigned int mva_field = 1)
+      : ClassifierEngine(name, Input::TrackWords, mva_field), features_(features), model_(model) {}
+
+  void scoreTrackWords(const TrackWordBits* bits, size_t n_tracks, float* scores) const override {
+    // Kept by each thread, grown to the largest event it has seen
+    thread_local std::vector<int64_t> rows;
+    unsigned int n_features = features_.nFeatures();
+    rows.resize(std::max(rows.size(), n_tracks * n_features));
+    for (size_t i = 0; i < n_tracks; ++i)
+      features_.fixedPoint(bits[i], &rows[i * n_features]);
+    model_.predict(rows.data(), n_tracks, scores);
+  }
+
+private:
+  const TrackWordFeatures& features_;
+  const FixedPointModel& model_;
+};
+
+// A native model with predict(const float* features, n_tracks, float* scores), TreeEnsemble,
+// QuickScorer, DenseNetwork or CompiledTreeEnsemble, called directly rather than through a
+// virtual function so the track loop of the model is specialised for it
+template <typename Model>
+class NativeEngine final : public ClassifierEngine {
+public:
+  NativeEngine(const std::string& name, const Model& model, unsigned int mva_field = 1)
+      : ClassifierEngine(name, Input::Features, mva_field), model_(model) {}
+
+  void predict(std::vector<float>& features, unsigned int n_tracks, std::vector<float>& scores) const override {
+    scores.resize(n_tracks);
+    model_.predict(features.data(), n_tracks, scores.data());
+  }
+
+private:
+  const Model& model_;
+};
+
+// A model run by ONNX runtime, NN or GBDT
+class ONNXEngine final : public ClassifierEngine {
+public:
+  ONNXEngine(const std::string& name, const ONNXModel& model, unsigned int mva_field = 1)
+      : ClassifierEngine(name, Input::Features, mva_field), model_(model) {}
+
+  void predict(std::vector<float>& features, unsigned int n_tracks, std::vector<float>& scores) const override {
+    // FloatArray type defined in https://github.com/cms-sw/cmssw/blob/master/PhysicsTools/ONNXRuntime/interface/ONNXRuntime.h
+    // as: std::vector<std::vector<float>> FloatArrays;
+    // the features are lent to the ONNX input rather than copied
+    cms::Ort::FloatArrays ortinput(1);
+    ortinput[0].swap(features);
+    scores = model_.predict(ortinput, n_tracks);
+    features.swap(ortinput[0]);
+  }
+  bool lendsFeatures() const override { return true; }
+
+private:
+  const ONNXModel& model_;
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef ClassifierStats_HH
+#define ClassifierStats_HH
+
+/*
+Per stage timing and counters of the track classifier: each stream fills its own ClassifierStats
+without locking, the streams are merged at the end of the job and printed as a table or written
+as JSON. Durations and track counts go into log-linear histograms with 8 buckets per power of
+two, so the quantiles are within 6% of the exact ones
+The engines of the algorithm are timed as well, one histogram each in the order they are run
+Collection is switched on by the timingStats parameter, when off the stages cost a null pointer
+test. Defining L1TRACKCLASSIFIER_NO_STATS at compile time removes even that
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class ClassifierStats {
+public:
+  enum Stage { Fetch, Copy, Preselection, Pack, Transform, Inference, Put, n_stages };
+  static const char* const stage_names[n_stages];
+
+  class Histogram {
+  public:
+    static constexpr unsigned int n_buckets = 8 * 62;
+
+    void add(uint64_t value);
+    void merge(const Histogram& other);
+
+    uint64_t count() const { return count_; }
+    double mean() const { return count_ ? double(sum_) / count_ : 0; }
+    uint64_t max() const { return max_; }
+    uint64_t sum() const { return sum_; }
+    // Middle of the bucket holding the q-th quantile, 0 when empty
+    double quantile(double q) const;
+
+    static unsigned int bucket(uint64_t value);
+    static uint64_t lowerEdge(unsigned int bucket);
+    static uint64_t width(unsigned int bucket);
+    uint64_t bucketCount(unsigned int bucket) const { return counts_[bucket]; }
+
+  private:
+    std::array<uint64_t, n_buckets> counts_{};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t max_ = 0;
+  };
+
+  void add(Stage stage, uint64_t ns) { stages_[stage].add(ns); }
+  void addEvent(uint64_t n_tracks) { tracks_.add(n_tracks); }
+  // Tracks of the event classified by the model, fewer than the tracks with the preselection
+  void addInferred(uint64_t n_tracks) { inferred_.add(n_tracks); }
+  // Names the engines timed by addEngine, the same in every stream
+  void setEngines(const std::vector<std::string>& names);
+  void addEngine(unsigned int engine, uint64_t ns) { engines_[engine].add(ns); }
+  void merge(const ClassifierStats& other);
+
+  const Histogram& stage(Stage stage) const { return stages_[stage]; }
+  unsigned int nEngines() const { return engines_.size(); }
+  const std::string& engineName(unsigned int engine) const { return engine_names_[engine]; }
+  const Histogram& engine(unsigned int engine) const { return engines_[engine]; }
+  const Histogram& tracks() const { return tracks_; }
+  const Histogram& inferred() const { return inferred_; }
+
+  // One line per stage with the events, mean, median, 99th percentile and maximum in us and the
+  // share of the summed time, then one line per engine, part of the preselection and inference stages
+  // (run side by side with parallelEngines), the tracks per event and those classified by the model
+  void print(std::ostream& os) const;
+  // The same numbers, with the non empty buckets of each histogram, throws cms::Exception if the
+  // file cannot be written
+  void writeJson(const std::string& path) const;
+
+private:
+  friend class StageTimer;
+
+  std::array<Histogram, n_stages> stages_;
+  std::vector<std::string> engine_names_;
+  std::vector<Histogram> engines_;
+  Histogram tracks_;
+  Histogram inferred_;
+};
+
+// Adds the time from its construction to stop() or its destruction to a stage or an engine,
+// nothing when stats is null
+class StageTimer {
+public:
+#ifdef L1TRACKCLASSIFIER_NO_STATS
+  StageTimer(ClassifierStats*, ClassifierStats::Stage) {}
+  StageTimer(ClassifierStats*, unsigned int) {}
+  void stop() {}
+#else
+  StageTimer(ClassifierStats* stats, ClassifierStats::Stage stage)
+      : histogram_(stats ? &stats->stages_[stage] : nullptr) {
+    if (histogram_)
+      start_ = std::chrono::steady_clock::now();
+  }
+  StageTimer(ClassifierStats* stats, unsigned int engine) : histogram_(stats ? &stats->engines_[engine] : nullptr) {
+    if (histogram_)
+      start_ = std::chrono::steady_clock::now();
+  }
+  ~StageTimer() { stop(); }
+  StageTimer(const StageTimer&) = delete;
+  StageTimer& operator=(const StageTimer&) = delete;
+
+  void stop() {
+    if (histogram_)
+      histogram_->add(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+    histogram_ = nullptr;
+  }
+
+private:
+  ClassifierStats::Histogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+#endif
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef CompiledTreeEnsemble_HH
+#define CompiledTreeEnsemble_HH
+
+/*
+Evaluator of a GBDT compiled into the binary, specialised on a model header generated from the
+ONNX file by util/gbdttocpp.py (see FakeIDGBDTModel.h)
+The node index is a template parameter, so every tree is unrolled by the compiler into a cascade
+of comparisons against constant thresholds and nothing is loaded at run time. Results are the
+same as TreeEnsemble, with the trees summed in the same order
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// Node of a generated model, leaves have leaf set and value filled
+struct CompiledTreeNode {
+  float threshold;
+  uint16_t feature;
+  bool nan_to_lt;  // missing (NaN) values follow the less-than child
+  bool leaf;
+  uint32_t below;  // child for feature < threshold
+  uint32_t above;  // child for feature >= threshold
+  float value;
+};
+
+// Model provides n_features, n_trees, base_value, logistic, roots[n_trees] and nodes[]
+template <typename Model>
+class CompiledTreeEnsemble {
+public:
+  static constexpr unsigned int nFeatures() { return Model::n_features; }
+  static constexpr unsigned int nTrees() { return Model::n_trees; }
+
+  // Same interface and results as TreeEnsemble::predict
+  static void predict(const float* features, unsigned int n_tracks, float* scores) {
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+      float sum = sumTrees(features + size_t(i) * Model::n_features, std::make_index_sequence<Model::n_trees>());
+      scores[i] = Model::logistic ? 1.f / (1.f + std::exp(-sum)) : sum;
+    }
+  }
+
+private:
+  template <uint32_t Index>
+  static float walk(const float* row) {
+    constexpr CompiledTreeNode node = Model::nodes[Index];
+    if constexpr (node.leaf) {
+      return node.value;
+    } else {
+      float x = row[node.feature];
+      if (x < node.threshold || (node.nan_to_lt && std::isnan(x)))
+        return walk<node.below>(row);
+      return walk<node.above>(row);
+    }
+  }
+
+  template <size_t... Trees>
+  static float sumTrees(const float* row, std::index_sequence<Trees...>) {
+    float sum = Model::base_value;
+    ((sum += walk<Model::roots[Trees]>(row)), ...);
+    return sum;
+  }
+};
+
+#endif
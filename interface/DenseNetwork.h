@@ -0,0 +1,61 @@
+#ifndef DenseNetwork_HH
+#define DenseNetwork_HH
+
+/*
+Native evaluator of a feed forward network stored in an ONNX file (the Keras fake ID NN)
+The chain of MatMul/Gemm, Add and BatchNormalization nodes between two activations is folded
+into one dense layer, whose weights are packed in panels of four outputs. A batch of tracks is
+evaluated a SIMD vector of tracks at a time (16 with AVX-512, 8 with AVX2, 4 otherwise), each
+layer computing four outputs per pass over its inputs with bias and activation fused
+*/
+
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include <string>
+#include <vector>
+
+class DenseNetwork {
+public:
+  // Loads the graph from input_name to output_name, throws cms::Exception on operators other than
+  // MatMul, Gemm, Add, BatchNormalization, Identity, Relu, LeakyRelu, Sigmoid and Tanh
+  DenseNetwork(const std::string& onnx_path, const std::string& input_name, const std::string& output_name);
+
+  // Scores n_tracks rows of a contiguous n_tracks x nFeatures() buffer, writing the last output
+  // of the network for each row, as ONNXModel::predict
+  void predict(const float* features, unsigned int n_tracks, float* scores) const;
+
+  // Folds the offset and scale of each feature into the first layer weights and biases, so the
+  // network takes unscaled features. Clipping cannot be folded and stays with the transform, see
+  // FeatureScaling::clipping
+  void foldScaling(const FeatureScaling& scaling);
+
+  unsigned int nFeatures() const { return n_features_; }
+  unsigned int nLayers() const { return layers_.size(); }
+  // Width of the SIMD vectors used on this machine, in tracks
+  unsigned int lanes() const { return lanes_; }
+
+  enum class Activation { None, Relu, LeakyRelu, Sigmoid, Tanh };
+
+  struct Layer {
+    unsigned int n_in;
+    unsigned int n_out;
+    std::vector<float> weights;  // [n_out / 4 panels][n_in][4], zero padded
+    std::vector<float> bias;     // n_out rounded up to a multiple of 4, zero padded
+    Activation activation;
+    float alpha;  // LeakyRelu slope
+  };
+  const std::vector<Layer>& layers() const { return layers_; }
+
+private:
+  template <typename V>
+  void predictLanes(const float* features, unsigned int n_tracks, float* scores) const;
+  void predictDefault(const float* features, unsigned int n_tracks, float* scores) const;
+  void predictAVX2(const float* features, unsigned int n_tracks, float* scores) const;
+  void predictAVX512(const float* features, unsigned int n_tracks, float* scores) const;
+
+  std::vector<Layer> layers_;
+  unsigned int n_features_;
+  unsigned int max_width_;  // widest layer, padded
+  unsigned int lanes_;
+};
+
+#endif
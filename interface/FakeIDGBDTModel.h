@@ -0,0 +1,1516 @@
+#ifndef FakeIDGBDTModel_HH
+#define FakeIDGBDTModel_HH
+
+/*
+Generated by util/gbdttocpp.py from GBDT_model.onnx, do not edit
+100 trees, 1484 nodes, 21 features
+*/
+
+#include "L1Trigger/TrackQuality/interface/CompiledTreeEnsemble.h"
+
+struct FakeIDGBDTModel {
+  static constexpr unsigned int n_features = 21;
+  static constexpr unsigned int n_trees = 100;
+  static constexpr float base_value = 0.0f;
+  static constexpr bool logistic = true;
+
+  static constexpr uint32_t roots[n_trees] = {
+      0, 15, 30, 45, 60, 75, 90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+      240, 255, 270, 285, 300, 315, 330, 345, 360, 375, 390, 405, 420, 435, 450, 465,
+      480, 495, 510, 525, 540, 555, 570, 585, 600, 615, 630, 645, 660, 675, 688, 703,
+      718, 733, 748, 763, 778, 793, 808, 823, 838, 853, 868, 883, 898, 913, 926, 941,
+      956, 971, 986, 1001, 1016, 1031, 1046, 1061, 1076, 1091, 1106, 1121, 1136, 1151, 1164, 1179,
+      1194, 1209, 1224, 1239, 1254, 1269, 1280, 1295, 1310, 1325, 1340, 1351, 1366, 1381, 1396, 1411,
+      1424, 1439, 1454, 1469,
+  };
+
+  // threshold, feature, nan_to_lt, leaf, below, above, value
+  static constexpr CompiledTreeNode nodes[1484] = {
+      {0x1.2p+2f, 4, true, false, 1, 2, 0.0f},
+      {0x1.9afaep+0f, 3, true, false, 3, 4, 0.0f},
+      {0x1.b0bb7p+1f, 0, true, false, 5, 6, 0.0f},
+      {0x1.328842p+1f, 0, true, false, 7, 8, 0.0f},
+      {0x1.62f5ecp+1f, 3, true, false, 9, 10, 0.0f},
+      {0x1.511a18p+1f, 0, true, false, 11, 12, 0.0f},
+      {0x1.037c8p+1f, 2, true, false, 13, 14, 0.0f},
+      {0.0f, 0, false, true, 7, 7, 0x1.dc4f84p-4f},
+      {0.0f, 0, false, true, 8, 8, -0x1.49f53ap-4f},
+      {0.0f, 0, false, true, 9, 9, -0x1.3f51fp-3f},
+      {0.0f, 0, false, true, 10, 10, -0x1.aa518p-3f},
+      {0.0f, 0, false, true, 11, 11, 0x1.a0fa0ap-3f},
+      {0.0f, 0, false, true, 12, 12, 0x1.186d1ap-3f},
+      {0.0f, 0, false, true, 13, 13, 0x1.fbaa6ap-6f},
+      {0.0f, 0, false, true, 14, 14, -0x1.42c2d8p-3f},
+      {0x1.2p+2f, 4, true, false, 16, 17, 0.0f},
+      {0x1.7c2638p+0f, 3, true, false, 18, 19, 0.0f},
+      {0x1.bc8404p+1f, 0, true, false, 20, 21, 0.0f},
+      {0x1.75bc7p+0f, 2, true, false, 22, 23, 0.0f},
+      {0x1.29a41ep+1f, 3, true, false, 24, 25, 0.0f},
+      {0x1.61a8d8p+1f, 0, true, false, 26, 27, 0.0f},
+      {0x1.004262p+1f, 2, true, false, 28, 29, 0.0f},
+      {0.0f, 0, false, true, 22, 22, 0x1.c99b1cp-6f},
+      {0.0f, 0, false, true, 23, 23, -0x1.1597bcp-3f},
+      {0.0f, 0, false, true, 24, 24, -0x1.fc85e8p-4f},
+      {0.0f, 0, false, true, 25, 25, -0x1.78d782p-3f},
+      {0.0f, 0, false, true, 26, 26, 0x1.715b52p-3f},
+      {0.0f, 0, false, true, 27, 27, 0x1.b6b014p-4f},
+      {0.0f, 0, false, true, 28, 28, 0x1.8f7f3ep-6f},
+      {0.0f, 0, false, true, 29, 29, -0x1.1b34d2p-3f},
+      {0x1.2p+2f, 4, true, false, 31, 32, 0.0f},
+      {0x1.83511cp+0f, 3, true, false, 33, 34, 0.0f},
+      {0x1.ca932cp+1f, 0, true, false, 35, 36, 0.0f},
+      {0x1.6533a8p+0f, 2, true, false, 37, 38, 0.0f},
+      {0x1.6e93c4p+1f, 3, true, false, 39, 40, 0.0f},
+      {0x1.291144p+1f, 2, true, false, 41, 42, 0.0f},
+      {0x1.e692a4p+0f, 2, true, false, 43, 44, 0.0f},
+      {0.0f, 0, false, true, 37, 37, 0x1.f587e4p-6f},
+      {0.0f, 0, false, true, 38, 38, -0x1.e7e1ccp-4f},
+      {0.0f, 0, false, true, 39, 39, -0x1.fa3bfp-4f},
+      {0.0f, 0, false, true, 40, 40, -0x1.614728p-3f},
+      {0.0f, 0, false, true, 41, 41, 0x1.42183cp-3f},
+      {0.0f, 0, false, true, 42, 42, -0x1.64175ep-4f},
+      {0.0f, 0, false, true, 43, 43, 0x1.689ae8p-6f},
+      {0.0f, 0, false, true, 44, 44, -0x1.e8b05p-4f},
+      {0x1.2p+2f, 4, true, false, 46, 47, 0.0f},
+      {0x1.c2ac98p+0f, 3, true, false, 48, 49, 0.0f},
+      {0x1.a34d1p+1f, 0, true, false, 50, 51, 0.0f},
+      {0x1.39eef8p+1f, 0, true, false, 52, 53, 0.0f},
+      {0x1.4p+1f, 19, true, false, 54, 55, 0.0f},
+      {0x1.3cf97cp+1f, 0, true, false, 56, 57, 0.0f},
+      {0x1.10d5c4p+1f, 2, true, false, 58, 59, 0.0f},
+      {0.0f, 0, false, true, 52, 52, 0x1.7c2ba8p-4f},
+      {0.0f, 0, false, true, 53, 53, -0x1.13623p-4f},
+      {0.0f, 0, false, true, 54, 54, -0x1.432fa4p-3f},
+      {0.0f, 0, false, true, 55, 55, -0x1.8c1e3ep-4f},
+      {0.0f, 0, false, true, 56, 56, 0x1.43fcf2p-3f},
+      {0.0f, 0, false, true, 57, 57, 0x1.c35a86p-4f},
+      {0.0f, 0, false, true, 58, 58, 0x1.5a506cp-6f},
+      {0.0f, 0, false, true, 59, 59, -0x1.f9fd7ep-4f},
+      {0x1.2p+2f, 4, true, false, 61, 62, 0.0f},
+      {0x1.c83ae2p+0f, 3, true, false, 63, 64, 0.0f},
+      {0x1.9db99cp+1f, 0, true, false, 65, 66, 0.0f},
+      {0x1.81c99p+1f, 0, true, false, 67, 68, 0.0f},
+      {0x1.4p+1f, 19, true, false, 69, 70, 0.0f},
+      {0x1.44793p+1f, 0, true, false, 71, 72, 0.0f},
+      {0x1.02639p+1f, 2, true, false, 73, 74, 0.0f},
+      {0.0f, 0, false, true, 67, 67, 0x1.047264p-4f},
+      {0.0f, 0, false, true, 68, 68, -0x1.2ce294p-4f},
+      {0.0f, 0, false, true, 69, 69, -0x1.2df1fcp-3f},
+      {0.0f, 0, false, true, 70, 70, -0x1.7389cap-4f},
+      {0.0f, 0, false, true, 71, 71, 0x1.2d6668p-3f},
+      {0.0f, 0, false, true, 72, 72, 0x1.8d63b8p-4f},
+      {0.0f, 0, false, true, 73, 73, 0x1.a471e6p-6f},
+      {0.0f, 0, false, true, 74, 74, -0x1.b3ca7ap-4f},
+      {0x1.2p+2f, 4, true, false, 76, 77, 0.0f},
+      {0x1.f496c8p+0f, 3, true, false, 78, 79, 0.0f},
+      {0x1.dea61ep+1f, 0, true, false, 80, 81, 0.0f},
+      {0x1.45133p+0f, 2, true, false, 82, 83, 0.0f},
+      {0x1.c2a588p+1f, 3, true, false, 84, 85, 0.0f},
+      {0x1.51695p+1f, 0, true, false, 86, 87, 0.0f},
+      {0x1.e9db64p+0f, 3, true, false, 88, 89, 0.0f},
+      {0.0f, 0, false, true, 82, 82, 0x1.85a108p-6f},
+      {0.0f, 0, false, true, 83, 83, -0x1.996366p-4f},
+      {0.0f, 0, false, true, 84, 84, -0x1.c6e75ep-4f},
+      {0.0f, 0, false, true, 85, 85, -0x1.2d73ep-3f},
+      {0.0f, 0, false, true, 86, 86, 0x1.186f02p-3f},
+      {0.0f, 0, false, true, 87, 87, 0x1.2f23aap-4f},
+      {0.0f, 0, false, true, 88, 88, 0x1.50c1d8p-7f},
+      {0.0f, 0, false, true, 89, 89, -0x1.c0126p-4f},
+      {0x1.2p+2f, 4, true, false, 91, 92, 0.0f},
+      {0x1.0af564p+1f, 3, true, false, 93, 94, 0.0f},
+      {0x1.8bac1cp+1f, 0, true, false, 95, 96, 0.0f},
+      {0x1.5ed9f2p+0f, 16, true, false, 97, 98, 0.0f},
+      {0x1.4p+1f, 19, true, false, 99, 100, 0.0f},
+      {0x1.309f5cp+1f, 0, true, false, 101, 102, 0.0f},
+      {0x1.d01978p+0f, 2, true, false, 103, 104, 0.0f},
+      {0.0f, 0, false, true, 97, 97, -0x1.a7f04ep-4f},
+      {0.0f, 0, false, true, 98, 98, 0x1.0c0068p-6f},
+      {0.0f, 0, false, true, 99, 99, -0x1.147a78p-3f},
+      {0.0f, 0, false, true, 100, 100, -0x1.68befap-4f},
+      {0.0f, 0, false, true, 101, 101, 0x1.0fe7fap-3f},
+      {0.0f, 0, false, true, 102, 102, 0x1.7e16c2p-4f},
+      {0.0f, 0, false, true, 103, 103, 0x1.f713p-6f},
+      {0.0f, 0, false, true, 104, 104, -0x1.54a5b8p-4f},
+      {0x1.06d7fcp+1f, 3, true, false, 106, 107, 0.0f},
+      {0x1.89edp+1f, 0, true, false, 108, 109, 0.0f},
+      {0x1.6p+2f, 4, true, false, 110, 111, 0.0f},
+      {0x1.2p+2f, 4, true, false, 112, 113, 0.0f},
+      {0x1.e9fdc8p+0f, 2, true, false, 114, 115, 0.0f},
+      {0x1.9d696ap+1f, 3, true, false, 116, 117, 0.0f},
+      {0x1.c5a28p+1f, 0, true, false, 118, 119, 0.0f},
+      {0.0f, 0, false, true, 112, 112, 0x1.9be92cp-5f},
+      {0.0f, 0, false, true, 113, 113, 0x1.ebc144p-4f},
+      {0.0f, 0, false, true, 114, 114, 0x1.be95fep-7f},
+      {0.0f, 0, false, true, 115, 115, -0x1.714812p-4f},
+      {0.0f, 0, false, true, 116, 116, -0x1.630a14p-4f},
+      {0.0f, 0, false, true, 117, 117, -0x1.110588p-3f},
+      {0.0f, 0, false, true, 118, 118, 0x1.b0dfaap-4f},
+      {0.0f, 0, false, true, 119, 119, -0x1.7d5ffap-5f},
+      {0x1.f3d0b8p+0f, 3, true, false, 121, 122, 0.0f},
+      {0x1.95d538p+1f, 0, true, false, 123, 124, 0.0f},
+      {0x1.6p+2f, 4, true, false, 125, 126, 0.0f},
+      {0x1.2p+2f, 4, true, false, 127, 128, 0.0f},
+      {0x1.6p+2f, 4, true, false, 129, 130, 0.0f},
+      {0x1.e93048p+0f, 0, true, false, 131, 132, 0.0f},
+      {0x1.e1e6bcp+1f, 0, true, false, 133, 134, 0.0f},
+      {0.0f, 0, false, true, 127, 127, 0x1.6b1c3ap-5f},
+      {0.0f, 0, false, true, 128, 128, 0x1.cffe6ep-4f},
+      {0.0f, 0, false, true, 129, 129, -0x1.5d3444p-5f},
+      {0.0f, 0, false, true, 130, 130, 0x1.9f3832p-5f},
+      {0.0f, 0, false, true, 131, 131, -0x1.024832p-6f},
+      {0.0f, 0, false, true, 132, 132, -0x1.dcb674p-4f},
+      {0.0f, 0, false, true, 133, 133, 0x1.8a1d3ep-4f},
+      {0.0f, 0, false, true, 134, 134, -0x1.3ded78p-5f},
+      {0x1.1fcea4p+1f, 3, true, false, 136, 137, 0.0f},
+      {0x1.67a416p+1f, 0, true, false, 138, 139, 0.0f},
+      {0x1.6p+2f, 4, true, false, 140, 141, 0.0f},
+      {0x1.2p+2f, 4, true, false, 142, 143, 0.0f},
+      {0x1.0eadfap+1f, 2, true, false, 144, 145, 0.0f},
+      {0x1.af827p+1f, 3, true, false, 146, 147, 0.0f},
+      {0x1.f7f058p+1f, 0, true, false, 148, 149, 0.0f},
+      {0.0f, 0, false, true, 142, 142, 0x1.8b701ep-5f},
+      {0.0f, 0, false, true, 143, 143, 0x1.cadcaep-4f},
+      {0.0f, 0, false, true, 144, 144, 0x1.81b52ap-7f},
+      {0.0f, 0, false, true, 145, 145, -0x1.8e412p-4f},
+      {0.0f, 0, false, true, 146, 146, -0x1.3c418cp-4f},
+      {0.0f, 0, false, true, 147, 147, -0x1.fc5696p-4f},
+      {0.0f, 0, false, true, 148, 148, 0x1.42409p-4f},
+      {0.0f, 0, false, true, 149, 149, -0x1.e200e2p-5f},
+      {0x1.2p+2f, 4, true, false, 151, 152, 0.0f},
+      {0x1.359444p+0f, 2, true, false, 153, 154, 0.0f},
+      {0x1.0acc7p+2f, 0, true, false, 155, 156, 0.0f},
+      {0x1.4p+1f, 19, true, false, 157, 158, 0.0f},
+      {0x1.083308p+0f, 3, true, false, 159, 160, 0.0f},
+      {0x1.1cee84p+1f, 2, true, false, 161, 162, 0.0f},
+      {0x1.8d2cc4p+0f, 3, true, false, 163, 164, 0.0f},
+      {0.0f, 0, false, true, 157, 157, -0x1.a01b9cp-5f},
+      {0.0f, 0, false, true, 158, 158, 0x1.7dfebap-4f},
+      {0.0f, 0, false, true, 159, 159, -0x1.ab1abcp-5f},
+      {0.0f, 0, false, true, 160, 160, -0x1.ddc38ap-4f},
+      {0.0f, 0, false, true, 161, 161, 0x1.806de4p-4f},
+      {0.0f, 0, false, true, 162, 162, -0x1.f27f7ep-5f},
+      {0.0f, 0, false, true, 163, 163, 0x1.d7a998p-8f},
+      {0.0f, 0, false, true, 164, 164, -0x1.362d0ap-4f},
+      {0x1.195cf8p+1f, 3, true, false, 166, 167, 0.0f},
+      {0x1.5d06a8p+1f, 0, true, false, 168, 169, 0.0f},
+      {0x1.6p+2f, 4, true, false, 170, 171, 0.0f},
+      {0x1.59fp+3f, 18, true, false, 172, 173, 0.0f},
+      {0x1.1f217p+1f, 2, true, false, 174, 175, 0.0f},
+      {0x1.d45672p+1f, 3, true, false, 176, 177, 0.0f},
+      {0x1.d6da88p+1f, 0, true, false, 178, 179, 0.0f},
+      {0.0f, 0, false, true, 172, 172, 0x1.8ec294p-4f},
+      {0.0f, 0, false, true, 173, 173, -0x1.ca1a5p-5f},
+      {0.0f, 0, false, true, 174, 174, 0x1.544dd4p-7f},
+      {0.0f, 0, false, true, 175, 175, -0x1.8c1a72p-4f},
+      {0.0f, 0, false, true, 176, 176, -0x1.1c9eecp-4f},
+      {0.0f, 0, false, true, 177, 177, -0x1.e724c4p-4f},
+      {0.0f, 0, false, true, 178, 178, 0x1.331fbcp-4f},
+      {0.0f, 0, false, true, 179, 179, -0x1.1ebc18p-5f},
+      {0x1.2p+2f, 4, true, false, 181, 182, 0.0f},
+      {0x1.09e902p+0f, 3, true, false, 183, 184, 0.0f},
+      {0x1.168cep+2f, 0, true, false, 185, 186, 0.0f},
+      {0x1.1a38e6p+0f, 16, true, false, 187, 188, 0.0f},
+      {0x1.4p+1f, 19, true, false, 189, 190, 0.0f},
+      {0x1.2f9398p+1f, 0, true, false, 191, 192, 0.0f},
+      {0x1.8e421p+0f, 2, true, false, 193, 194, 0.0f},
+      {0.0f, 0, false, true, 187, 187, -0x1.26e3eap-4f},
+      {0.0f, 0, false, true, 188, 188, 0x1.722498p-5f},
+      {0.0f, 0, false, true, 189, 189, -0x1.9af4cap-4f},
+      {0.0f, 0, false, true, 190, 190, -0x1.62998ep-7f},
+      {0.0f, 0, false, true, 191, 191, 0x1.b0edbep-4f},
+      {0.0f, 0, false, true, 192, 192, 0x1.81bc04p-5f},
+      {0.0f, 0, false, true, 193, 193, 0x1.34cdfep-9f},
+      {0.0f, 0, false, true, 194, 194, -0x1.0bc65cp-4f},
+      {0x1.2c15cp+1f, 3, true, false, 196, 197, 0.0f},
+      {0x1.0f31dcp+2f, 0, true, false, 198, 199, 0.0f},
+      {0x1.c2f934p+1f, 3, true, false, 200, 201, 0.0f},
+      {0x1.0f93ap+1f, 2, true, false, 202, 203, 0.0f},
+      {0x1.2p+2f, 4, true, false, 204, 205, 0.0f},
+      {0x1.148178p+1f, 0, true, false, 206, 207, 0.0f},
+      {0x1.286a6ep+1f, 16, true, false, 208, 209, 0.0f},
+      {0.0f, 0, false, true, 202, 202, 0x1.220fe8p-4f},
+      {0.0f, 0, false, true, 203, 203, -0x1.16db0cp-4f},
+      {0.0f, 0, false, true, 204, 204, -0x1.344de2p-4f},
+      {0.0f, 0, false, true, 205, 205, -0x1.db0fdep-8f},
+      {0.0f, 0, false, true, 206, 206, 0x1.af5e0ap-5f},
+      {0.0f, 0, false, true, 207, 207, -0x1.0af31p-4f},
+      {0.0f, 0, false, true, 208, 208, -0x1.d81192p-4f},
+      {0.0f, 0, false, true, 209, 209, -0x1.294e7ep-4f},
+      {0x1.3b75b4p+1f, 3, true, false, 211, 212, 0.0f},
+      {0x1.46c6f8p+1f, 0, true, false, 213, 214, 0.0f},
+      {0x1.dac33p+1f, 3, true, false, 215, 216, 0.0f},
+      {0x1.3bfp+3f, 18, true, false, 217, 218, 0.0f},
+      {0x1.6p+2f, 4, true, false, 219, 220, 0.0f},
+      {0x1.7ecd28p+0f, 2, true, false, 221, 222, 0.0f},
+      {0x1.447928p+1f, 16, true, false, 223, 224, 0.0f},
+      {0.0f, 0, false, true, 217, 217, 0x1.6ff82ap-4f},
+      {0.0f, 0, false, true, 218, 218, -0x1.1e29fp-5f},
+      {0.0f, 0, false, true, 219, 219, -0x1.043fb8p-5f},
+      {0.0f, 0, false, true, 220, 220, 0x1.835f2p-5f},
+      {0.0f, 0, false, true, 221, 221, -0x1.2dce4p-6f},
+      {0.0f, 0, false, true, 222, 222, -0x1.6f569ep-4f},
+      {0.0f, 0, false, true, 223, 223, -0x1.c7de8ep-4f},
+      {0.0f, 0, false, true, 224, 224, -0x1.b06224p-5f},
+      {0x1.2p+2f, 4, true, false, 226, 227, 0.0f},
+      {0x1.3594p+0f, 2, true, false, 228, 229, 0.0f},
+      {0x1.4ef42p+1f, 0, true, false, 230, 231, 0.0f},
+      {0x1.99ep+1f, 17, true, false, 232, 233, 0.0f},
+      {0x1.b62002p+1f, 17, true, false, 234, 235, 0.0f},
+      {0x1.de22p+0f, 0, true, false, 236, 237, 0.0f},
+      {0x1.232d1p+1f, 2, true, false, 238, 239, 0.0f},
+      {0.0f, 0, false, true, 232, 232, -0x1.0eab58p-5f},
+      {0.0f, 0, false, true, 233, 233, 0x1.af9bc2p-4f},
+      {0.0f, 0, false, true, 234, 234, -0x1.9a79a6p-4f},
+      {0.0f, 0, false, true, 235, 235, -0x1.9018e6p-6f},
+      {0.0f, 0, false, true, 236, 236, 0x1.b1ae8ap-4f},
+      {0.0f, 0, false, true, 237, 237, 0x1.2ba392p-4f},
+      {0.0f, 0, false, true, 238, 238, 0x1.64a6a8p-6f},
+      {0.0f, 0, false, true, 239, 239, -0x1.48641cp-4f},
+      {0x1.4a792p+1f, 3, true, false, 241, 242, 0.0f},
+      {0x1.194ap+1f, 0, true, false, 243, 244, 0.0f},
+      {0x1.6p+2f, 4, true, false, 245, 246, 0.0f},
+      {0x1.5dbp+3f, 18, true, false, 247, 248, 0.0f},
+      {0x1.6p+2f, 4, true, false, 249, 250, 0.0f},
+      {0x1.064c7cp+1f, 16, true, false, 251, 252, 0.0f},
+      {0x1.2cb85cp+2f, 0, true, false, 253, 254, 0.0f},
+      {0.0f, 0, false, true, 247, 247, 0x1.753dfcp-4f},
+      {0.0f, 0, false, true, 248, 248, -0x1.292902p-5f},
+      {0.0f, 0, false, true, 249, 249, -0x1.9c1622p-6f},
+      {0.0f, 0, false, true, 250, 250, 0x1.75cc66p-5f},
+      {0.0f, 0, false, true, 251, 251, -0x1.9e3a16p-4f},
+      {0.0f, 0, false, true, 252, 252, -0x1.a550c6p-5f},
+      {0.0f, 0, false, true, 253, 253, 0x1.5f460ap-5f},
+      {0.0f, 0, false, true, 254, 254, -0x1.a12886p-5f},
+      {0x1.21b98cp+1f, 3, true, false, 256, 257, 0.0f},
+      {0x1.23bcaap+2f, 0, true, false, 258, 259, 0.0f},
+      {0x1.09d618p+2f, 3, true, false, 260, 261, 0.0f},
+      {0x1.bc17dp+0f, 2, true, false, 262, 263, 0.0f},
+      {0x1.6cf8aep+2f, 0, true, false, 264, 265, 0.0f},
+      {0x1.13cd08p+1f, 0, true, false, 266, 267, 0.0f},
+      {0x1.447928p+1f, 16, true, false, 268, 269, 0.0f},
+      {0.0f, 0, false, true, 262, 262, 0x1.f03a44p-5f},
+      {0.0f, 0, false, true, 263, 263, -0x1.6fe42ep-6f},
+      {0.0f, 0, false, true, 264, 264, -0x1.4ad668p-6f},
+      {0.0f, 0, false, true, 265, 265, -0x1.523ae6p-4f},
+      {0.0f, 0, false, true, 266, 266, 0x1.ab2df6p-5f},
+      {0.0f, 0, false, true, 267, 267, -0x1.cfacc6p-5f},
+      {0.0f, 0, false, true, 268, 268, -0x1.b4e85ap-4f},
+      {0.0f, 0, false, true, 269, 269, -0x1.68f482p-5f},
+      {0x1.83847p+0f, 3, true, false, 271, 272, 0.0f},
+      {0x1.362698p+2f, 0, true, false, 273, 274, 0.0f},
+      {0x1.6p+2f, 4, true, false, 275, 276, 0.0f},
+      {0x1.0d4e1cp+1f, 2, true, false, 277, 278, 0.0f},
+      {0x1.811aap+2f, 1, true, false, 279, 280, 0.0f},
+      {0x1.6a6688p+0f, 2, true, false, 281, 282, 0.0f},
+      {0x1.3054ap+2f, 0, true, false, 283, 284, 0.0f},
+      {0.0f, 0, false, true, 277, 277, 0x1.cc93bep-5f},
+      {0.0f, 0, false, true, 278, 278, -0x1.8f25c6p-5f},
+      {0.0f, 0, false, true, 279, 279, -0x1.2f4bb6p-6f},
+      {0.0f, 0, false, true, 280, 280, -0x1.5f9352p-4f},
+      {0.0f, 0, false, true, 281, 281, -0x1.000e46p-5f},
+      {0.0f, 0, false, true, 282, 282, -0x1.83000ap-4f},
+      {0.0f, 0, false, true, 283, 283, 0x1.bdb40cp-5f},
+      {0.0f, 0, false, true, 284, 284, -0x1.18c404p-5f},
+      {0x1.2p+2f, 4, true, false, 286, 287, 0.0f},
+      {0x1.4p+1f, 19, true, false, 288, 289, 0.0f},
+      {0x1.5210bap+1f, 0, true, false, 290, 291, 0.0f},
+      {0x1.919fd8p+0f, 0, true, false, 292, 293, 0.0f},
+      {0x1p-1f, 15, true, false, 294, 295, 0.0f},
+      {0x1.667ddp+0f, 16, true, false, 296, 297, 0.0f},
+      {0x1.2d4c62p+1f, 2, true, false, 298, 299, 0.0f},
+      {0.0f, 0, false, true, 292, 292, 0x1.f1c05p-5f},
+      {0.0f, 0, false, true, 293, 293, -0x1.295f2ap-4f},
+      {0.0f, 0, false, true, 294, 294, 0x1.270d9ep-4f},
+      {0.0f, 0, false, true, 295, 295, -0x1.05953p-4f},
+      {0.0f, 0, false, true, 296, 296, 0x1.a905a2p-4f},
+      {0.0f, 0, false, true, 297, 297, 0x1.0513fep-4f},
+      {0.0f, 0, false, true, 298, 298, 0x1.e539f6p-7f},
+      {0.0f, 0, false, true, 299, 299, -0x1.19fedep-4f},
+      {0x1.6p+2f, 4, true, false, 301, 302, 0.0f},
+      {0x1.925a28p+0f, 2, true, false, 303, 304, 0.0f},
+      {0x1.3bdbf8p+1f, 2, true, false, 305, 306, 0.0f},
+      {0x1.f86p+2f, 18, true, false, 307, 308, 0.0f},
+      {0x1.f56a62p-1f, 3, true, false, 309, 310, 0.0f},
+      {0x1.6ef882p+2f, 1, true, false, 311, 312, 0.0f},
+      {0x1.73231cp+1f, 16, true, false, 313, 314, 0.0f},
+      {0.0f, 0, false, true, 307, 307, 0x1.662f64p-6f},
+      {0.0f, 0, false, true, 308, 308, -0x1.556a14p-4f},
+      {0.0f, 0, false, true, 309, 309, -0x1.ebcbe6p-6f},
+      {0.0f, 0, false, true, 310, 310, -0x1.67b56ap-4f},
+      {0.0f, 0, false, true, 311, 311, 0x1.088cd6p-4f},
+      {0.0f, 0, false, true, 312, 312, -0x1.2c7072p-5f},
+      {0.0f, 0, false, true, 313, 313, -0x1.2d7344p-4f},
+      {0.0f, 0, false, true, 314, 314, 0.0f},
+      {0x1.82cabcp+1f, 3, true, false, 316, 317, 0.0f},
+      {0x1.258e26p+1f, 0, true, false, 318, 319, 0.0f},
+      {0x1.3cb2f8p+2f, 3, true, false, 320, 321, 0.0f},
+      {0x1.21bp+3f, 18, true, false, 322, 323, 0.0f},
+      {0x1.1dfp+3f, 18, true, false, 324, 325, 0.0f},
+      {0x1.879dcep-1f, 2, true, false, 326, 327, 0.0f},
+      {0x1p-1f, 20, true, false, 328, 329, 0.0f},
+      {0.0f, 0, false, true, 322, 322, 0x1.2c0feap-4f},
+      {0.0f, 0, false, true, 323, 323, -0x1.bb9d8ap-7f},
+      {0.0f, 0, false, true, 324, 324, 0x1.b0e074p-8f},
+      {0.0f, 0, false, true, 325, 325, -0x1.6a9268p-4f},
+      {0.0f, 0, false, true, 326, 326, -0x1.14eaap-7f},
+      {0.0f, 0, false, true, 327, 327, -0x1.1a3186p-4f},
+      {0.0f, 0, false, true, 328, 328, -0x1.3982dep-5f},
+      {0.0f, 0, false, true, 329, 329, -0x1.ac0f1ap-4f},
+      {0x1.96e92ep+1f, 3, true, false, 331, 332, 0.0f},
+      {0x1.13d8bp+1f, 0, true, false, 333, 334, 0.0f},
+      {0x1.ebdd1ap+0f, 16, true, false, 335, 336, 0.0f},
+      {0x1.581p+3f, 18, true, false, 337, 338, 0.0f},
+      {0x1.89cp+1f, 17, true, false, 339, 340, 0.0f},
+      {0x1.6p+2f, 4, true, false, 341, 342, 0.0f},
+      {0x1.96ep+2f, 18, true, false, 343, 344, 0.0f},
+      {0.0f, 0, false, true, 337, 337, 0x1.1ff6b6p-4f},
+      {0.0f, 0, false, true, 338, 338, -0x1.582438p-5f},
+      {0.0f, 0, false, true, 339, 339, -0x1.1f28cap-6f},
+      {0.0f, 0, false, true, 340, 340, 0x1.89f6eep-5f},
+      {0.0f, 0, false, true, 341, 341, -0x1.8604fap-4f},
+      {0.0f, 0, false, true, 342, 342, 0.0f},
+      {0.0f, 0, false, true, 343, 343, -0x1.901a1ap-7f},
+      {0.0f, 0, false, true, 344, 344, -0x1.587b8ep-4f},
+      {0x1.38814cp+0f, 3, true, false, 346, 347, 0.0f},
+      {0x1.37b042p+2f, 0, true, false, 348, 349, 0.0f},
+      {0x1.6p+2f, 4, true, false, 350, 351, 0.0f},
+      {0x1.3bfp+3f, 18, true, false, 352, 353, 0.0f},
+      {0x1.98598p-3f, 16, true, false, 354, 355, 0.0f},
+      {0x1.8bap+1f, 17, true, false, 356, 357, 0.0f},
+      {0x1.872878p+1f, 0, true, false, 358, 359, 0.0f},
+      {0.0f, 0, false, true, 352, 352, 0x1.817f2p-5f},
+      {0.0f, 0, false, true, 353, 353, -0x1.006412p-4f},
+      {0.0f, 0, false, true, 354, 354, -0x1.b0700ap-4f},
+      {0.0f, 0, false, true, 355, 355, -0x1.195978p-6f},
+      {0.0f, 0, false, true, 356, 356, -0x1.02b3d2p-4f},
+      {0.0f, 0, false, true, 357, 357, 0x1.365962p-6f},
+      {0.0f, 0, false, true, 358, 358, 0x1.0d6ab4p-4f},
+      {0.0f, 0, false, true, 359, 359, 0.0f},
+      {0x1.c61c3cp+0f, 2, true, false, 361, 362, 0.0f},
+      {0x1.383p+3f, 18, true, false, 363, 364, 0.0f},
+      {0x1.6p+2f, 4, true, false, 365, 366, 0.0f},
+      {0x1.493d08p+2f, 0, true, false, 367, 368, 0.0f},
+      {0x1.6p+2f, 4, true, false, 369, 370, 0.0f},
+      {0x1.103p+2f, 17, true, false, 371, 372, 0.0f},
+      {0x1.43378ep+1f, 2, true, false, 373, 374, 0.0f},
+      {0.0f, 0, false, true, 367, 367, 0x1.25c132p-5f},
+      {0.0f, 0, false, true, 368, 368, -0x1.273a44p-5f},
+      {0.0f, 0, false, true, 369, 369, -0x1.91a7dcp-4f},
+      {0.0f, 0, false, true, 370, 370, 0x1.184de6p-4f},
+      {0.0f, 0, false, true, 371, 371, -0x1.4bf14p-4f},
+      {0.0f, 0, false, true, 372, 372, -0x1.43ac48p-7f},
+      {0.0f, 0, false, true, 373, 373, 0x1.d893e8p-6f},
+      {0.0f, 0, false, true, 374, 374, -0x1.2db93p-4f},
+      {0x1.bedf68p+0f, 2, true, false, 376, 377, 0.0f},
+      {0x1.bfp+1f, 17, true, false, 378, 379, 0.0f},
+      {0x1.6p+2f, 4, true, false, 380, 381, 0.0f},
+      {0x1p-1f, 7, true, false, 382, 383, 0.0f},
+      {0x1p-1f, 12, true, false, 384, 385, 0.0f},
+      {0x1p-1f, 5, true, false, 386, 387, 0.0f},
+      {0x1.46b4ecp+1f, 2, true, false, 388, 389, 0.0f},
+      {0.0f, 0, false, true, 382, 382, -0x1.5fa734p-5f},
+      {0.0f, 0, false, true, 383, 383, 0x1.d1d094p-6f},
+      {0.0f, 0, false, true, 384, 384, -0x1.95518ap-5f},
+      {0.0f, 0, false, true, 385, 385, 0x1.660256p-4f},
+      {0.0f, 0, false, true, 386, 386, -0x1.101e74p-5f},
+      {0.0f, 0, false, true, 387, 387, -0x1.4ca224p-4f},
+      {0.0f, 0, false, true, 388, 388, 0x1.5381cap-6f},
+      {0.0f, 0, false, true, 389, 389, -0x1.0f66a2p-4f},
+      {0x1.0788b4p+1f, 0, true, false, 391, 392, 0.0f},
+      {0x1.2p+2f, 4, true, false, 393, 394, 0.0f},
+      {0x1.c5d918p+1f, 3, true, false, 395, 396, 0.0f},
+      {0x1.c67ffcp-1f, 17, true, false, 397, 398, 0.0f},
+      {0x1.145c44p+0f, 1, true, false, 399, 400, 0.0f},
+      {0x1.8a0002p+1f, 17, true, false, 401, 402, 0.0f},
+      {0x1.7b040cp+2f, 3, true, false, 403, 404, 0.0f},
+      {0.0f, 0, false, true, 397, 397, -0x1.11903ap-5f},
+      {0.0f, 0, false, true, 398, 398, 0x1.cb46dcp-5f},
+      {0.0f, 0, false, true, 399, 399, 0x1.616a2ap-4f},
+      {0.0f, 0, false, true, 400, 400, 0x1.4fb328p-5f},
+      {0.0f, 0, false, true, 401, 401, -0x1.0f9574p-6f},
+      {0.0f, 0, false, true, 402, 402, 0x1.444fb6p-5f},
+      {0.0f, 0, false, true, 403, 403, -0x1.023acap-4f},
+      {0.0f, 0, false, true, 404, 404, -0x1.a93128p-4f},
+      {0x1.276158p+0f, 3, true, false, 406, 407, 0.0f},
+      {0x1.f56f2cp+1f, 0, true, false, 408, 409, 0.0f},
+      {0x1.d2ep+2f, 18, true, false, 410, 411, 0.0f},
+      {0x1.d1e318p+0f, 0, true, false, 412, 413, 0.0f},
+      {0x1.6d92a8p+2f, 0, true, false, 414, 415, 0.0f},
+      {0x1.8ce342p+0f, 2, true, false, 416, 417, 0.0f},
+      {0x1.2p+2f, 4, true, false, 418, 419, 0.0f},
+      {0.0f, 0, false, true, 412, 412, 0x1.39c5d6p-4f},
+      {0.0f, 0, false, true, 413, 413, 0x1.100dcap-5f},
+      {0.0f, 0, false, true, 414, 414, 0x1.3571c2p-7f},
+      {0.0f, 0, false, true, 415, 415, -0x1.8a38ep-5f},
+      {0.0f, 0, false, true, 416, 416, 0x1.33ee6p-7f},
+      {0.0f, 0, false, true, 417, 417, -0x1.797e6cp-5f},
+      {0.0f, 0, false, true, 418, 418, -0x1.701caep-4f},
+      {0.0f, 0, false, true, 419, 419, -0x1.5a5588p-6f},
+      {0x1.6p+2f, 4, true, false, 421, 422, 0.0f},
+      {0x1.034p+0f, 17, true, false, 423, 424, 0.0f},
+      {0x1.7b113p+1f, 0, true, false, 425, 426, 0.0f},
+      {0x1p-1f, 5, true, false, 427, 428, 0.0f},
+      {0x1.077p+3f, 18, true, false, 429, 430, 0.0f},
+      {0x1.f35f42p-1f, 16, true, false, 431, 432, 0.0f},
+      {0x1.a7d3dp+0f, 16, true, false, 433, 434, 0.0f},
+      {0.0f, 0, false, true, 427, 427, 0x1.8dc068p-6f},
+      {0.0f, 0, false, true, 428, 428, -0x1.42ec8cp-4f},
+      {0.0f, 0, false, true, 429, 429, 0x1.e34718p-7f},
+      {0.0f, 0, false, true, 430, 430, -0x1.09b6ap-4f},
+      {0.0f, 0, false, true, 431, 431, 0x1.b962f4p-4f},
+      {0.0f, 0, false, true, 432, 432, 0x1.5db0a2p-5f},
+      {0.0f, 0, false, true, 433, 433, 0x1.2a8b2p-5f},
+      {0.0f, 0, false, true, 434, 434, -0x1.f9e67p-7f},
+      {0x1.038cd8p+1f, 0, true, false, 436, 437, 0.0f},
+      {0x1.b210b8p-2f, 1, true, false, 438, 439, 0.0f},
+      {0x1.f0ep+2f, 18, true, false, 440, 441, 0.0f},
+      {0x1.f78428p+1f, 3, true, false, 442, 443, 0.0f},
+      {0x1.2p+2f, 4, true, false, 444, 445, 0.0f},
+      {0x1.1c9954p+1f, 2, true, false, 446, 447, 0.0f},
+      {0x1.6p+2f, 4, true, false, 448, 449, 0.0f},
+      {0.0f, 0, false, true, 442, 442, 0x1.55bd38p-4f},
+      {0.0f, 0, false, true, 443, 443, 0.0f},
+      {0.0f, 0, false, true, 444, 444, -0x1.ff5c32p-8f},
+      {0.0f, 0, false, true, 445, 445, 0x1.b88ddap-5f},
+      {0.0f, 0, false, true, 446, 446, 0x1.ed1438p-8f},
+      {0.0f, 0, false, true, 447, 447, -0x1.c96dcap-5f},
+      {0.0f, 0, false, true, 448, 448, -0x1.412892p-4f},
+      {0.0f, 0, false, true, 449, 449, 0x1.4ec76ep-7f},
+      {0x1.02fe1p+2f, 3, true, false, 451, 452, 0.0f},
+      {0x1.2150a4p+2f, 0, true, false, 453, 454, 0.0f},
+      {0x1.29aac8p+1f, 16, true, false, 455, 456, 0.0f},
+      {0x1.527p+3f, 18, true, false, 457, 458, 0.0f},
+      {0x1p-1f, 12, true, false, 459, 460, 0.0f},
+      {0x1.7aa1bp+2f, 3, true, false, 461, 462, 0.0f},
+      {0x1.3cep+2f, 18, true, false, 463, 464, 0.0f},
+      {0.0f, 0, false, true, 457, 457, 0x1.99f1d8p-6f},
+      {0.0f, 0, false, true, 458, 458, -0x1.109ff8p-4f},
+      {0.0f, 0, false, true, 459, 459, -0x1.b270a2p-5f},
+      {0.0f, 0, false, true, 460, 460, -0x1.05188cp-7f},
+      {0.0f, 0, false, true, 461, 461, -0x1.ffb02cp-5f},
+      {0.0f, 0, false, true, 462, 462, -0x1.a9c6cep-4f},
+      {0.0f, 0, false, true, 463, 463, 0x1.6bf35p-8f},
+      {0.0f, 0, false, true, 464, 464, -0x1.1150a6p-4f},
+      {0x1.2p+2f, 4, true, false, 466, 467, 0.0f},
+      {0x1.8bb438p+0f, 16, true, false, 468, 469, 0.0f},
+      {0x1.73fc42p+2f, 0, true, false, 470, 471, 0.0f},
+      {0x1p-1f, 10, true, false, 472, 473, 0.0f},
+      {0x1.c7ap+2f, 18, true, false, 474, 475, 0.0f},
+      {0x1.2b03f8p+0f, 1, true, false, 476, 477, 0.0f},
+      {0x1.006e64p+0f, 3, true, false, 478, 479, 0.0f},
+      {0.0f, 0, false, true, 472, 472, -0x1.b8fc8ap-5f},
+      {0.0f, 0, false, true, 473, 473, -0x1.c9927ap-4f},
+      {0.0f, 0, false, true, 474, 474, 0x1.0d189p-5f},
+      {0.0f, 0, false, true, 475, 475, -0x1.0d99aep-4f},
+      {0.0f, 0, false, true, 476, 476, 0x1.18ef7p-4f},
+      {0.0f, 0, false, true, 477, 477, 0x1.17431p-6f},
+      {0.0f, 0, false, true, 478, 478, -0x1.0800e4p-6f},
+      {0.0f, 0, false, true, 479, 479, -0x1.24e92cp-4f},
+      {0x1.a5946p+0f, 2, true, false, 481, 482, 0.0f},
+      {0x1.d80002p+1f, 17, true, false, 483, 484, 0.0f},
+      {0x1.6p+2f, 4, true, false, 485, 486, 0.0f},
+      {0x1p-1f, 7, true, false, 487, 488, 0.0f},
+      {0x1p-1f, 15, true, false, 489, 490, 0.0f},
+      {0x1.168p+2f, 17, true, false, 491, 492, 0.0f},
+      {0x1.3e26b4p+1f, 2, true, false, 493, 494, 0.0f},
+      {0.0f, 0, false, true, 487, 487, -0x1.1a7facp-5f},
+      {0.0f, 0, false, true, 488, 488, 0x1.8be414p-6f},
+      {0.0f, 0, false, true, 489, 489, 0x1.c7a186p-4f},
+      {0.0f, 0, false, true, 490, 490, 0x1.6453a4p-5f},
+      {0.0f, 0, false, true, 491, 491, -0x1.ed15ep-5f},
+      {0.0f, 0, false, true, 492, 492, 0x1.cf1176p-8f},
+      {0.0f, 0, false, true, 493, 493, 0x1.80f62ep-6f},
+      {0.0f, 0, false, true, 494, 494, -0x1.d98dd4p-5f},
+      {0x1.d5e05ep+0f, 2, true, false, 496, 497, 0.0f},
+      {0x1.863ffep+1f, 17, true, false, 498, 499, 0.0f},
+      {0x1.2p+2f, 4, true, false, 500, 501, 0.0f},
+      {0x1p-1f, 7, true, false, 502, 503, 0.0f},
+      {0x1p-1f, 13, true, false, 504, 505, 0.0f},
+      {0x1.626002p+1f, 16, true, false, 506, 507, 0.0f},
+      {0x1.36a862p+2f, 0, true, false, 508, 509, 0.0f},
+      {0.0f, 0, false, true, 502, 502, -0x1.ae827ep-5f},
+      {0.0f, 0, false, true, 503, 503, 0x1.5a4496p-6f},
+      {0.0f, 0, false, true, 504, 504, -0x1.1047ap-4f},
+      {0.0f, 0, false, true, 505, 505, 0x1.07769p-4f},
+      {0.0f, 0, false, true, 506, 506, -0x1.27ee68p-4f},
+      {0.0f, 0, false, true, 507, 507, 0x1.9a1508p-9f},
+      {0.0f, 0, false, true, 508, 508, 0x1.642bf6p-9f},
+      {0.0f, 0, false, true, 509, 509, -0x1.6e7fa8p-5f},
+      {0x1.0a1b34p+2f, 3, true, false, 511, 512, 0.0f},
+      {0x1.54e034p+2f, 0, true, false, 513, 514, 0.0f},
+      {0x1.805a54p+2f, 3, true, false, 515, 516, 0.0f},
+      {0x1.365p+3f, 18, true, false, 517, 518, 0.0f},
+      {0x1.78717p+2f, 0, true, false, 519, 520, 0.0f},
+      {0x1.b98p-1f, 17, true, false, 521, 522, 0.0f},
+      {0x1.6aefecp+1f, 16, true, false, 523, 524, 0.0f},
+      {0.0f, 0, false, true, 517, 517, 0x1.1c1b54p-6f},
+      {0.0f, 0, false, true, 518, 518, -0x1.9a2bf8p-5f},
+      {0.0f, 0, false, true, 519, 519, -0x1.5088ep-6f},
+      {0.0f, 0, false, true, 520, 520, -0x1.e6819ep-5f},
+      {0.0f, 0, false, true, 521, 521, -0x1.2e2124p-4f},
+      {0.0f, 0, false, true, 522, 522, -0x1.cc737ap-6f},
+      {0.0f, 0, false, true, 523, 523, -0x1.8743dep-4f},
+      {0.0f, 0, false, true, 524, 524, 0.0f},
+      {0x1.d3f9b8p+0f, 0, true, false, 526, 527, 0.0f},
+      {0x1.9e7fe8p-2f, 1, true, false, 528, 529, 0.0f},
+      {0x1.91a234p-1f, 3, true, false, 530, 531, 0.0f},
+      {0x1.635p+3f, 18, true, false, 532, 533, 0.0f},
+      {0x1.2p+2f, 4, true, false, 534, 535, 0.0f},
+      {0x1p-1f, 5, true, false, 536, 537, 0.0f},
+      {0x1.4p+1f, 19, true, false, 538, 539, 0.0f},
+      {0.0f, 0, false, true, 532, 532, 0x1.2a1ad8p-4f},
+      {0.0f, 0, false, true, 533, 533, 0.0f},
+      {0.0f, 0, false, true, 534, 534, -0x1.579918p-10f},
+      {0.0f, 0, false, true, 535, 535, 0x1.960beep-5f},
+      {0.0f, 0, false, true, 536, 536, 0x1.0786f6p-4f},
+      {0.0f, 0, false, true, 537, 537, 0x1.9a1c1p-7f},
+      {0.0f, 0, false, true, 538, 538, -0x1.2a8b02p-5f},
+      {0.0f, 0, false, true, 539, 539, 0x1.c00d98p-8f},
+      {0x1.cfb2fcp+0f, 0, true, false, 541, 542, 0.0f},
+      {0x1.2p+2f, 4, true, false, 543, 544, 0.0f},
+      {0x1.6p+2f, 4, true, false, 545, 546, 0.0f},
+      {0x1.9a0002p-1f, 17, true, false, 547, 548, 0.0f},
+      {0x1.3afc04p+0f, 1, true, false, 549, 550, 0.0f},
+      {0x1.8p+0f, 20, true, false, 551, 552, 0.0f},
+      {0x1.fec43p+0f, 16, true, false, 553, 554, 0.0f},
+      {0.0f, 0, false, true, 547, 547, -0x1.04194cp-5f},
+      {0.0f, 0, false, true, 548, 548, 0x1.9209cap-5f},
+      {0.0f, 0, false, true, 549, 549, 0x1.21ca7p-4f},
+      {0.0f, 0, false, true, 550, 550, 0x1.7ef83ap-6f},
+      {0.0f, 0, false, true, 551, 551, 0x1.8181bap-6f},
+      {0.0f, 0, false, true, 552, 552, -0x1.262768p-5f},
+      {0.0f, 0, false, true, 553, 553, 0x1.3ed04ep-5f},
+      {0.0f, 0, false, true, 554, 554, -0x1.4ca72p-6f},
+      {0x1.0a91c4p+0f, 3, true, false, 556, 557, 0.0f},
+      {0x1.77ceap+2f, 0, true, false, 558, 559, 0.0f},
+      {0x1.347p+3f, 18, true, false, 560, 561, 0.0f},
+      {0x1.2aac72p+1f, 2, true, false, 562, 563, 0.0f},
+      {0x1.3e765p-2f, 3, true, false, 564, 565, 0.0f},
+      {0x1.83p+1f, 17, true, false, 566, 567, 0.0f},
+      {0x1.6p+2f, 4, true, false, 568, 569, 0.0f},
+      {0.0f, 0, false, true, 562, 562, 0x1.daff6ep-6f},
+      {0.0f, 0, false, true, 563, 563, -0x1.035ccap-5f},
+      {0.0f, 0, false, true, 564, 564, 0.0f},
+      {0.0f, 0, false, true, 565, 565, -0x1.5e7f8p-5f},
+      {0.0f, 0, false, true, 566, 566, -0x1.49ba1ap-6f},
+      {0.0f, 0, false, true, 567, 567, 0x1.78ab44p-6f},
+      {0.0f, 0, false, true, 568, 568, -0x1.4bcb2p-4f},
+      {0.0f, 0, false, true, 569, 569, 0.0f},
+      {0x1.197af4p+1f, 2, true, false, 571, 572, 0.0f},
+      {0x1.0a8004p+2f, 17, true, false, 573, 574, 0.0f},
+      {0x1.d93978p+0f, 16, true, false, 575, 576, 0.0f},
+      {0x1p-1f, 7, true, false, 577, 578, 0.0f},
+      {0x1p-1f, 12, true, false, 579, 580, 0.0f},
+      {0x1.2p+2f, 20, true, false, 581, 582, 0.0f},
+      {0x1.b365c8p+1f, 0, true, false, 583, 584, 0.0f},
+      {0.0f, 0, false, true, 577, 577, -0x1.cc7aaep-6f},
+      {0.0f, 0, false, true, 578, 578, 0x1.2180ep-6f},
+      {0.0f, 0, false, true, 579, 579, -0x1.6ee082p-5f},
+      {0.0f, 0, false, true, 580, 580, 0x1.17635ap-4f},
+      {0.0f, 0, false, true, 581, 581, -0x1.2abee8p-4f},
+      {0.0f, 0, false, true, 582, 582, -0x1.d7d3b6p-8f},
+      {0.0f, 0, false, true, 583, 583, -0x1.8c9374p-5f},
+      {0.0f, 0, false, true, 584, 584, -0x1.657a92p-7f},
+      {0x1.2ba64ep+2f, 3, true, false, 586, 587, 0.0f},
+      {0x1.3979b4p+2f, 0, true, false, 588, 589, 0.0f},
+      {0x1.0b0002p+0f, 17, true, false, 590, 591, 0.0f},
+      {0x1.2b1p+3f, 18, true, false, 592, 593, 0.0f},
+      {0x1p-1f, 12, true, false, 594, 595, 0.0f},
+      {0x1.3f77bcp+1f, 16, true, false, 596, 597, 0.0f},
+      {-0x1.2df828p-3f, 2, true, false, 598, 599, 0.0f},
+      {0.0f, 0, false, true, 592, 592, 0x1.26e69cp-6f},
+      {0.0f, 0, false, true, 593, 593, -0x1.3f1a22p-5f},
+      {0.0f, 0, false, true, 594, 594, -0x1.77019cp-5f},
+      {0.0f, 0, false, true, 595, 595, -0x1.636f7cp-7f},
+      {0.0f, 0, false, true, 596, 596, -0x1.89a01cp-4f},
+      {0.0f, 0, false, true, 597, 597, 0.0f},
+      {0.0f, 0, false, true, 598, 598, 0.0f},
+      {0.0f, 0, false, true, 599, 599, -0x1.bd7edep-5f},
+      {0x1.235b6p+2f, 3, true, false, 601, 602, 0.0f},
+      {0x1.87ep+2f, 18, true, false, 603, 604, 0.0f},
+      {0x1.24f53ap+1f, 16, true, false, 605, 606, 0.0f},
+      {0x1p-1f, 5, true, false, 607, 608, 0.0f},
+      {0x1.2p+2f, 4, true, false, 609, 610, 0.0f},
+      {0x1.cp+1f, 19, true, false, 611, 612, 0.0f},
+      {0x1.733a3p-1f, 2, true, false, 613, 614, 0.0f},
+      {0.0f, 0, false, true, 607, 607, 0x1.7633ep-5f},
+      {0.0f, 0, false, true, 608, 608, 0x1.925582p-8f},
+      {0.0f, 0, false, true, 609, 609, -0x1.a5b56p-5f},
+      {0.0f, 0, false, true, 610, 610, 0x1.296c42p-7f},
+      {0.0f, 0, false, true, 611, 611, -0x1.5d6a68p-4f},
+      {0.0f, 0, false, true, 612, 612, -0x1.24c232p-6f},
+      {0.0f, 0, false, true, 613, 613, 0x1.18edfp-6f},
+      {0.0f, 0, false, true, 614, 614, -0x1.3fac58p-5f},
+      {0x1.a28b48p+0f, 2, true, false, 616, 617, 0.0f},
+      {0x1.10ap+1f, 17, true, false, 618, 619, 0.0f},
+      {0x1.2p+2f, 20, true, false, 620, 621, 0.0f},
+      {0x1p-1f, 7, true, false, 622, 623, 0.0f},
+      {0x1p-1f, 12, true, false, 624, 625, 0.0f},
+      {0x1p-1f, 12, true, false, 626, 627, 0.0f},
+      {0x1p-1f, 7, true, false, 628, 629, 0.0f},
+      {0.0f, 0, false, true, 622, 622, -0x1.7e4e34p-4f},
+      {0.0f, 0, false, true, 623, 623, 0x1.104f3p-6f},
+      {0.0f, 0, false, true, 624, 624, -0x1.0f8532p-4f},
+      {0.0f, 0, false, true, 625, 625, 0x1.64817ep-5f},
+      {0.0f, 0, false, true, 626, 626, -0x1.035c2ap-4f},
+      {0.0f, 0, false, true, 627, 627, -0x1.5cfcdcp-6f},
+      {0.0f, 0, false, true, 628, 628, -0x1.d21944p-4f},
+      {0.0f, 0, false, true, 629, 629, 0x1.5d4e4ep-6f},
+      {0x1.d3f7e8p+0f, 0, true, false, 631, 632, 0.0f},
+      {0x1.11b568p-1f, 1, true, false, 633, 634, 0.0f},
+      {0x1.43d9dcp+2f, 3, true, false, 635, 636, 0.0f},
+      {0x1.0cd0f8p+2f, 3, true, false, 637, 638, 0.0f},
+      {0x1.2p+2f, 4, true, false, 639, 640, 0.0f},
+      {0x1.68fp+3f, 18, true, false, 641, 642, 0.0f},
+      {0x1.2b6128p+1f, 16, true, false, 643, 644, 0.0f},
+      {0.0f, 0, false, true, 637, 637, 0x1.fd20b6p-5f},
+      {0.0f, 0, false, true, 638, 638, 0.0f},
+      {0.0f, 0, false, true, 639, 639, -0x1.94db8ap-8f},
+      {0.0f, 0, false, true, 640, 640, 0x1.2aa28cp-5f},
+      {0.0f, 0, false, true, 641, 641, 0x1.acecd8p-10f},
+      {0.0f, 0, false, true, 642, 642, -0x1.17cc42p-4f},
+      {0.0f, 0, false, true, 643, 643, -0x1.514c1ap-4f},
+      {0.0f, 0, false, true, 644, 644, -0x1.c76e8ep-7f},
+      {0x1.26a63ep+1f, 2, true, false, 646, 647, 0.0f},
+      {0x1.0fbp+2f, 17, true, false, 648, 649, 0.0f},
+      {0x1.ecfbbcp+0f, 16, true, false, 650, 651, 0.0f},
+      {0x1.6p+2f, 4, true, false, 652, 653, 0.0f},
+      {0x1p-1f, 14, true, false, 654, 655, 0.0f},
+      {0x1.2p+2f, 20, true, false, 656, 657, 0.0f},
+      {0x1p-1f, 12, true, false, 658, 659, 0.0f},
+      {0.0f, 0, false, true, 652, 652, -0x1.8ca1ep-7f},
+      {0.0f, 0, false, true, 653, 653, 0x1.9715f4p-6f},
+      {0.0f, 0, false, true, 654, 654, 0x1.bea6fep-4f},
+      {0.0f, 0, false, true, 655, 655, 0x1.123aa4p-5f},
+      {0.0f, 0, false, true, 656, 656, -0x1.1549cep-4f},
+      {0.0f, 0, false, true, 657, 657, -0x1.ebd08ap-6f},
+      {0.0f, 0, false, true, 658, 658, -0x1.4af4eap-5f},
+      {0.0f, 0, false, true, 659, 659, 0.0f},
+      {0x1.972e28p+0f, 0, true, false, 661, 662, 0.0f},
+      {0x1p-1f, 6, true, false, 663, 664, 0.0f},
+      {0x1.1032b8p+0f, 3, true, false, 665, 666, 0.0f},
+      {0x1.8p+0f, 19, true, false, 667, 668, 0.0f},
+      {0x1p-1f, 7, true, false, 669, 670, 0.0f},
+      {0x1p-1f, 5, true, false, 671, 672, 0.0f},
+      {0x1.146p+1f, 17, true, false, 673, 674, 0.0f},
+      {0.0f, 0, false, true, 667, 667, -0x1.648a76p-4f},
+      {0.0f, 0, false, true, 668, 668, 0x1.6bca4cp-5f},
+      {0.0f, 0, false, true, 669, 669, 0.0f},
+      {0.0f, 0, false, true, 670, 670, 0x1.311b54p-4f},
+      {0.0f, 0, false, true, 671, 671, 0x1.8adeaap-5f},
+      {0.0f, 0, false, true, 672, 672, 0x1.50122ap-9f},
+      {0.0f, 0, false, true, 673, 673, -0x1.f50f24p-6f},
+      {0.0f, 0, false, true, 674, 674, 0x1.3f1272p-8f},
+      {0x1.5bd4c6p+2f, 0, true, false, 676, 677, 0.0f},
+      {0x1.e969f2p+0f, 2, true, false, 678, 679, 0.0f},
+      {0x1.6b0936p-3f, 16, true, false, 680, 681, 0.0f},
+      {0x1.12bp+2f, 17, true, false, 682, 683, 0.0f},
+      {0x1.2p+2f, 20, true, false, 684, 685, 0.0f},
+      {0.0f, 0, false, true, 680, 680, -0x1.a9fce2p-4f},
+      {0x1.8d07ap+2f, 0, true, false, 686, 687, 0.0f},
+      {0.0f, 0, false, true, 682, 682, 0x1.96dfdp-8f},
+      {0.0f, 0, false, true, 683, 683, 0x1.e7c61ap-5f},
+      {0.0f, 0, false, true, 684, 684, -0x1.46740ep-5f},
+      {0.0f, 0, false, true, 685, 685, 0x1.03259ep-6f},
+      {0.0f, 0, false, true, 686, 686, -0x1.644c8ap-6f},
+      {0.0f, 0, false, true, 687, 687, -0x1.e42722p-5f},
+      {0x1.5d23a2p+2f, 0, true, false, 689, 690, 0.0f},
+      {0x1.2b6354p+2f, 3, true, false, 691, 692, 0.0f},
+      {0x1.89cd14p+2f, 1, true, false, 693, 694, 0.0f},
+      {0x1.46a0cep+1f, 2, true, false, 695, 696, 0.0f},
+      {0x1.8ae878p+2f, 3, true, false, 697, 698, 0.0f},
+      {0x1.2p+2f, 4, true, false, 699, 700, 0.0f},
+      {0x1.065ffep+1f, 17, true, false, 701, 702, 0.0f},
+      {0.0f, 0, false, true, 695, 695, 0x1.5182fcp-7f},
+      {0.0f, 0, false, true, 696, 696, -0x1.4970eap-5f},
+      {0.0f, 0, false, true, 697, 697, -0x1.f1dd5p-6f},
+      {0.0f, 0, false, true, 698, 698, -0x1.4e9184p-4f},
+      {0.0f, 0, false, true, 699, 699, -0x1.9c065cp-5f},
+      {0.0f, 0, false, true, 700, 700, -0x1.e07984p-8f},
+      {0.0f, 0, false, true, 701, 701, -0x1.3600b8p-4f},
+      {0.0f, 0, false, true, 702, 702, -0x1.31ed06p-5f},
+      {0x1.5eap+2f, 18, true, false, 704, 705, 0.0f},
+      {0x1p-1f, 5, true, false, 706, 707, 0.0f},
+      {0x1.2p+2f, 4, true, false, 708, 709, 0.0f},
+      {0x1.0faf28p+0f, 16, true, false, 710, 711, 0.0f},
+      {0x1.b21c3ep+0f, 0, true, false, 712, 713, 0.0f},
+      {0x1.4p+1f, 19, true, false, 714, 715, 0.0f},
+      {0x1.564db4p+2f, 0, true, false, 716, 717, 0.0f},
+      {0.0f, 0, false, true, 710, 710, -0x1.6e902p-9f},
+      {0.0f, 0, false, true, 711, 711, 0x1.c40df2p-5f},
+      {0.0f, 0, false, true, 712, 712, 0x1.990794p-5f},
+      {0.0f, 0, false, true, 713, 713, -0x1.7d8122p-9f},
+      {0.0f, 0, false, true, 714, 714, -0x1.eb57a2p-5f},
+      {0.0f, 0, false, true, 715, 715, -0x1.70ff54p-8f},
+      {0.0f, 0, false, true, 716, 716, 0x1.8b7984p-7f},
+      {0.0f, 0, false, true, 717, 717, -0x1.309142p-5f},
+      {0x1.68fp+3f, 18, true, false, 719, 720, 0.0f},
+      {0x1.6ce14cp+2f, 0, true, false, 721, 722, 0.0f},
+      {0x1.6p+2f, 4, true, false, 723, 724, 0.0f},
+      {0x1p-1f, 5, true, false, 725, 726, 0.0f},
+      {0x1.6p+2f, 4, true, false, 727, 728, 0.0f},
+      {0x1.01bffep+2f, 17, true, false, 729, 730, 0.0f},
+      {0x1.471f9cp+2f, 0, true, false, 731, 732, 0.0f},
+      {0.0f, 0, false, true, 725, 725, 0x1.0022dep-5f},
+      {0.0f, 0, false, true, 726, 726, 0.0f},
+      {0.0f, 0, false, true, 727, 727, -0x1.7862fep-5f},
+      {0.0f, 0, false, true, 728, 728, -0x1.ae2992p-7f},
+      {0.0f, 0, false, true, 729, 729, -0x1.4fb5e2p-4f},
+      {0.0f, 0, false, true, 730, 730, 0.0f},
+      {0.0f, 0, false, true, 731, 731, 0x1.7e454cp-5f},
+      {0.0f, 0, false, true, 732, 732, 0.0f},
+      {0x1.6p+2f, 20, true, false, 734, 735, 0.0f},
+      {0x1.e70004p-1f, 17, true, false, 736, 737, 0.0f},
+      {0x1.1418dap+0f, 16, true, false, 738, 739, 0.0f},
+      {0x1p-1f, 5, true, false, 740, 741, 0.0f},
+      {0x1.2436bep+0f, 2, true, false, 742, 743, 0.0f},
+      {0x1.3bae84p+2f, 0, true, false, 744, 745, 0.0f},
+      {0x1.e7032cp+1f, 0, true, false, 746, 747, 0.0f},
+      {0.0f, 0, false, true, 740, 740, 0x1.3e24c4p-5f},
+      {0.0f, 0, false, true, 741, 741, -0x1.03c0c8p-4f},
+      {0.0f, 0, false, true, 742, 742, 0x1.7aa362p-6f},
+      {0.0f, 0, false, true, 743, 743, -0x1.6bad98p-7f},
+      {0.0f, 0, false, true, 744, 744, 0x1.75a2fp-4f},
+      {0.0f, 0, false, true, 745, 745, 0.0f},
+      {0.0f, 0, false, true, 746, 746, 0x1.5db40ep-6f},
+      {0.0f, 0, false, true, 747, 747, -0x1.abb2acp-5f},
+      {0x1.2ca8aap-2f, 1, true, false, 749, 750, 0.0f},
+      {0x1.1b0748p+1f, 0, true, false, 751, 752, 0.0f},
+      {0x1.43db96p+2f, 3, true, false, 753, 754, 0.0f},
+      {0x1p-1f, 6, true, false, 755, 756, 0.0f},
+      {0x1.6p+2f, 20, true, false, 757, 758, 0.0f},
+      {0x1.617p+3f, 18, true, false, 759, 760, 0.0f},
+      {0x1.14a828p+1f, 16, true, false, 761, 762, 0.0f},
+      {0.0f, 0, false, true, 755, 755, 0x1.376b36p-6f},
+      {0.0f, 0, false, true, 756, 756, 0x1.0b760ap-4f},
+      {0.0f, 0, false, true, 757, 757, -0x1.6a0f36p-5f},
+      {0.0f, 0, false, true, 758, 758, 0.0f},
+      {0.0f, 0, false, true, 759, 759, 0x1.74d25ap-10f},
+      {0.0f, 0, false, true, 760, 760, -0x1.c7db48p-5f},
+      {0.0f, 0, false, true, 761, 761, -0x1.2e6c5ep-4f},
+      {0.0f, 0, false, true, 762, 762, -0x1.3a55e2p-6f},
+      {0x1.7a08fp-1f, 3, true, false, 764, 765, 0.0f},
+      {0x1p-1f, 5, true, false, 766, 767, 0.0f},
+      {0x1.6p+2f, 4, true, false, 768, 769, 0.0f},
+      {0x1p-1f, 9, true, false, 770, 771, 0.0f},
+      {0x1.b88e7cp+0f, 16, true, false, 772, 773, 0.0f},
+      {0x1.3b6acap+0f, 16, true, false, 774, 775, 0.0f},
+      {0x1.146d26p+0f, 16, true, false, 776, 777, 0.0f},
+      {0.0f, 0, false, true, 770, 770, 0x1.87dc7ap-6f},
+      {0.0f, 0, false, true, 771, 771, 0x1.adcc7ap-4f},
+      {0.0f, 0, false, true, 772, 772, 0x1.bed69p-6f},
+      {0.0f, 0, false, true, 773, 773, -0x1.fb0868p-9f},
+      {0.0f, 0, false, true, 774, 774, -0x1.703beap-5f},
+      {0.0f, 0, false, true, 775, 775, 0x1.25427p-10f},
+      {0.0f, 0, false, true, 776, 776, 0x1.69593ep-5f},
+      {0.0f, 0, false, true, 777, 777, -0x1.8f6b52p-8f},
+      {0x1.9aa8b4p-1f, 3, true, false, 779, 780, 0.0f},
+      {0x1.08f9d4p+0f, 1, true, false, 781, 782, 0.0f},
+      {0x1.9a8p-1f, 17, true, false, 783, 784, 0.0f},
+      {0x1.ed45eap+0f, 2, true, false, 785, 786, 0.0f},
+      {0x1p-1f, 5, true, false, 787, 788, 0.0f},
+      {0x1.6p+2f, 4, true, false, 789, 790, 0.0f},
+      {0x1.3910f4p+0f, 2, true, false, 791, 792, 0.0f},
+      {0.0f, 0, false, true, 785, 785, 0x1.851e9ep-5f},
+      {0.0f, 0, false, true, 786, 786, 0.0f},
+      {0.0f, 0, false, true, 787, 787, 0x1.2cb85p-5f},
+      {0.0f, 0, false, true, 788, 788, 0x1.eb6f7cp-8f},
+      {0.0f, 0, false, true, 789, 789, -0x1.a92d18p-5f},
+      {0.0f, 0, false, true, 790, 790, 0x1.5b9066p-6f},
+      {0.0f, 0, false, true, 791, 791, 0x1.c683b2p-7f},
+      {0.0f, 0, false, true, 792, 792, -0x1.f803d6p-7f},
+      {0x1.6p+2f, 20, true, false, 794, 795, 0.0f},
+      {0x1.068p+0f, 17, true, false, 796, 797, 0.0f},
+      {0x1.1407fcp+0f, 16, true, false, 798, 799, 0.0f},
+      {0x1p-1f, 5, true, false, 800, 801, 0.0f},
+      {0x1.8p+0f, 19, true, false, 802, 803, 0.0f},
+      {0x1.1db34p+2f, 0, true, false, 804, 805, 0.0f},
+      {0x1.f598c2p-1f, 1, true, false, 806, 807, 0.0f},
+      {0.0f, 0, false, true, 800, 800, 0x1.29188cp-5f},
+      {0.0f, 0, false, true, 801, 801, -0x1.9631cap-5f},
+      {0.0f, 0, false, true, 802, 802, 0x1.3d57ap-5f},
+      {0.0f, 0, false, true, 803, 803, -0x1.084244p-8f},
+      {0.0f, 0, false, true, 804, 804, 0x1.7b3118p-4f},
+      {0.0f, 0, false, true, 805, 805, 0x1.3496dp-7f},
+      {0.0f, 0, false, true, 806, 806, 0x1.cf80bp-5f},
+      {0.0f, 0, false, true, 807, 807, -0x1.aac7bcp-7f},
+      {0x1.815p+3f, 18, true, false, 809, 810, 0.0f},
+      {0x1.4743bep+0f, 2, true, false, 811, 812, 0.0f},
+      {0x1.2p+2f, 4, true, false, 813, 814, 0.0f},
+      {0x1.fep+0f, 17, true, false, 815, 816, 0.0f},
+      {0x1.2p+2f, 20, true, false, 817, 818, 0.0f},
+      {0x1.e4aca4p+1f, 2, true, false, 819, 820, 0.0f},
+      {0x1.ae5p+3f, 18, true, false, 821, 822, 0.0f},
+      {0.0f, 0, false, true, 815, 815, -0x1.2292fap-11f},
+      {0.0f, 0, false, true, 816, 816, 0x1.d1dc46p-6f},
+      {0.0f, 0, false, true, 817, 817, -0x1.2eb1f4p-6f},
+      {0.0f, 0, false, true, 818, 818, 0x1.56076p-6f},
+      {0.0f, 0, false, true, 819, 819, -0x1.508574p-4f},
+      {0.0f, 0, false, true, 820, 820, 0.0f},
+      {0.0f, 0, false, true, 821, 821, 0x1.74f188p-8f},
+      {0.0f, 0, false, true, 822, 822, -0x1.a690b8p-5f},
+      {0x1.22ap+2f, 18, true, false, 824, 825, 0.0f},
+      {0x1.8ed706p-5f, 1, true, false, 826, 827, 0.0f},
+      {0x1.2p+2f, 4, true, false, 828, 829, 0.0f},
+      {0x1p-1f, 12, true, false, 830, 831, 0.0f},
+      {0x1.17c002p+1f, 17, true, false, 832, 833, 0.0f},
+      {0x1.d05542p+0f, 16, true, false, 834, 835, 0.0f},
+      {0x1.ecda04p+0f, 16, true, false, 836, 837, 0.0f},
+      {0.0f, 0, false, true, 830, 830, 0x1.14357ap-4f},
+      {0.0f, 0, false, true, 831, 831, 0x1.76892p-6f},
+      {0.0f, 0, false, true, 832, 832, -0x1.5efbeep-9f},
+      {0.0f, 0, false, true, 833, 833, 0x1.54a65p-6f},
+      {0.0f, 0, false, true, 834, 834, -0x1.cd669ep-5f},
+      {0.0f, 0, false, true, 835, 835, -0x1.46173cp-7f},
+      {0.0f, 0, false, true, 836, 836, 0x1.2a3fd8p-6f},
+      {0.0f, 0, false, true, 837, 837, -0x1.e0f686p-7f},
+      {0x1.a22p+2f, 18, true, false, 839, 840, 0.0f},
+      {0x1.491538p+1f, 2, true, false, 841, 842, 0.0f},
+      {0x1.2p+2f, 4, true, false, 843, 844, 0.0f},
+      {0x1.80ea2cp+2f, 1, true, false, 845, 846, 0.0f},
+      {0x1.06f518p+1f, 16, true, false, 847, 848, 0.0f},
+      {0x1.4p+1f, 19, true, false, 849, 850, 0.0f},
+      {0x1.2bacecp+1f, 0, true, false, 851, 852, 0.0f},
+      {0.0f, 0, false, true, 845, 845, 0x1.25b4d2p-7f},
+      {0.0f, 0, false, true, 846, 846, -0x1.10985p-5f},
+      {0.0f, 0, false, true, 847, 847, -0x1.d82cd6p-5f},
+      {0.0f, 0, false, true, 848, 848, 0x1.1261eep-9f},
+      {0.0f, 0, false, true, 849, 849, -0x1.bfbb5ep-5f},
+      {0.0f, 0, false, true, 850, 850, 0.0f},
+      {0.0f, 0, false, true, 851, 851, 0x1.5eb65p-5f},
+      {0.0f, 0, false, true, 852, 852, -0x1.d83c66p-8f},
+      {0x1.7130b2p+2f, 3, true, false, 854, 855, 0.0f},
+      {0x1p-1f, 7, true, false, 856, 857, 0.0f},
+      {0x1.3ce628p+1f, 16, true, false, 858, 859, 0.0f},
+      {0x1p-1f, 12, true, false, 860, 861, 0.0f},
+      {0x1p-1f, 6, true, false, 862, 863, 0.0f},
+      {0x1p-1f, 20, true, false, 864, 865, 0.0f},
+      {0x1.377faap+1f, 0, true, false, 866, 867, 0.0f},
+      {0.0f, 0, false, true, 860, 860, -0x1.60c77ap-4f},
+      {0.0f, 0, false, true, 861, 861, 0x1.cf3808p-7f},
+      {0.0f, 0, false, true, 862, 862, -0x1.e4fe4p-5f},
+      {0.0f, 0, false, true, 863, 863, 0x1.3efe24p-6f},
+      {0.0f, 0, false, true, 864, 864, -0x1.0cb87p-7f},
+      {0.0f, 0, false, true, 865, 865, -0x1.4db3c4p-4f},
+      {0.0f, 0, false, true, 866, 866, 0x1.9c78a4p-6f},
+      {0.0f, 0, false, true, 867, 867, -0x1.02054ap-6f},
+      {0x1.68955cp+2f, 0, true, false, 869, 870, 0.0f},
+      {0x1.1c5078p+1f, 2, true, false, 871, 872, 0.0f},
+      {0x1.d1b754p+0f, 16, true, false, 873, 874, 0.0f},
+      {0x1.152p+2f, 17, true, false, 875, 876, 0.0f},
+      {0x1.e1fbfcp+0f, 16, true, false, 877, 878, 0.0f},
+      {0x1.b0d9cp-2f, 16, true, false, 879, 880, 0.0f},
+      {0x1p-1f, 20, true, false, 881, 882, 0.0f},
+      {0.0f, 0, false, true, 875, 875, 0x1.c91b04p-9f},
+      {0.0f, 0, false, true, 876, 876, 0x1.755cbp-5f},
+      {0.0f, 0, false, true, 877, 877, -0x1.564b86p-5f},
+      {0.0f, 0, false, true, 878, 878, -0x1.e3afcep-8f},
+      {0.0f, 0, false, true, 879, 879, -0x1.bf1f5cp-5f},
+      {0.0f, 0, false, true, 880, 880, -0x1.3b2474p-7f},
+      {0.0f, 0, false, true, 881, 881, 0.0f},
+      {0.0f, 0, false, true, 882, 882, -0x1.24c42p-4f},
+      {0x1p-1f, 7, true, false, 884, 885, 0.0f},
+      {0x1p-1f, 12, true, false, 886, 887, 0.0f},
+      {0x1p-1f, 6, true, false, 888, 889, 0.0f},
+      {0x1p-1f, 5, true, false, 890, 891, 0.0f},
+      {0x1p-1f, 13, true, false, 892, 893, 0.0f},
+      {0x1.2p+2f, 20, true, false, 894, 895, 0.0f},
+      {0x1.8p+0f, 19, true, false, 896, 897, 0.0f},
+      {0.0f, 0, false, true, 890, 890, 0x1.6825eap-5f},
+      {0.0f, 0, false, true, 891, 891, -0x1.7663bcp-4f},
+      {0.0f, 0, false, true, 892, 892, -0x1.ed07bcp-5f},
+      {0.0f, 0, false, true, 893, 893, 0x1.90e478p-6f},
+      {0.0f, 0, false, true, 894, 894, -0x1.16a156p-4f},
+      {0.0f, 0, false, true, 895, 895, 0.0f},
+      {0.0f, 0, false, true, 896, 896, 0x1.e3e84ap-6f},
+      {0.0f, 0, false, true, 897, 897, -0x1.937886p-7f},
+      {0x1.3cdfbcp-1f, 1, true, false, 899, 900, 0.0f},
+      {0x1.e895f6p+0f, 2, true, false, 901, 902, 0.0f},
+      {0x1.188002p+1f, 17, true, false, 903, 904, 0.0f},
+      {0x1p-1f, 6, true, false, 905, 906, 0.0f},
+      {0x1.2p+2f, 20, true, false, 907, 908, 0.0f},
+      {0x1p-1f, 7, true, false, 909, 910, 0.0f},
+      {0x1p-1f, 12, true, false, 911, 912, 0.0f},
+      {0.0f, 0, false, true, 905, 905, 0x1.78246p-7f},
+      {0.0f, 0, false, true, 906, 906, 0x1.92cb7p-5f},
+      {0.0f, 0, false, true, 907, 907, -0x1.3d0088p-5f},
+      {0.0f, 0, false, true, 908, 908, 0x1.29e75cp-5f},
+      {0.0f, 0, false, true, 909, 909, -0x1.330ed8p-4f},
+      {0.0f, 0, false, true, 910, 910, 0x1.314fb8p-10f},
+      {0.0f, 0, false, true, 911, 911, -0x1.1061a8p-4f},
+      {0.0f, 0, false, true, 912, 912, 0x1.381492p-6f},
+      {0x1.941p+3f, 18, true, false, 914, 915, 0.0f},
+      {-0x1.59b45ap-2f, 1, true, false, 916, 917, 0.0f},
+      {0x1p-1f, 20, true, false, 918, 919, 0.0f},
+      {0x1p-1f, 7, true, false, 920, 921, 0.0f},
+      {0x1.81c002p+1f, 17, true, false, 922, 923, 0.0f},
+      {0.0f, 0, false, true, 918, 918, 0.0f},
+      {0x1.ce1fbcp+1f, 2, true, false, 924, 925, 0.0f},
+      {0.0f, 0, false, true, 920, 920, 0x1.5a5494p-7f},
+      {0.0f, 0, false, true, 921, 921, 0x1.13265ap-4f},
+      {0.0f, 0, false, true, 922, 922, -0x1.670a1cp-8f},
+      {0.0f, 0, false, true, 923, 923, 0x1.ddb478p-7f},
+      {0.0f, 0, false, true, 924, 924, -0x1.41ac4ap-4f},
+      {0.0f, 0, false, true, 925, 925, 0.0f},
+      {0x1.6f3468p+2f, 0, true, false, 927, 928, 0.0f},
+      {0x1.adb892p+2f, 3, true, false, 929, 930, 0.0f},
+      {0x1.d57866p-3f, 16, true, false, 931, 932, 0.0f},
+      {0x1p-1f, 7, true, false, 933, 934, 0.0f},
+      {0x1.44d5e6p+1f, 16, true, false, 935, 936, 0.0f},
+      {0x1.800004p-4f, 17, true, false, 937, 938, 0.0f},
+      {0x1.0e6364p+0f, 3, true, false, 939, 940, 0.0f},
+      {0.0f, 0, false, true, 933, 933, -0x1.5eedeap-8f},
+      {0.0f, 0, false, true, 934, 934, 0x1.9ac4cap-7f},
+      {0.0f, 0, false, true, 935, 935, -0x1.371a9cp-4f},
+      {0.0f, 0, false, true, 936, 936, 0.0f},
+      {0.0f, 0, false, true, 937, 937, 0.0f},
+      {0.0f, 0, false, true, 938, 938, -0x1.5a04dep-4f},
+      {0.0f, 0, false, true, 939, 939, -0x1.28d0f6p-8f},
+      {0.0f, 0, false, true, 940, 940, -0x1.442e0cp-5f},
+      {0x1.7e4efp+0f, 2, true, false, 942, 943, 0.0f},
+      {0x1.2p+1f, 17, true, false, 944, 945, 0.0f},
+      {0x1.2p+2f, 20, true, false, 946, 947, 0.0f},
+      {0x1p-1f, 7, true, false, 948, 949, 0.0f},
+      {0x1p-1f, 12, true, false, 950, 951, 0.0f},
+      {0x1p-1f, 10, true, false, 952, 953, 0.0f},
+      {0x1.dbf638p+1f, 1, true, false, 954, 955, 0.0f},
+      {0.0f, 0, false, true, 948, 948, -0x1.0973e6p-4f},
+      {0.0f, 0, false, true, 949, 949, 0x1.224f04p-7f},
+      {0.0f, 0, false, true, 950, 950, -0x1.9121p-5f},
+      {0.0f, 0, false, true, 951, 951, 0x1.d0b6bep-6f},
+      {0.0f, 0, false, true, 952, 952, -0x1.1baab8p-6f},
+      {0.0f, 0, false, true, 953, 953, -0x1.3ab46p-4f},
+      {0.0f, 0, false, true, 954, 954, 0x1.a47f6ep-6f},
+      {0.0f, 0, false, true, 955, 955, -0x1.123a12p-6f},
+      {0x1.927028p+0f, 0, true, false, 957, 958, 0.0f},
+      {0x1p-1f, 6, true, false, 959, 960, 0.0f},
+      {0x1.4368a4p+2f, 3, true, false, 961, 962, 0.0f},
+      {0x1.050002p+0f, 17, true, false, 963, 964, 0.0f},
+      {0x1p-1f, 7, true, false, 965, 966, 0.0f},
+      {0x1.e3cp+1f, 18, true, false, 967, 968, 0.0f},
+      {0x1.daf7bp+2f, 3, true, false, 969, 970, 0.0f},
+      {0.0f, 0, false, true, 963, 963, -0x1.2541f6p-4f},
+      {0.0f, 0, false, true, 964, 964, 0x1.d3ec58p-6f},
+      {0.0f, 0, false, true, 965, 965, 0.0f},
+      {0.0f, 0, false, true, 966, 966, 0x1.e99c3ep-5f},
+      {0.0f, 0, false, true, 967, 967, 0x1.a42cdap-8f},
+      {0.0f, 0, false, true, 968, 968, -0x1.4813bcp-7f},
+      {0.0f, 0, false, true, 969, 969, -0x1.0ccb1ap-5f},
+      {0.0f, 0, false, true, 970, 970, -0x1.50df18p-4f},
+      {0x1.1c4a32p+0f, 2, true, false, 972, 973, 0.0f},
+      {0x1.4bp-1f, 17, true, false, 974, 975, 0.0f},
+      {0x1.2p+2f, 20, true, false, 976, 977, 0.0f},
+      {0x1p-1f, 7, true, false, 978, 979, 0.0f},
+      {0x1.8p+0f, 19, true, false, 980, 981, 0.0f},
+      {0x1p-1f, 10, true, false, 982, 983, 0.0f},
+      {0x1.55a17p+0f, 16, true, false, 984, 985, 0.0f},
+      {0.0f, 0, false, true, 978, 978, -0x1.1af4f8p-4f},
+      {0.0f, 0, false, true, 979, 979, -0x1.947d16p-11f},
+      {0.0f, 0, false, true, 980, 980, 0x1.1db3dp-5f},
+      {0.0f, 0, false, true, 981, 981, 0x1.55d708p-8f},
+      {0.0f, 0, false, true, 982, 982, -0x1.65952ep-7f},
+      {0.0f, 0, false, true, 983, 983, -0x1.27b2aep-4f},
+      {0.0f, 0, false, true, 984, 984, 0x1.ed9278p-6f},
+      {0.0f, 0, false, true, 985, 985, -0x1.9c0c32p-7f},
+      {-0x1.928294p-1f, 1, true, false, 987, 988, 0.0f},
+      {0x1.0d7262p+1f, 2, true, false, 989, 990, 0.0f},
+      {0x1.1b8p+1f, 17, true, false, 991, 992, 0.0f},
+      {0x1.380002p-4f, 17, true, false, 993, 994, 0.0f},
+      {0x1.2p+2f, 4, true, false, 995, 996, 0.0f},
+      {0x1p-1f, 7, true, false, 997, 998, 0.0f},
+      {0x1p-1f, 14, true, false, 999, 1000, 0.0f},
+      {0.0f, 0, false, true, 993, 993, 0.0f},
+      {0.0f, 0, false, true, 994, 994, 0x1.04e5a8p-4f},
+      {0.0f, 0, false, true, 995, 995, -0x1.60fdf8p-8f},
+      {0.0f, 0, false, true, 996, 996, 0.0f},
+      {0.0f, 0, false, true, 997, 997, -0x1.fa20fap-5f},
+      {0.0f, 0, false, true, 998, 998, 0x1.a88246p-9f},
+      {0.0f, 0, false, true, 999, 999, 0x1.6ecc4ep-5f},
+      {0.0f, 0, false, true, 1000, 1000, -0x1.39fba8p-8f},
+      {0x1.85c5b8p+2f, 3, true, false, 1002, 1003, 0.0f},
+      {0x1.37c394p+0f, 1, true, false, 1004, 1005, 0.0f},
+      {0x1.2b6128p+1f, 16, true, false, 1006, 1007, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1008, 1009, 0.0f},
+      {0x1.137002p+2f, 17, true, false, 1010, 1011, 0.0f},
+      {0x1.6p+2f, 4, true, false, 1012, 1013, 0.0f},
+      {0x1.bbdffcp+1f, 17, true, false, 1014, 1015, 0.0f},
+      {0.0f, 0, false, true, 1008, 1008, 0x1.f93f32p-12f},
+      {0.0f, 0, false, true, 1009, 1009, 0x1.27b636p-5f},
+      {0.0f, 0, false, true, 1010, 1010, -0x1.3afbd4p-8f},
+      {0.0f, 0, false, true, 1011, 1011, 0x1.6d383ep-6f},
+      {0.0f, 0, false, true, 1012, 1012, -0x1.38a0fcp-4f},
+      {0.0f, 0, false, true, 1013, 1013, 0.0f},
+      {0.0f, 0, false, true, 1014, 1014, 0.0f},
+      {0.0f, 0, false, true, 1015, 1015, -0x1.244f5ep-8f},
+      {0x1.8b53cep+2f, 1, true, false, 1017, 1018, 0.0f},
+      {0x1.8ae878p+2f, 3, true, false, 1019, 1020, 0.0f},
+      {0x1.4d4a34p-1f, 3, true, false, 1021, 1022, 0.0f},
+      {0x1.75a3d2p+1f, 16, true, false, 1023, 1024, 0.0f},
+      {0x1.2c7fccp+1f, 16, true, false, 1025, 1026, 0.0f},
+      {0x1.098p+1f, 17, true, false, 1027, 1028, 0.0f},
+      {0x1.fep-2f, 18, true, false, 1029, 1030, 0.0f},
+      {0.0f, 0, false, true, 1023, 1023, 0x1.bc9e9ep-10f},
+      {0.0f, 0, false, true, 1024, 1024, 0x1.2dbeep-4f},
+      {0.0f, 0, false, true, 1025, 1025, -0x1.205a7cp-4f},
+      {0.0f, 0, false, true, 1026, 1026, 0.0f},
+      {0.0f, 0, false, true, 1027, 1027, -0x1.940d2cp-6f},
+      {0.0f, 0, false, true, 1028, 1028, 0x1.9c8db2p-8f},
+      {0.0f, 0, false, true, 1029, 1029, 0.0f},
+      {0.0f, 0, false, true, 1030, 1030, -0x1.ad85cep-5f},
+      {0x1.47a0ecp+0f, 0, true, false, 1032, 1033, 0.0f},
+      {0x1.aa0002p-1f, 17, true, false, 1034, 1035, 0.0f},
+      {0x1p-1f, 5, true, false, 1036, 1037, 0.0f},
+      {0x1p-1f, 6, true, false, 1038, 1039, 0.0f},
+      {0x1.9a4p+0f, 17, true, false, 1040, 1041, 0.0f},
+      {0x1p-1f, 9, true, false, 1042, 1043, 0.0f},
+      {0x1.cb2p+1f, 17, true, false, 1044, 1045, 0.0f},
+      {0.0f, 0, false, true, 1038, 1038, -0x1.7fb70cp-5f},
+      {0.0f, 0, false, true, 1039, 1039, 0x1.c944eep-7f},
+      {0.0f, 0, false, true, 1040, 1040, 0x1.5b1ec4p-4f},
+      {0.0f, 0, false, true, 1041, 1041, 0x1.f718f8p-7f},
+      {0.0f, 0, false, true, 1042, 1042, -0x1.5361bp-9f},
+      {0.0f, 0, false, true, 1043, 1043, 0x1.333eccp-4f},
+      {0.0f, 0, false, true, 1044, 1044, -0x1.69df3p-7f},
+      {0.0f, 0, false, true, 1045, 1045, 0x1.03ed06p-6f},
+      {0x1.835534p+0f, 2, true, false, 1047, 1048, 0.0f},
+      {0x1.72p-1f, 17, true, false, 1049, 1050, 0.0f},
+      {0x1.33a90cp+1f, 0, true, false, 1051, 1052, 0.0f},
+      {0x1p-1f, 6, true, false, 1053, 1054, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1055, 1056, 0.0f},
+      {0x1p-1f, 7, true, false, 1057, 1058, 0.0f},
+      {0x1.a850d4p+1f, 2, true, false, 1059, 1060, 0.0f},
+      {0.0f, 0, false, true, 1053, 1053, -0x1.4f2376p-4f},
+      {0.0f, 0, false, true, 1054, 1054, -0x1.fe383ap-10f},
+      {0.0f, 0, false, true, 1055, 1055, 0x1.e1c886p-6f},
+      {0.0f, 0, false, true, 1056, 1056, 0x1.07e8f6p-9f},
+      {0.0f, 0, false, true, 1057, 1057, -0x1.326c56p-6f},
+      {0.0f, 0, false, true, 1058, 1058, 0x1.1b5c24p-5f},
+      {0.0f, 0, false, true, 1059, 1059, -0x1.87ecap-7f},
+      {0.0f, 0, false, true, 1060, 1060, -0x1.5fb51ep-5f},
+      {0x1.14d6d4p-1f, 3, true, false, 1062, 1063, 0.0f},
+      {0x1p-1f, 5, true, false, 1064, 1065, 0.0f},
+      {0x1.22ap+2f, 18, true, false, 1066, 1067, 0.0f},
+      {0x1p-1f, 8, true, false, 1068, 1069, 0.0f},
+      {0x1.c8c24p+0f, 16, true, false, 1070, 1071, 0.0f},
+      {0x1.1ac004p+1f, 17, true, false, 1072, 1073, 0.0f},
+      {0x1.97dp+3f, 18, true, false, 1074, 1075, 0.0f},
+      {0.0f, 0, false, true, 1068, 1068, 0x1.2e4b62p-6f},
+      {0.0f, 0, false, true, 1069, 1069, 0x1.5e6b98p-4f},
+      {0.0f, 0, false, true, 1070, 1070, 0x1.9ba0b2p-6f},
+      {0.0f, 0, false, true, 1071, 1071, 0.0f},
+      {0.0f, 0, false, true, 1072, 1072, -0x1.73cd5p-9f},
+      {0.0f, 0, false, true, 1073, 1073, 0x1.d2689cp-7f},
+      {0.0f, 0, false, true, 1074, 1074, -0x1.408144p-7f},
+      {0.0f, 0, false, true, 1075, 1075, -0x1.00a554p-4f},
+      {0x1.86a668p+2f, 0, true, false, 1077, 1078, 0.0f},
+      {0x1.43a3b4p+1f, 2, true, false, 1079, 1080, 0.0f},
+      {0x1.008p+1f, 17, true, false, 1081, 1082, 0.0f},
+      {0x1.0f7p+2f, 17, true, false, 1083, 1084, 0.0f},
+      {0x1.97c1c2p+0f, 16, true, false, 1085, 1086, 0.0f},
+      {0x1.6ad96ap-2f, 3, true, false, 1087, 1088, 0.0f},
+      {0x1.13630cp+0f, 3, true, false, 1089, 1090, 0.0f},
+      {0.0f, 0, false, true, 1083, 1083, -0x1.40d686p-11f},
+      {0.0f, 0, false, true, 1084, 1084, 0x1.dee964p-6f},
+      {0.0f, 0, false, true, 1085, 1085, -0x1.8216bep-5f},
+      {0.0f, 0, false, true, 1086, 1086, -0x1.4aaf68p-7f},
+      {0.0f, 0, false, true, 1087, 1087, 0.0f},
+      {0.0f, 0, false, true, 1088, 1088, -0x1.b6bd24p-5f},
+      {0.0f, 0, false, true, 1089, 1089, 0x1.dc9764p-11f},
+      {0.0f, 0, false, true, 1090, 1090, -0x1.015996p-5f},
+      {0x1.17e3ep+0f, 1, true, false, 1092, 1093, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1094, 1095, 0.0f},
+      {0x1p-1f, 5, true, false, 1096, 1097, 0.0f},
+      {0x1.7406b8p+1f, 16, true, false, 1098, 1099, 0.0f},
+      {0x1.03aa0cp+1f, 16, true, false, 1100, 1101, 0.0f},
+      {0x1p-1f, 9, true, false, 1102, 1103, 0.0f},
+      {0x1.81p+1f, 17, true, false, 1104, 1105, 0.0f},
+      {0.0f, 0, false, true, 1098, 1098, -0x1.cbc7dp-8f},
+      {0.0f, 0, false, true, 1099, 1099, 0x1.c2b888p-4f},
+      {0.0f, 0, false, true, 1100, 1100, 0x1.11712ep-4f},
+      {0.0f, 0, false, true, 1101, 1101, 0x1.4ea838p-8f},
+      {0.0f, 0, false, true, 1102, 1102, -0x1.778306p-9f},
+      {0.0f, 0, false, true, 1103, 1103, 0x1.190ad4p-4f},
+      {0.0f, 0, false, true, 1104, 1104, -0x1.772b64p-7f},
+      {0.0f, 0, false, true, 1105, 1105, 0x1.410decp-7f},
+      {0x1.617p+3f, 18, true, false, 1107, 1108, 0.0f},
+      {0x1.cffffep-1f, 17, true, false, 1109, 1110, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1111, 1112, 0.0f},
+      {0x1p-1f, 7, true, false, 1113, 1114, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1115, 1116, 0.0f},
+      {0x1.7be32p+1f, 2, true, false, 1117, 1118, 0.0f},
+      {0x1.4b4c1p+1f, 0, true, false, 1119, 1120, 0.0f},
+      {0.0f, 0, false, true, 1113, 1113, -0x1.f7856ep-5f},
+      {0.0f, 0, false, true, 1114, 1114, 0.0f},
+      {0.0f, 0, false, true, 1115, 1115, 0x1.083388p-5f},
+      {0.0f, 0, false, true, 1116, 1116, -0x1.4e5be6p-10f},
+      {0.0f, 0, false, true, 1117, 1117, -0x1.c326cep-5f},
+      {0.0f, 0, false, true, 1118, 1118, 0.0f},
+      {0.0f, 0, false, true, 1119, 1119, 0x1.d254ap-6f},
+      {0.0f, 0, false, true, 1120, 1120, -0x1.d0d028p-7f},
+      {0x1.4851d4p+1f, 2, true, false, 1122, 1123, 0.0f},
+      {0x1.923p+3f, 18, true, false, 1124, 1125, 0.0f},
+      {0x1.65ddap+1f, 16, true, false, 1126, 1127, 0.0f},
+      {0x1.7a505cp-1f, 0, true, false, 1128, 1129, 0.0f},
+      {0x1.6p+2f, 4, true, false, 1130, 1131, 0.0f},
+      {0x1.3b6acap+0f, 16, true, false, 1132, 1133, 0.0f},
+      {0x1.68827cp+1f, 2, true, false, 1134, 1135, 0.0f},
+      {0.0f, 0, false, true, 1128, 1128, 0x1.8285fep-5f},
+      {0.0f, 0, false, true, 1129, 1129, 0x1.bbacdep-11f},
+      {0.0f, 0, false, true, 1130, 1130, -0x1.fd1a9cp-5f},
+      {0.0f, 0, false, true, 1131, 1131, 0.0f},
+      {0.0f, 0, false, true, 1132, 1132, -0x1.bba6ccp-5f},
+      {0.0f, 0, false, true, 1133, 1133, -0x1.42ee5cp-6f},
+      {0.0f, 0, false, true, 1134, 1134, 0.0f},
+      {0.0f, 0, false, true, 1135, 1135, 0x1.149d3ep-4f},
+      {0x1.08a3f2p-1f, 3, true, false, 1137, 1138, 0.0f},
+      {0x1p-1f, 5, true, false, 1139, 1140, 0.0f},
+      {0x1.136p+1f, 17, true, false, 1141, 1142, 0.0f},
+      {0x1p-1f, 8, true, false, 1143, 1144, 0.0f},
+      {0x1.ba1248p+0f, 16, true, false, 1145, 1146, 0.0f},
+      {0x1.4p+1f, 20, true, false, 1147, 1148, 0.0f},
+      {0x1p-1f, 12, true, false, 1149, 1150, 0.0f},
+      {0.0f, 0, false, true, 1143, 1143, 0x1.d41318p-7f},
+      {0.0f, 0, false, true, 1144, 1144, 0x1.650722p-4f},
+      {0.0f, 0, false, true, 1145, 1145, 0x1.63e746p-6f},
+      {0.0f, 0, false, true, 1146, 1146, -0x1.b49938p-8f},
+      {0.0f, 0, false, true, 1147, 1147, -0x1.050866p-4f},
+      {0.0f, 0, false, true, 1148, 1148, -0x1.2b701ap-9f},
+      {0.0f, 0, false, true, 1149, 1149, -0x1.e76966p-5f},
+      {0.0f, 0, false, true, 1150, 1150, 0x1.9b4468p-7f},
+      {0x1.da4be6p+2f, 3, true, false, 1152, 1153, 0.0f},
+      {0x1.8ddef4p+2f, 0, true, false, 1154, 1155, 0.0f},
+      {0x1.605552p+1f, 16, true, false, 1156, 1157, 0.0f},
+      {0x1.e02798p-1f, 2, true, false, 1158, 1159, 0.0f},
+      {0x1.83e6a8p-3f, 3, true, false, 1160, 1161, 0.0f},
+      {0x1p-1f, 20, true, false, 1162, 1163, 0.0f},
+      {0.0f, 0, false, true, 1157, 1157, 0.0f},
+      {0.0f, 0, false, true, 1158, 1158, 0x1.28b51ap-7f},
+      {0.0f, 0, false, true, 1159, 1159, -0x1.280b5cp-8f},
+      {0.0f, 0, false, true, 1160, 1160, 0.0f},
+      {0.0f, 0, false, true, 1161, 1161, -0x1.3c892ep-5f},
+      {0.0f, 0, false, true, 1162, 1162, 0.0f},
+      {0.0f, 0, false, true, 1163, 1163, -0x1.592eb6p-4f},
+      {0x1.a38c74p-1f, 2, true, false, 1165, 1166, 0.0f},
+      {0x1.098002p+0f, 17, true, false, 1167, 1168, 0.0f},
+      {0x1.6p+2f, 4, true, false, 1169, 1170, 0.0f},
+      {0x1p-1f, 6, true, false, 1171, 1172, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1173, 1174, 0.0f},
+      {0x1.00ee54p+0f, 16, true, false, 1175, 1176, 0.0f},
+      {0x1.19904cp+1f, 16, true, false, 1177, 1178, 0.0f},
+      {0.0f, 0, false, true, 1171, 1171, -0x1.376308p-4f},
+      {0.0f, 0, false, true, 1172, 1172, -0x1.4cbca8p-9f},
+      {0.0f, 0, false, true, 1173, 1173, 0x1.42287p-5f},
+      {0.0f, 0, false, true, 1174, 1174, 0x1.e0b872p-8f},
+      {0.0f, 0, false, true, 1175, 1175, -0x1.1315cap-5f},
+      {0.0f, 0, false, true, 1176, 1176, -0x1.ae80e2p-9f},
+      {0.0f, 0, false, true, 1177, 1177, 0x1.467a22p-6f},
+      {0.0f, 0, false, true, 1178, 1178, -0x1.0f7f16p-5f},
+      {0x1.6dap+2f, 18, true, false, 1180, 1181, 0.0f},
+      {0x1p-1f, 5, true, false, 1182, 1183, 0.0f},
+      {0x1.2p+2f, 20, true, false, 1184, 1185, 0.0f},
+      {0x1p-1f, 9, true, false, 1186, 1187, 0.0f},
+      {0x1.03943cp+0f, 1, true, false, 1188, 1189, 0.0f},
+      {0x1p-1f, 10, true, false, 1190, 1191, 0.0f},
+      {0x1.654e5p+0f, 16, true, false, 1192, 1193, 0.0f},
+      {0.0f, 0, false, true, 1186, 1186, 0x1.284a32p-8f},
+      {0.0f, 0, false, true, 1187, 1187, 0x1.056f34p-4f},
+      {0.0f, 0, false, true, 1188, 1188, 0x1.abb092p-6f},
+      {0.0f, 0, false, true, 1189, 1189, -0x1.efcf6cp-10f},
+      {0.0f, 0, false, true, 1190, 1190, -0x1.ce61dep-7f},
+      {0.0f, 0, false, true, 1191, 1191, -0x1.208c6p-4f},
+      {0.0f, 0, false, true, 1192, 1192, 0x1.4528eep-5f},
+      {0.0f, 0, false, true, 1193, 1193, -0x1.eea264p-8f},
+      {0x1.49fffcp+2f, 0, true, false, 1195, 1196, 0.0f},
+      {0x1.517b3p-2f, 16, true, false, 1197, 1198, 0.0f},
+      {0x1.48c98cp-3f, 16, true, false, 1199, 1200, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1201, 1202, 0.0f},
+      {0x1.8p+0f, 20, true, false, 1203, 1204, 0.0f},
+      {0x1p-1f, 20, true, false, 1205, 1206, 0.0f},
+      {0x1.e33c54p+0f, 16, true, false, 1207, 1208, 0.0f},
+      {0.0f, 0, false, true, 1201, 1201, -0x1.0f7a02p-4f},
+      {0.0f, 0, false, true, 1202, 1202, 0x1.0f8f28p-4f},
+      {0.0f, 0, false, true, 1203, 1203, 0x1.c11a14p-7f},
+      {0.0f, 0, false, true, 1204, 1204, -0x1.28ac34p-8f},
+      {0.0f, 0, false, true, 1205, 1205, 0.0f},
+      {0.0f, 0, false, true, 1206, 1206, -0x1.85848p-4f},
+      {0.0f, 0, false, true, 1207, 1207, -0x1.98f83ep-9f},
+      {0.0f, 0, false, true, 1208, 1208, -0x1.30e9c2p-5f},
+      {0x1p-1f, 7, true, false, 1210, 1211, 0.0f},
+      {0x1p-1f, 12, true, false, 1212, 1213, 0.0f},
+      {0x1p-1f, 6, true, false, 1214, 1215, 0.0f},
+      {0x1p-1f, 5, true, false, 1216, 1217, 0.0f},
+      {0x1p-1f, 13, true, false, 1218, 1219, 0.0f},
+      {0x1.2p+2f, 20, true, false, 1220, 1221, 0.0f},
+      {0x1p-1f, 13, true, false, 1222, 1223, 0.0f},
+      {0.0f, 0, false, true, 1216, 1216, 0x1.194214p-4f},
+      {0.0f, 0, false, true, 1217, 1217, -0x1.15814ap-4f},
+      {0.0f, 0, false, true, 1218, 1218, -0x1.630e8ep-5f},
+      {0.0f, 0, false, true, 1219, 1219, 0x1.2c01f8p-6f},
+      {0.0f, 0, false, true, 1220, 1220, -0x1.e45adp-5f},
+      {0.0f, 0, false, true, 1221, 1221, 0.0f},
+      {0.0f, 0, false, true, 1222, 1222, 0x1.447912p-6f},
+      {0.0f, 0, false, true, 1223, 1223, -0x1.a77e1cp-6f},
+      {-0x1.1aa532p-1f, 1, true, false, 1225, 1226, 0.0f},
+      {0x1.b4bffep+0f, 17, true, false, 1227, 1228, 0.0f},
+      {0x1.944d08p+2f, 0, true, false, 1229, 1230, 0.0f},
+      {0x1p-1f, 6, true, false, 1231, 1232, 0.0f},
+      {0x1.2ap+1f, 17, true, false, 1233, 1234, 0.0f},
+      {0x1p-1f, 7, true, false, 1235, 1236, 0.0f},
+      {0x1.c22f54p-3f, 3, true, false, 1237, 1238, 0.0f},
+      {0.0f, 0, false, true, 1231, 1231, 0.0f},
+      {0.0f, 0, false, true, 1232, 1232, 0x1.f6a402p-5f},
+      {0.0f, 0, false, true, 1233, 1233, -0x1.467454p-5f},
+      {0.0f, 0, false, true, 1234, 1234, 0x1.bcf2f4p-6f},
+      {0.0f, 0, false, true, 1235, 1235, -0x1.95c60ap-8f},
+      {0.0f, 0, false, true, 1236, 1236, 0x1.4119aap-8f},
+      {0.0f, 0, false, true, 1237, 1237, 0.0f},
+      {0.0f, 0, false, true, 1238, 1238, -0x1.4aa686p-5f},
+      {0x1.146p+1f, 17, true, false, 1240, 1241, 0.0f},
+      {0x1p-1f, 7, true, false, 1242, 1243, 0.0f},
+      {0x1p-1f, 12, true, false, 1244, 1245, 0.0f},
+      {0x1p-1f, 5, true, false, 1246, 1247, 0.0f},
+      {0x1p-1f, 6, true, false, 1248, 1249, 0.0f},
+      {0x1p-1f, 5, true, false, 1250, 1251, 0.0f},
+      {0x1.cp+1f, 19, true, false, 1252, 1253, 0.0f},
+      {0.0f, 0, false, true, 1246, 1246, 0x1.1c2a56p-4f},
+      {0.0f, 0, false, true, 1247, 1247, -0x1.e4f504p-5f},
+      {0.0f, 0, false, true, 1248, 1248, -0x1.62250ap-5f},
+      {0.0f, 0, false, true, 1249, 1249, 0x1.b314cap-8f},
+      {0.0f, 0, false, true, 1250, 1250, 0x1.1a4ed8p-5f},
+      {0.0f, 0, false, true, 1251, 1251, -0x1.c7ebd6p-5f},
+      {0.0f, 0, false, true, 1252, 1252, 0x1.45c2b2p-5f},
+      {0.0f, 0, false, true, 1253, 1253, -0x1.0e05eap-11f},
+      {0x1.5d65d8p+0f, 2, true, false, 1255, 1256, 0.0f},
+      {0x1.050004p+1f, 17, true, false, 1257, 1258, 0.0f},
+      {0x1p-1f, 8, true, false, 1259, 1260, 0.0f},
+      {0x1.4p+1f, 20, true, false, 1261, 1262, 0.0f},
+      {0x1p-1f, 14, true, false, 1263, 1264, 0.0f},
+      {0x1.0bc002p+1f, 17, true, false, 1265, 1266, 0.0f},
+      {0x1p-1f, 5, true, false, 1267, 1268, 0.0f},
+      {0.0f, 0, false, true, 1261, 1261, -0x1.ac8c44p-5f},
+      {0.0f, 0, false, true, 1262, 1262, 0x1.80a65cp-8f},
+      {0.0f, 0, false, true, 1263, 1263, 0x1.2f394ep-5f},
+      {0.0f, 0, false, true, 1264, 1264, 0x1.9c65fep-10f},
+      {0.0f, 0, false, true, 1265, 1265, -0x1.4fa04cp-5f},
+      {0.0f, 0, false, true, 1266, 1266, -0x1.e66aaep-9f},
+      {0.0f, 0, false, true, 1267, 1267, 0x1.3fb364p-5f},
+      {0.0f, 0, false, true, 1268, 1268, 0x1.8bc95ap-12f},
+      {0x1.22d9bp-5f, 16, true, false, 1270, 1271, 0.0f},
+      {0x1.a392bp+1f, 0, true, false, 1272, 1273, 0.0f},
+      {0x1.090004p+0f, 17, true, false, 1274, 1275, 0.0f},
+      {0.0f, 0, false, true, 1272, 1272, 0.0f},
+      {0.0f, 0, false, true, 1273, 1273, -0x1.e19cd8p-4f},
+      {0x1.b08bc2p+1f, 1, true, false, 1276, 1277, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1278, 1279, 0.0f},
+      {0.0f, 0, false, true, 1276, 1276, 0x1.a4b7dep-8f},
+      {0.0f, 0, false, true, 1277, 1277, -0x1.950326p-6f},
+      {0.0f, 0, false, true, 1278, 1278, 0x1.03bd1p-5f},
+      {0.0f, 0, false, true, 1279, 1279, -0x1.947f36p-11f},
+      {0x1.2d516p+2f, 3, true, false, 1281, 1282, 0.0f},
+      {0x1.7b755p+2f, 0, true, false, 1283, 1284, 0.0f},
+      {0x1.45ec1ap+1f, 16, true, false, 1285, 1286, 0.0f},
+      {0x1.545714p-4f, 2, true, false, 1287, 1288, 0.0f},
+      {0x1.789a8ep+0f, 16, true, false, 1289, 1290, 0.0f},
+      {0x1p-1f, 20, true, false, 1291, 1292, 0.0f},
+      {0x1.61ef08p+1f, 0, true, false, 1293, 1294, 0.0f},
+      {0.0f, 0, false, true, 1287, 1287, 0x1.f073dep-7f},
+      {0.0f, 0, false, true, 1288, 1288, -0x1.1ba094p-10f},
+      {0.0f, 0, false, true, 1289, 1289, -0x1.e7bd4cp-7f},
+      {0.0f, 0, false, true, 1290, 1290, -0x1.cc0f96p-5f},
+      {0.0f, 0, false, true, 1291, 1291, 0.0f},
+      {0.0f, 0, false, true, 1292, 1292, -0x1.915d5ap-5f},
+      {0.0f, 0, false, true, 1293, 1293, 0x1.24f91ep-5f},
+      {0.0f, 0, false, true, 1294, 1294, -0x1.f8d792p-8f},
+      {-0x1.40540cp-1f, 2, true, false, 1296, 1297, 0.0f},
+      {0x1.f2c004p+0f, 17, true, false, 1298, 1299, 0.0f},
+      {0x1.bd5724p+1f, 2, true, false, 1300, 1301, 0.0f},
+      {0x1p-1f, 7, true, false, 1302, 1303, 0.0f},
+      {0x1p-1f, 15, true, false, 1304, 1305, 0.0f},
+      {0x1.99f538p-1f, 3, true, false, 1306, 1307, 0.0f},
+      {0x1.43fp+2f, 17, true, false, 1308, 1309, 0.0f},
+      {0.0f, 0, false, true, 1302, 1302, -0x1.62ae94p-5f},
+      {0.0f, 0, false, true, 1303, 1303, 0x1.1d5686p-6f},
+      {0.0f, 0, false, true, 1304, 1304, 0x1.c30264p-5f},
+      {0.0f, 0, false, true, 1305, 1305, -0x1.5da5bcp-8f},
+      {0.0f, 0, false, true, 1306, 1306, 0x1.9a888ep-8f},
+      {0.0f, 0, false, true, 1307, 1307, -0x1.164ddcp-8f},
+      {0.0f, 0, false, true, 1308, 1308, -0x1.6c2f8ep-5f},
+      {0.0f, 0, false, true, 1309, 1309, 0.0f},
+      {0x1.018p+0f, 17, true, false, 1311, 1312, 0.0f},
+      {0x1p-1f, 6, true, false, 1313, 1314, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1315, 1316, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1317, 1318, 0.0f},
+      {0x1p-1f, 7, true, false, 1319, 1320, 0.0f},
+      {0x1.c10d88p-1f, 16, true, false, 1321, 1322, 0.0f},
+      {0x1p-1f, 12, true, false, 1323, 1324, 0.0f},
+      {0.0f, 0, false, true, 1317, 1317, -0x1.3de17ep-4f},
+      {0.0f, 0, false, true, 1318, 1318, 0x1.3e542cp-6f},
+      {0.0f, 0, false, true, 1319, 1319, -0x1.77ce4cp-5f},
+      {0.0f, 0, false, true, 1320, 1320, 0x1.093b2ep-8f},
+      {0.0f, 0, false, true, 1321, 1321, 0.0f},
+      {0.0f, 0, false, true, 1322, 1322, 0x1.38b6d4p-5f},
+      {0.0f, 0, false, true, 1323, 1323, -0x1.87bcd6p-5f},
+      {0.0f, 0, false, true, 1324, 1324, 0x1.4db238p-10f},
+      {0x1p-1f, 15, true, false, 1326, 1327, 0.0f},
+      {0x1.82cp+1f, 17, true, false, 1328, 1329, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1330, 1331, 0.0f},
+      {0x1p-1f, 13, true, false, 1332, 1333, 0.0f},
+      {0x1p-1f, 14, true, false, 1334, 1335, 0.0f},
+      {0x1.3b8414p+1f, 16, true, false, 1336, 1337, 0.0f},
+      {0x1.3e15a8p+1f, 16, true, false, 1338, 1339, 0.0f},
+      {0.0f, 0, false, true, 1332, 1332, 0x1.43fb5ap-8f},
+      {0.0f, 0, false, true, 1333, 1333, -0x1.767ea2p-6f},
+      {0.0f, 0, false, true, 1334, 1334, 0x1.9fa08ap-4f},
+      {0.0f, 0, false, true, 1335, 1335, 0x1.5bcdb8p-11f},
+      {0.0f, 0, false, true, 1336, 1336, -0x1.437bbp-4f},
+      {0.0f, 0, false, true, 1337, 1337, 0.0f},
+      {0.0f, 0, false, true, 1338, 1338, 0x1.aa3706p-8f},
+      {0.0f, 0, false, true, 1339, 1339, -0x1.56c6c8p-6f},
+      {0x1.3a08b4p-5f, 16, true, false, 1341, 1342, 0.0f},
+      {0x1.8ee86cp+1f, 0, true, false, 1343, 1344, 0.0f},
+      {-0x1.310108p-2f, 2, true, false, 1345, 1346, 0.0f},
+      {0.0f, 0, false, true, 1343, 1343, 0.0f},
+      {0.0f, 0, false, true, 1344, 1344, -0x1.c797a6p-4f},
+      {0x1.f2fffcp+0f, 17, true, false, 1347, 1348, 0.0f},
+      {0x1.921dacp+2f, 3, true, false, 1349, 1350, 0.0f},
+      {0.0f, 0, false, true, 1347, 1347, -0x1.7406fcp-8f},
+      {0.0f, 0, false, true, 1348, 1348, 0x1.2b4432p-5f},
+      {0.0f, 0, false, true, 1349, 1349, -0x1.55fc26p-10f},
+      {0.0f, 0, false, true, 1350, 1350, -0x1.7a713ep-5f},
+      {0x1.7579a8p+1f, 16, true, false, 1352, 1353, 0.0f},
+      {0x1.23p+1f, 17, true, false, 1354, 1355, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1356, 1357, 0.0f},
+      {0x1p-1f, 7, true, false, 1358, 1359, 0.0f},
+      {0x1p-1f, 12, true, false, 1360, 1361, 0.0f},
+      {0x1.784de2p+0f, 3, true, false, 1362, 1363, 0.0f},
+      {0x1.02986p+0f, 3, true, false, 1364, 1365, 0.0f},
+      {0.0f, 0, false, true, 1358, 1358, -0x1.4acafep-5f},
+      {0.0f, 0, false, true, 1359, 1359, 0x1.261d3cp-12f},
+      {0.0f, 0, false, true, 1360, 1360, -0x1.45b67ap-5f},
+      {0.0f, 0, false, true, 1361, 1361, 0x1.648cbp-7f},
+      {0.0f, 0, false, true, 1362, 1362, 0x1.8df232p-5f},
+      {0.0f, 0, false, true, 1363, 1363, 0x1.642966p-3f},
+      {0.0f, 0, false, true, 1364, 1364, -0x1.676e96p-5f},
+      {0.0f, 0, false, true, 1365, 1365, 0x1.553334p-7f},
+      {0x1.230002p+1f, 17, true, false, 1367, 1368, 0.0f},
+      {0x1p-1f, 7, true, false, 1369, 1370, 0.0f},
+      {0x1p-1f, 15, true, false, 1371, 1372, 0.0f},
+      {0x1p-1f, 5, true, false, 1373, 1374, 0.0f},
+      {0x1p-1f, 6, true, false, 1375, 1376, 0.0f},
+      {0x1p-1f, 12, true, false, 1377, 1378, 0.0f},
+      {0x1p-1f, 13, true, false, 1379, 1380, 0.0f},
+      {0.0f, 0, false, true, 1373, 1373, 0x1.b2b934p-5f},
+      {0.0f, 0, false, true, 1374, 1374, -0x1.878cb4p-5f},
+      {0.0f, 0, false, true, 1375, 1375, -0x1.12a6a4p-5f},
+      {0.0f, 0, false, true, 1376, 1376, 0x1.4e99f2p-8f},
+      {0.0f, 0, false, true, 1377, 1377, -0x1.7c7d92p-5f},
+      {0.0f, 0, false, true, 1378, 1378, 0x1.1650f8p-5f},
+      {0.0f, 0, false, true, 1379, 1379, -0x1.4114f8p-4f},
+      {0.0f, 0, false, true, 1380, 1380, 0x1.020ef6p-11f},
+      {0x1.235058p-1f, 2, true, false, 1382, 1383, 0.0f},
+      {0x1.fc8p+0f, 17, true, false, 1384, 1385, 0.0f},
+      {0x1p-1f, 8, true, false, 1386, 1387, 0.0f},
+      {0x1.4p+1f, 20, true, false, 1388, 1389, 0.0f},
+      {0x1p-1f, 15, true, false, 1390, 1391, 0.0f},
+      {0x1p-1f, 10, true, false, 1392, 1393, 0.0f},
+      {0x1p-1f, 5, true, false, 1394, 1395, 0.0f},
+      {0.0f, 0, false, true, 1388, 1388, -0x1.67837cp-5f},
+      {0.0f, 0, false, true, 1389, 1389, 0x1.1bf448p-9f},
+      {0.0f, 0, false, true, 1390, 1390, 0x1.203614p-5f},
+      {0.0f, 0, false, true, 1391, 1391, -0x1.3304c2p-9f},
+      {0.0f, 0, false, true, 1392, 1392, -0x1.8a466cp-8f},
+      {0.0f, 0, false, true, 1393, 1393, -0x1.25c058p-4f},
+      {0.0f, 0, false, true, 1394, 1394, 0x1.27a17p-5f},
+      {0.0f, 0, false, true, 1395, 1395, -0x1.8a739ep-11f},
+      {0x1.74ea58p+1f, 16, true, false, 1397, 1398, 0.0f},
+      {0x1p-1f, 8, true, false, 1399, 1400, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1401, 1402, 0.0f},
+      {0x1.f9fffep+0f, 17, true, false, 1403, 1404, 0.0f},
+      {0x1.4p+1f, 20, true, false, 1405, 1406, 0.0f},
+      {0x1.e42a38p+1f, 1, true, false, 1407, 1408, 0.0f},
+      {0x1.f049ep-1f, 3, true, false, 1409, 1410, 0.0f},
+      {0.0f, 0, false, true, 1403, 1403, -0x1.9b0eb6p-6f},
+      {0.0f, 0, false, true, 1404, 1404, 0x1.516ef8p-10f},
+      {0.0f, 0, false, true, 1405, 1405, 0x1.dded1ap-3f},
+      {0.0f, 0, false, true, 1406, 1406, 0x1.6c379ep-8f},
+      {0.0f, 0, false, true, 1407, 1407, 0x1.bdaa72p-4f},
+      {0.0f, 0, false, true, 1408, 1408, 0.0f},
+      {0.0f, 0, false, true, 1409, 1409, -0x1.d737d8p-5f},
+      {0.0f, 0, false, true, 1410, 1410, 0.0f},
+      {0x1.dab42ap+2f, 3, true, false, 1412, 1413, 0.0f},
+      {-0x1.901cccp-1f, 1, true, false, 1414, 1415, 0.0f},
+      {0x1.68a1c8p+1f, 16, true, false, 1416, 1417, 0.0f},
+      {0x1.74bffcp+0f, 17, true, false, 1418, 1419, 0.0f},
+      {0x1.92b76cp+2f, 0, true, false, 1420, 1421, 0.0f},
+      {-0x1.d2e52p-2f, 2, true, false, 1422, 1423, 0.0f},
+      {0.0f, 0, false, true, 1417, 1417, 0.0f},
+      {0.0f, 0, false, true, 1418, 1418, 0x1.c665acp-5f},
+      {0.0f, 0, false, true, 1419, 1419, 0.0f},
+      {0.0f, 0, false, true, 1420, 1420, 0x1.ad6c84p-10f},
+      {0.0f, 0, false, true, 1421, 1421, -0x1.a173dap-6f},
+      {0.0f, 0, false, true, 1422, 1422, 0.0f},
+      {0.0f, 0, false, true, 1423, 1423, -0x1.1d8bbp-4f},
+      {-0x1.eccda4p-2f, 1, true, false, 1425, 1426, 0.0f},
+      {0x1.3224ccp+1f, 3, true, false, 1427, 1428, 0.0f},
+      {0x1.118002p+1f, 17, true, false, 1429, 1430, 0.0f},
+      {0x1.5dp-2f, 17, true, false, 1431, 1432, 0.0f},
+      {0x1p-1f, 5, true, false, 1433, 1434, 0.0f},
+      {0x1p-1f, 7, true, false, 1435, 1436, 0.0f},
+      {0x1p-1f, 14, true, false, 1437, 1438, 0.0f},
+      {0.0f, 0, false, true, 1431, 1431, 0.0f},
+      {0.0f, 0, false, true, 1432, 1432, 0x1.7efb5ep-5f},
+      {0.0f, 0, false, true, 1433, 1433, -0x1.4a094p-5f},
+      {0.0f, 0, false, true, 1434, 1434, 0x1.611698p-10f},
+      {0.0f, 0, false, true, 1435, 1435, -0x1.042488p-5f},
+      {0.0f, 0, false, true, 1436, 1436, -0x1.82d168p-12f},
+      {0.0f, 0, false, true, 1437, 1437, 0x1.943ec6p-6f},
+      {0.0f, 0, false, true, 1438, 1438, -0x1.0a2286p-8f},
+      {0x1p-1f, 5, true, false, 1440, 1441, 0.0f},
+      {0x1.8e0258p+0f, 16, true, false, 1442, 1443, 0.0f},
+      {0x1.f0796p+0f, 16, true, false, 1444, 1445, 0.0f},
+      {0x1p-1f, 9, true, false, 1446, 1447, 0.0f},
+      {0x1.3615d4p+2f, 1, true, false, 1448, 1449, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1450, 1451, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1452, 1453, 0.0f},
+      {0.0f, 0, false, true, 1446, 1446, -0x1.b37bcap-6f},
+      {0.0f, 0, false, true, 1447, 1447, 0x1.6c0ca8p-6f},
+      {0.0f, 0, false, true, 1448, 1448, 0x1.0f88f2p-5f},
+      {0.0f, 0, false, true, 1449, 1449, -0x1.efd2eep-6f},
+      {0.0f, 0, false, true, 1450, 1450, -0x1.353b04p-6f},
+      {0.0f, 0, false, true, 1451, 1451, 0x1.a3797ep-7f},
+      {0.0f, 0, false, true, 1452, 1452, 0x1.52836cp-6f},
+      {0.0f, 0, false, true, 1453, 1453, -0x1.c629d4p-6f},
+      {0x1.1f0004p-1f, 17, true, false, 1455, 1456, 0.0f},
+      {0x1p-1f, 6, true, false, 1457, 1458, 0.0f},
+      {0x1.8p+0f, 19, true, false, 1459, 1460, 0.0f},
+      {0x1.2p+2f, 4, true, false, 1461, 1462, 0.0f},
+      {0x1.dd8354p+1f, 0, true, false, 1463, 1464, 0.0f},
+      {0x1p-1f, 6, true, false, 1465, 1466, 0.0f},
+      {0x1.f18p+0f, 17, true, false, 1467, 1468, 0.0f},
+      {0.0f, 0, false, true, 1461, 1461, -0x1.2f7a62p-4f},
+      {0.0f, 0, false, true, 1462, 1462, 0.0f},
+      {0.0f, 0, false, true, 1463, 1463, 0x1.24348cp-7f},
+      {0.0f, 0, false, true, 1464, 1464, -0x1.98bf98p-6f},
+      {0.0f, 0, false, true, 1465, 1465, -0x1.cfb00cp-6f},
+      {0.0f, 0, false, true, 1466, 1466, 0x1.13f1dp-6f},
+      {0.0f, 0, false, true, 1467, 1467, -0x1.879036p-6f},
+      {0.0f, 0, false, true, 1468, 1468, 0x1.9f08aap-9f},
+      {0x1.09fb84p-1f, 3, true, false, 1470, 1471, 0.0f},
+      {0x1.28cafcp+1f, 2, true, false, 1472, 1473, 0.0f},
+      {0x1.e151acp+2f, 3, true, false, 1474, 1475, 0.0f},
+      {0x1p-1f, 5, true, false, 1476, 1477, 0.0f},
+      {0x1.1a49c4p+1f, 16, true, false, 1478, 1479, 0.0f},
+      {-0x1.36931ep+0f, 2, true, false, 1480, 1481, 0.0f},
+      {0x1.68a1c8p+1f, 16, true, false, 1482, 1483, 0.0f},
+      {0.0f, 0, false, true, 1476, 1476, 0x1.22e3acp-5f},
+      {0.0f, 0, false, true, 1477, 1477, 0x1.6fc5e2p-7f},
+      {0.0f, 0, false, true, 1478, 1478, -0x1.8b6edcp-6f},
+      {0.0f, 0, false, true, 1479, 1479, 0.0f},
+      {0.0f, 0, false, true, 1480, 1480, 0x1.d098e2p-6f},
+      {0.0f, 0, false, true, 1481, 1481, -0x1.5a7e96p-9f},
+      {0.0f, 0, false, true, 1482, 1482, -0x1.0ec5ccp-4f},
+      {0.0f, 0, false, true, 1483, 1483, 0.0f},
+  };
+};
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef FastLog_HH
+#define FastLog_HH
+
+/*
+Vectorised natural logarithm of an array of floats, used for the log chi2 features of batches of
+tracks. The exponent is split off with integer operations and the log of the mantissa in
+[sqrt(1/2), sqrt(2)) is the Cephes logf polynomial, evaluated 16 floats at a time with AVX-512,
+8 with AVX2 and 4 otherwise
+
+The largest error is 1 ulp against the exact log, or 5e-8 absolute for results in [-1, 1], as
+checked by test/testFastLog.cpp over every float in [1e-30, 1e30]. The AVX2 and AVX-512 versions
+may fuse multiply-adds, so results can differ in the last bit between machines
+
+Guard policy: inputs below floor, including 0 and negative values, are raised to floor before the
+log, and floor itself is raised to FLT_MIN, so the result is always finite for finite inputs.
+NaN stays NaN and +inf gives +inf
+*/
+
+#include <cstddef>
+
+namespace FastLog {
+
+  // out[i] = log(max(in[i], floor)) for n values, in and out may be the same array
+  void log(const float* in, float* out, size_t n, float floor = 0);
+
+  // Width of the SIMD vectors used on this machine, in floats
+  unsigned int lanes();
+
+}  // namespace FastLog
+#endif
@@ -0,0 +1,54 @@
+#ifndef FeatureScaling_HH
+#define FeatureScaling_HH
+
+/*
+Per feature standardisation of models trained on scaled inputs, read from a small text file kept
+next to the .onnx model. Each line names a feature of in_features and how it was scaled:
+  # feature   method     parameters
+  log_chi2    standard   <mean> <std> [<low> <high>]
+  z0          minmax     <min> <max>
+standard gives (x - mean) / std, optionally with x clipped to [low, high] first, minmax clips x
+to [min, max] and maps it to [0, 1]. Features not listed are passed through unchanged
+The scaling is applied by FeaturePlan in the same pass that computes the features, or folded
+by the native engines into their tree thresholds or first layer weights
+*/
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+class FeatureScaling {
+public:
+  // scaled = (min(max(x, low), high) - offset) * scale, NaN stays NaN
+  struct Affine {
+    float low = -std::numeric_limits<float>::infinity();
+    float high = std::numeric_limits<float>::infinity();
+    float offset = 0;
+    float scale = 1;
+
+    float apply(float x) const { return (std::min(std::max(x, low), high) - offset) * scale; }
+    bool clips() const { return low > -std::numeric_limits<float>::infinity() || high < std::numeric_limits<float>::infinity(); }
+    bool identity() const { return !clips() && offset == 0 && scale == 1; }
+  };
+
+  // No scaling
+  FeatureScaling() = default;
+  // Reads path, throws cms::Exception("Configuration") on features not in in_features, unknown
+  // methods, a non positive std or max not above min
+  FeatureScaling(const std::string& path, const std::vector<std::string>& in_features);
+
+  // True when every feature is passed through unchanged
+  bool identity() const;
+  // Scaling of feature f of in_features
+  const Affine& operator[](size_t f) const { return f < features_.size() ? features_[f] : unscaled_; }
+  // Only the clipping of each feature, the part left to the transform by engines that fold the
+  // offset and scale into their first layer
+  FeatureScaling clipping() const;
+
+private:
+  std::vector<Affine> features_;
+  Affine unscaled_;
+};
+
+#endif
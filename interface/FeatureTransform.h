@@ -4,10 +4,102 @@
 
 #include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
 #include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include <string>
 #include <vector>
 
 namespace FeatureTransform {
-  std::vector<float> Transform(TTTrack < Ref_Phase2TrackerDigi_ > aTrack,std::vector<std::string> in_features);
+
+  // Features available to the models, named in in_features as
+  // {"log_chi2","log_chi2rphi","log_chi2rz","log_bendchi2","chi2","chi2rphi","chi2rz","bendchi2",
+  // "nstubs","lay1_hits",...,"lay6_hits","disk1_hits",...,"disk5_hits","rinv","tanl","z0","dtot",
+  // "ltot","pt","eta","nlaymiss_interior"}
+  enum class Feature {
+    LogChi2, LogChi2RPhi, LogChi2RZ, LogBendChi2, Chi2, Chi2RPhi, Chi2RZ, BendChi2, NStubs,
+    Lay1Hits, Lay2Hits, Lay3Hits, Lay4Hits, Lay5Hits, Lay6Hits,
+    Disk1Hits, Disk2Hits, Disk3Hits, Disk4Hits, Disk5Hits,
+    RInv, TanL, Z0, DTot, LTot, Pt, Eta, NLayMissInterior
+  };
+
+  // Feature matrix layouts written by transformBatch
+  enum class Layout {
+    RowMajor,    // [track][feature], the ONNX and native engine input
+    ColumnMajor  // [feature][track]
+  };
+
+  // The TTTrack members read by the features gathered into one column per member, and the hit
+  // counts derived from them, kept by the caller so the buffers are reused across events
+  struct TrackColumns {
+    std::vector<float> chi2, chi2rphi, chi2rz, bendchi2, tanl, z0, pt, eta;
+    std::vector<double> rinv;  // scaled by 500 in double precision, as in transform
+    std::vector<unsigned int> hitpattern;
+    std::vector<unsigned int> expanded;  // expanded 11 bit hit pattern
+    std::vector<float> ltot, dtot, nlaymiss_interior;
+    std::vector<float> logs;  // FastLog output
+
+    void resize(size_t n_tracks);
+  };
+
+  struct TransformOptions {
+    // chi2 values below log_floor, 0 and negative ones included, are raised to it before the
+    // logs, and log_floor itself to FLT_MIN, so chi2 = 0 gives log(FLT_MIN) rather than -inf
+    // even with log_floor = 0. The guard policy of FastLog.h, applied by transform and
+    // transformBatch alike whether or not fast_log is set
+    float log_floor = 0;
+    // The logs are computed with FastLog, within 1 ulp of the exact log
+    bool fast_log = false;
+    // Clipping and standardisation of each feature, applied as it is written out
+    FeatureScaling scaling;
+  };
+
+  // The in_features list resolved once into features, so each track only computes and writes
+  // the features asked for, in order, with no lookup or allocation
+  class FeaturePlan {
+  public:
+    FeaturePlan() = default;
+    // Throws cms::Exception("Configuration") on unknown feature names
+    explicit FeaturePlan(const std::vector<std::string>& in_features,
+                         const TransformOptions& options = TransformOptions());
+
+    // Writes the nFeatures() features of the track to row
+    void transform(const TTTrack<Ref_Phase2TrackerDigi_>& aTrack, float* row) const;
+    // Writes the n_tracks x nFeatures() matrix of n_tracks consecutive tracks to out, gathering
+    // the track members into columns first and then computing each feature over all tracks in
+    // one loop. Gives the same values as transform
+    void transformBatch(const TTTrack<Ref_Phase2TrackerDigi_>* tracks,
+                        size_t n_tracks,
+                        float* out,
+                        Layout layout,
+                        TrackColumns& columns) const;
+    // The same for the n_selected tracks tracks[selected[0]], tracks[selected[1]], ..., so a
+    // subset of a collection is transformed without copying the tracks
+    void transformBatch(const TTTrack<Ref_Phase2TrackerDigi_>* tracks,
+                        const unsigned int* selected,
+                        size_t n_selected,
+                        float* out,
+                        Layout layout,
+                        TrackColumns& columns) const;
+
+    unsigned int nFeatures() const { return features_.size(); }
+    const std::vector<Feature>& features() const { return features_; }
+
+  private:
+    std::vector<Feature> features_;
+    bool needs_hits_ = false;  // any feature taken from the expanded hit pattern
+    bool needs_pt_ = false;
+    bool scaled_ = false;  // any feature clipped or scaled
+    TransformOptions options_;
+
+    float log(double chi2) const;
+    // The hit counts and the features of the n_tracks tracks already gathered into columns
+    void transformColumns(size_t n_tracks, float* out, Layout layout, TrackColumns& columns) const;
+  };
+
+  // One track through a plan built for the call, prefer a FeaturePlan kept across tracks
+  std::vector<float> Transform(const TTTrack<Ref_Phase2TrackerDigi_>& aTrack, const std::vector<std::string>& in_features);
+  // A whole collection through a plan built for the call
+  std::vector<float> TransformBatch(const std::vector<TTTrack<Ref_Phase2TrackerDigi_>>& tracks,
+                                    const std::vector<std::string>& in_features,
+                                    Layout layout = Layout::RowMajor);
 }
 #endif
-
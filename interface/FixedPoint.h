@@ -0,0 +1,100 @@
+#ifndef FixedPoint_HH
+#define FixedPoint_HH
+
+/*
+Run time configurable fixed point type following the Vivado HLS ap_fixed conventions, used to
+emulate the firmware classifier bit for bit. A value is held as a raw integer of width bits with
+width - integer fractional bits, and every conversion applies the quantisation (AP_TRN, AP_TRN_ZERO,
+AP_RND, AP_RND_CONV) and overflow (AP_WRAP, AP_SAT) modes of the type, using integer operations only
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+class FixedPointType {
+public:
+  enum class Quantisation { TRN, TRN_ZERO, RND, RND_CONV };
+  enum class Overflow { WRAP, SAT };
+
+  // Parses "ap_fixed<W,I>", "ap_ufixed<W,I>" with optional quantisation and overflow modes, as in
+  // "ap_fixed<16,6,AP_RND,AP_SAT>", throws cms::Exception("Configuration") if malformed
+  explicit FixedPointType(const std::string& type);
+  FixedPointType(int width, int integer, bool is_signed = true, Quantisation q = Quantisation::TRN, Overflow o = Overflow::WRAP);
+
+  // Converts a raw value with from_frac fractional bits to this type
+  int64_t cast(int64_t raw, int from_frac) const;
+  // Product of two raw values cast to this type
+  int64_t multiply(int64_t a, int a_frac, int64_t b, int b_frac) const { return cast(a * b, a_frac + b_frac); }
+
+  // Conversions from and to floating point, used to quantise constants when models are loaded
+  // and to read results, never in the emulated arithmetic
+  int64_t fromDouble(double value) const;
+  int64_t ceilFromDouble(double value) const;  // smallest representable value >= value, saturated
+  double toDouble(int64_t raw) const { return double(raw) / double(int64_t(1) << frac_); }
+
+  int width() const { return width_; }
+  int integer() const { return integer_; }
+  int frac() const { return frac_; }
+  bool isSigned() const { return signed_; }
+  Quantisation quantisationMode() const { return quantisation_; }
+  Overflow overflowMode() const { return overflow_; }
+  int64_t minRaw() const { return min_; }
+  int64_t maxRaw() const { return max_; }
+  std::string str() const;
+
+private:
+  int64_t overflow(int64_t raw) const;
+
+  int width_;
+  int integer_;
+  int frac_;
+  bool signed_;
+  Quantisation quantisation_;
+  Overflow overflow_;
+  int64_t min_;
+  int64_t max_;
+};
+
+// Inline as the emulated arithmetic casts after every operation
+inline int64_t FixedPointType::overflow(int64_t raw) const {
+  if (overflow_ == Overflow::SAT)
+    return std::clamp(raw, min_, max_);
+  // Keep the low width bits, sign extended for signed types
+  uint64_t bits = uint64_t(raw) & ((uint64_t(1) << width_) - 1);
+  if (signed_ && (bits >> (width_ - 1)))
+    return int64_t(bits) - (int64_t(1) << width_);
+  return bits;
+}
+
+inline int64_t FixedPointType::cast(int64_t raw, int from_frac) const {
+  int shift = from_frac - frac_;
+  if (shift <= 0) {
+    if (overflow_ == Overflow::SAT && shift < 0 && (raw > (max_ >> -shift) || raw < (min_ >> -shift)))
+      return raw > 0 ? max_ : min_;
+    return overflow(int64_t(uint64_t(raw) << -shift));
+  }
+
+  int64_t half = int64_t(1) << (shift - 1);
+  int64_t quotient = raw >> shift;  // floor
+  switch (quantisation_) {
+    case Quantisation::TRN:
+      break;
+    case Quantisation::TRN_ZERO:
+      if (raw < 0 && (raw & ((half << 1) - 1)))
+        quotient += 1;
+      break;
+    case Quantisation::RND:
+      quotient = (raw + half) >> shift;
+      break;
+    case Quantisation::RND_CONV: {
+      int64_t remainder = raw - int64_t(uint64_t(quotient) << shift);
+      if (remainder > half || (remainder == half && (quotient & 1)))
+        quotient += 1;
+      break;
+    }
+  }
+  return overflow(quotient);
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef FixedPointModel_HH
+#define FixedPointModel_HH
+
+/*
+Fixed point emulation of the classifier models, scoring rows of features produced by
+TrackWordFeatures with integer arithmetic only, as the firmware does
+The GBDT thresholds are rounded up into the input type, so x < threshold is decided exactly for
+every representable input, and the leaf values are summed in the accumulator type. The NN
+multiplies in the accumulator type and casts each hidden layer back to the input type. The
+final sigmoid is read from a table indexed by the accumulator, filled with result type values
+Batches of tracks are walked through the trees together as in TreeEnsemble::predict, and through
+the layers a block at a time. With a wrapping accumulator the sums are only wrapped at the end,
+modular arithmetic giving the same result, and when the products fit in 32 bits the layers are
+summed in 32 bit integers, from 16 bit activations and weights when these fit
+*/
+
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FixedPoint.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include <cstdint>
+#include <vector>
+
+// Types of the emulated arithmetic: features, model constants, sums and the returned score
+struct FixedPointPrecision {
+  FixedPointType input;
+  FixedPointType weight;
+  FixedPointType accum;
+  FixedPointType result;
+};
+
+class FixedPointModel {
+public:
+  // Quantises a loaded model into the given precision, throws cms::Exception("Configuration")
+  // for NN activations other than Relu and Sigmoid or layers wider than 256
+  FixedPointModel(const TreeEnsemble& gbdt, const FixedPointPrecision& precision);
+  FixedPointModel(const DenseNetwork& nn, const FixedPointPrecision& precision);
+
+  // Score of one row of raw input type features, in the result type
+  int64_t predictRaw(const int64_t* row) const;
+  float predict(const int64_t* row) const { return precision_.result.toDouble(predictRaw(row)); }
+  // Scores of n_tracks consecutive rows, the same as predict on each row
+  void predict(const int64_t* rows, unsigned int n_tracks, float* scores) const;
+
+  unsigned int nFeatures() const { return n_features_; }
+  const FixedPointPrecision& precision() const { return precision_; }
+
+private:
+  struct Node {
+    int64_t threshold;  // feature < threshold goes to children[1]
+    unsigned int feature;
+    uint32_t children[2];
+    int64_t value;  // leaf value in the accumulator type
+  };
+  struct Layer {
+    unsigned int n_in;
+    unsigned int n_out;
+    std::vector<int64_t> weights;  // [n_out][n_in], weight type
+    std::vector<int64_t> bias;     // accumulator type
+    bool relu;
+  };
+  // How the NN products are summed: cast one by one, or wrapped once at the end in 64 or 32 bits,
+  // Short with 16 bit activations and weights
+  enum class Sum { Exact, Wide, Narrow, Short };
+
+  int64_t predictTrees(const int64_t* row) const;
+  int64_t predictLayers(const int64_t* row) const;
+  // Accumulated scores of up to block rows
+  void predictTrees(const int64_t* rows, unsigned int n, int64_t* sums) const;
+  template <typename Value, typename Product, typename Accum>
+  void predictLayers(const int64_t* rows, unsigned int n, int64_t* sums) const;
+  // Final activation of the accumulated score, in the result type
+  int64_t output(int64_t accum) const;
+
+  FixedPointPrecision precision_;
+  unsigned int n_features_;
+  bool sigmoid_;
+
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> roots_;
+  std::vector<uint32_t> depths_;
+  int64_t base_value_;
+
+  std::vector<Layer> layers_;
+  static constexpr unsigned int max_layer_width = 256;  // activations are kept on the stack
+  Sum sum_ = Sum::Exact;
+  // Products are taken to the accumulator type as (weight * scale * input + half) >> shift
+  int64_t scale_ = 1;
+  int shift_ = 0;
+  int64_t half_ = 0;
+
+  static constexpr unsigned int block = 8;  // tracks scored together
+
+  // Sigmoid over [-8, 8) in steps of 1/256
+  static const int sigmoid_frac = 8;
+  static const int sigmoid_size = 4096;
+  std::vector<int64_t> sigmoid_table_;
+};
+
+#endif
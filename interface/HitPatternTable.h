@@ -0,0 +1,91 @@
+#ifndef HitPatternTable_HH
+#define HitPatternTable_HH
+
+/*
+Compile time table of everything the features take from the 7 bit hit pattern of the track word
+Indexed by eta bin and hit pattern, each entry holds the expected 11 bit hit pattern (layers 1-6
+in bits 0-5, disks 1-5 in bits 6-10) with its layer, disk and stub counts and the number of missed
+interior layers, so the hit features of a track are a single load
+*/
+
+#include <array>
+#include <cstdint>
+
+namespace HitPatternTable {
+
+  // Tracks with |eta| in [eta_bins[j], eta_bins[j + 1]) are in bin j, the last row of the table
+  // (bin n_eta_bins) is outside the acceptance and has no expected hits
+  constexpr int n_eta_bins = 8;
+  constexpr float eta_bins[n_eta_bins + 1] = {0.0, 0.2, 0.41, 0.62, 0.9, 1.26, 1.68, 2.08, 2.4};
+
+  // Expected hitmap table, each row corresponds to an eta bin, each value corresponds to the
+  // expected layer in the expanded hit pattern. Position 11 does not exist and is dropped, only
+  // the first six bits of the hit pattern are expanded
+  constexpr int hitmap[n_eta_bins][7] = {{0, 1, 2, 3, 4, 5, 11},
+                                         {0, 1, 2, 3, 4, 5, 11},
+                                         {0, 1, 2, 3, 4, 5, 11},
+                                         {0, 1, 2, 3, 4, 5, 11},
+                                         {0, 1, 2, 3, 4, 5, 11},
+                                         {0, 1, 2, 6, 7, 8, 9},
+                                         {0, 1, 7, 8, 9, 10, 11},
+                                         {0, 6, 7, 8, 9, 10, 11}};
+
+  struct Entry {
+    uint16_t expanded;
+    uint8_t ltot;
+    uint8_t dtot;
+    uint8_t nstubs;
+    uint8_t nlaymiss_interior;  // zeros between the first and last hit of the 7 bit pattern
+  };
+
+  constexpr int countBits(unsigned int mask) {
+    int n = 0;
+    for (; mask; mask &= mask - 1)
+      ++n;
+    return n;
+  }
+
+  constexpr Entry makeEntry(int eta_bin, unsigned int hitpattern) {
+    unsigned int expanded = 0;
+    if (eta_bin < n_eta_bins)
+      for (int k = 0; k < 6; ++k)
+        expanded |= ((hitpattern >> k) & 1u) << hitmap[eta_bin][k];
+    expanded &= 0x7ff;
+
+    int missing = 0;
+    bool started = false;
+    for (int bit = 0; bit < 7 && (hitpattern >> bit); ++bit) {
+      bool hit = (hitpattern >> bit) & 1;
+      started = started || hit;
+      missing += started && !hit;
+    }
+
+    int ltot = countBits(expanded & 0x3f);
+    int dtot = countBits(expanded >> 6);
+    return {uint16_t(expanded), uint8_t(ltot), uint8_t(dtot), uint8_t(ltot + dtot), uint8_t(missing)};
+  }
+
+  constexpr std::array<Entry, (n_eta_bins + 1) * 128> makeTable() {
+    std::array<Entry, (n_eta_bins + 1) * 128> entries{};
+    for (int bin = 0; bin <= n_eta_bins; ++bin)
+      for (unsigned int hitpattern = 0; hitpattern < 128; ++hitpattern)
+        entries[bin * 128 + hitpattern] = makeEntry(bin, hitpattern);
+    return entries;
+  }
+
+  inline constexpr std::array<Entry, (n_eta_bins + 1) * 128> table = makeTable();
+
+  // Counts the lower edges passed without branching, NaN and |eta| >= 2.4 give n_eta_bins
+  inline int etaBin(float abs_eta) {
+    int bin = 0;
+    for (int j = 1; j <= n_eta_bins; ++j)
+      bin += !(abs_eta < eta_bins[j]);
+    return bin;
+  }
+
+  inline const Entry& lookup(unsigned int hitpattern, float abs_eta) {
+    return table[etaBin(abs_eta) * 128 + (hitpattern & 0x7f)];
+  }
+
+}  // namespace HitPatternTable
+#endif
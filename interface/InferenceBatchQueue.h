@@ -0,0 +1,74 @@
+#ifndef InferenceBatchQueue_HH
+#define InferenceBatchQueue_HH
+
+/*
+Queue coalescing the inference requests of several concurrent events into a single model run
+Requests are submitted from the acquire step of an ExternalWork module and are run by a worker
+thread once max_batch rows are waiting or the oldest request has waited max_wait microseconds.
+The waiting framework task of each request is released as soon as its scores are written,
+so no framework thread ever blocks on the queue
+*/
+
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+class InferenceBatchQueue {
+public:
+  // Scores n_rows rows of a contiguous n_rows x n_features buffer, writing one score per row
+  typedef std::function<void(std::vector<float>& features, unsigned int n_rows, std::vector<float>& scores)> Model;
+
+  InferenceBatchQueue(Model model, unsigned int n_features, unsigned int max_batch, double max_wait);
+  ~InferenceBatchQueue();
+
+  // Queues n_rows rows of features, the caller keeps features and scores alive until holder
+  // is released, n_rows scores are written before that
+  void submit(const float* features, unsigned int n_rows, float* scores, edm::WaitingTaskWithArenaHolder holder);
+
+  // Prints the achieved batch sizes
+  void printStats(std::ostream& os) const;
+
+private:
+  struct Request {
+    const float* features;
+    unsigned int n_rows;
+    float* scores;
+    edm::WaitingTaskWithArenaHolder holder;
+    std::chrono::steady_clock::time_point submitted;
+  };
+
+  void run();
+
+  Model model_;
+  unsigned int n_features_;
+  unsigned int max_batch_;
+  std::chrono::microseconds max_wait_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Request> pending_;
+  unsigned int pending_rows_;
+  bool stop_;
+
+  // Only touched by the worker thread
+  std::vector<float> features_;
+  std::vector<float> scores_;
+
+  // Statistics, guarded by mutex_
+  unsigned long long n_batches_;
+  unsigned long long n_requests_;
+  unsigned long long n_rows_;
+  unsigned long long n_full_;
+  unsigned int max_rows_;
+  std::vector<unsigned long long> rows_histogram_;  // batches per power of two of rows
+
+  std::thread worker_;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef L1TrackFeatures_HH
+#define L1TrackFeatures_HH
+
+/*
+Event product holding the features of every track of a TTTrack collection, one column per
+feature (structure of arrays), filled once per event by L1TrackFeatureProducer so classifiers and
+analysers reading the same collection do not each redo the feature transform
+Tracks are in the order of the collection the product was made from
+*/
+
+#include <string>
+#include <vector>
+
+class L1TrackFeatures {
+public:
+  L1TrackFeatures() : n_tracks_(0), log_floor_(0), fast_log_(false) {}
+  // Zeroed columns for the features named as in FeatureTransform, log_floor is the chi2 floor of
+  // the log features and fast_log whether their logs are taken with FastLog
+  L1TrackFeatures(const std::vector<std::string>& names, size_t n_tracks, float log_floor, bool fast_log);
+
+  size_t nTracks() const { return n_tracks_; }
+  unsigned int nFeatures() const { return names_.size(); }
+  const std::vector<std::string>& names() const { return names_; }
+  float logFloor() const { return log_floor_; }
+  bool fastLog() const { return fast_log_; }
+  // Throws cms::Exception("Configuration") unless the features were computed with this chi2 floor
+  // and log, so a reader does not take features it would not have computed itself
+  void checkTransform(float log_floor, bool fast_log) const;
+
+  // Column of a feature, throws cms::Exception("Configuration") if it is not in the product
+  unsigned int index(const std::string& name) const;
+  const float* column(unsigned int feature) const { return values_.data() + feature * n_tracks_; }
+  float* column(unsigned int feature) { return values_.data() + feature * n_tracks_; }
+  // The nTracks() x nFeatures() matrix, feature major, as written by Layout::ColumnMajor
+  float* data() { return values_.data(); }
+  float value(size_t track, unsigned int feature) const { return values_[feature * n_tracks_ + track]; }
+
+  // Writes the columns listed in features, in that order, as an nTracks() x features.size() row
+  // major matrix, the input of the classifier engines
+  void rows(const std::vector<unsigned int>& features, float* out) const;
+  // The same for the n_selected tracks selected[0], selected[1], ... only
+  void rows(const std::vector<unsigned int>& features, const unsigned int* selected, size_t n_selected, float* out) const;
+
+private:
+  std::vector<std::string> names_;
+  size_t n_tracks_;
+  float log_floor_;
+  bool fast_log_;
+  std::vector<float> values_;
+};
+
+#endif
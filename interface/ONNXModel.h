@@ -0,0 +1,39 @@
+#ifndef ONNXModel_HH
+#define ONNXModel_HH
+
+/*
+A model run by ONNX runtime, returning the positive class probability of each track
+*/
+
+#include "PhysicsTools/ONNXRuntime/interface/ONNXRuntime.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class ONNXModel {
+public:
+  // score_output is the index of the output holding the class probabilities and
+  // score_columns the number of probabilities per track, the last one is the positive class
+  ONNXModel(const std::string& path,
+            const std::string& input_name,
+            const std::vector<std::string>& output_names,
+            unsigned int score_output,
+            unsigned int score_columns);
+
+  // Runs the model on batch_size rows of input and returns the positive class score of each row
+  std::vector<float> predict(cms::Ort::FloatArrays& input, int64_t batch_size) const;
+
+  const std::string& path() const { return path_; }
+  double loadTime() const { return load_time_; }  // in ms
+
+private:
+  std::string path_;
+  std::unique_ptr<cms::Ort::ONNXRuntime> runtime_;
+  std::vector<std::string> input_names_;
+  std::vector<std::string> output_names_;
+  unsigned int score_output_;
+  unsigned int score_columns_;
+  double load_time_;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef ONNXModelCache_HH
+#define ONNXModelCache_HH
+
+/*
+Cache of the ONNX runtime sessions and native engines used by the track classifier
+Each configured model is parsed, optimised and allocated once per job, after which the
+models are only read, so a single cache can be shared by every copy of the producer
+*/
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModel.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class ONNXModelCache {
+public:
+  // Loads the models needed by the Algorithm parameter of the classifier configuration
+  explicit ONNXModelCache(const edm::ParameterSet& iConfig);
+
+  // Null when the model is not used by the configured algorithm
+  const ONNXModel* nn() const { return nn_.get(); }
+  const ONNXModel* gbdt() const { return gbdt_.get(); }
+  const TreeEnsemble* gbdtNative() const { return gbdt_native_.get(); }
+  const QuickScorer* gbdtQuickScorer() const { return gbdt_quickscorer_.get(); }
+  const DenseNetwork* nnNative() const { return nn_native_.get(); }
+  // Features from the track word, for GBDTFixedPoint, NNFixedPoint or trackWordFeatures, and the
+  // fixed point emulation of GBDTFixedPoint or NNFixedPoint
+  const TrackWordFeatures* trackWordFeatures() const { return track_word_features_.get(); }
+  const FixedPointModel* fixedPoint() const { return fixed_point_.get(); }
+  // Scaling of the model inputs left to FeaturePlan, the part of NNIdScaling or GBDTIdScaling the
+  // native engines could not fold into their thresholds or weights
+  const FeatureScaling& inputScaling() const { return input_scaling_; }
+
+private:
+  std::unique_ptr<const ONNXModel> nn_;
+  std::unique_ptr<const ONNXModel> gbdt_;
+  std::unique_ptr<const TreeEnsemble> gbdt_native_;
+  std::unique_ptr<const QuickScorer> gbdt_quickscorer_;
+  std::unique_ptr<const DenseNetwork> nn_native_;
+  std::unique_ptr<const TrackWordFeatures> track_word_features_;
+  std::unique_ptr<const FixedPointModel> fixed_point_;
+  FeatureScaling input_scaling_;
+};
+
+#endif
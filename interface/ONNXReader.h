@@ -0,0 +1,66 @@
+#ifndef ONNXReader_HH
+#define ONNXReader_HH
+
+/*
+Minimal reader of the ONNX protobuf format, used by the native inference engines to load the
+graph nodes, attributes and initializers of a model without going through ONNX Runtime
+Only the parts of the format needed by the track quality models are decoded, tensor data is
+converted to float
+*/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ONNXReader {
+
+  struct Tensor {
+    std::string name;
+    std::vector<int64_t> dims;
+    std::vector<float> data;
+  };
+
+  struct Attribute {
+    std::string name;
+    float f = 0;
+    int64_t i = 0;
+    std::string s;
+    std::vector<float> floats;
+    std::vector<int64_t> ints;
+    std::vector<std::string> strings;
+    Tensor t;
+  };
+
+  struct Node {
+    std::string name;
+    std::string op_type;
+    std::string domain;
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    std::vector<Attribute> attributes;
+
+    // Null if the node has no attribute of this name
+    const Attribute* attribute(const std::string& attribute_name) const;
+  };
+
+  // Graph input or output, dynamic dimensions are -1
+  struct ValueInfo {
+    std::string name;
+    std::vector<int64_t> dims;
+  };
+
+  struct Graph {
+    std::vector<Node> nodes;
+    std::vector<Tensor> initializers;
+    std::vector<ValueInfo> inputs;
+    std::vector<ValueInfo> outputs;
+
+    // Null if no initializer has this name
+    const Tensor* initializer(const std::string& tensor_name) const;
+  };
+
+  // Throws cms::Exception if the file cannot be read or is not a valid ONNX model
+  Graph read(const std::string& path);
+
+}  // namespace ONNXReader
+#endif
@@ -0,0 +1,55 @@
+#ifndef QuickScorer_HH
+#define QuickScorer_HH
+
+/*
+QuickScorer evaluation of the GBDT (Lucchese et al., SIGIR 2015, and its vectorised V-QuickScorer)
+Rather than walking each tree, the split thresholds of the whole ensemble are sorted per feature
+and every feature value is compared once against its sorted list. Each split found false clears
+the leaves of its less-than subtree from a per tree leaf bitvector, and the leaf reached by a track
+is the lowest bit left set. With AVX2 eight tracks are scored together, one per 32 bit lane, so
+trees may have at most 32 leaves
+*/
+
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include <cstdint>
+#include <vector>
+
+class QuickScorer {
+public:
+  // Builds the per feature split lists from a flattened ensemble, throws cms::Exception if a
+  // tree has more than 32 leaves
+  explicit QuickScorer(const TreeEnsemble& ensemble);
+
+  // Same interface and results as TreeEnsemble::predict
+  void predict(const float* features, unsigned int n_tracks, float* scores) const;
+
+  unsigned int nFeatures() const { return n_features_; }
+  unsigned int nTrees() const { return leaf_offsets_.size(); }
+  // True if the AVX2 kernel is used on this machine, otherwise tracks are scored one at a time
+  bool vectorised() const { return avx2_; }
+
+private:
+  // Scores one track and the eight tracks of a block from rows of n_features_ floats
+  float scoreTrack(const float* row, uint32_t* leaves) const;
+  void scoreBlock(const float* rows, float* sums, uint32_t* leaves) const;
+
+  // Splits sorted by feature then threshold, a split is false once threshold <= value
+  std::vector<uint32_t> feature_begin_;  // first split of each feature, n_features_ + 1 entries
+  std::vector<float> thresholds_;
+  std::vector<uint32_t> split_trees_;
+  std::vector<uint32_t> split_masks_;  // leaves kept when the split is false
+
+  // Splits sending NaN to the greater-or-equal child, whose masks also apply to missing values
+  std::vector<uint32_t> nan_begin_;
+  std::vector<uint32_t> nan_trees_;
+  std::vector<uint32_t> nan_masks_;
+
+  std::vector<uint32_t> leaf_offsets_;  // first leaf of each tree in leaf_values_
+  std::vector<float> leaf_values_;      // leaves of each tree from the less-than side to the other
+  unsigned int n_features_;
+  float base_value_;
+  bool logistic_;
+  bool avx2_;
+};
+
+#endif
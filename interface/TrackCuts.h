@@ -0,0 +1,41 @@
+#ifndef TrackCuts_HH
+#define TrackCuts_HH
+
+/*
+The track quality cuts of the Cut algorithm (minPt, maxZ0, maxEta, chi2dofMax, bendchi2Max and
+nStubsmin), also used with looser values as the preselection of the ML algorithms: tracks failing
+it are given a fixed score and never reach the feature transform or the model
+*/
+
+#include <cmath>
+
+struct TrackCuts {
+  float min_pt;  // in GeV
+  float max_z0;  // in cm
+  float max_eta;
+  float max_chi2;
+  float max_bendchi2;
+  int min_nstubs;
+
+  // The cheap members first, so most failing tracks return before the momentum is read. The
+  // stub refs are copied out of the track to be counted, min_nstubs <= 0 skips that
+  template <typename Track>
+  bool pass(const Track& track) const {
+    if (!(track.chi2() < max_chi2 && track.stubPtConsistency() < max_bendchi2 && std::abs(track.z0()) < max_z0))
+      return false;
+    const auto momentum = track.momentum();
+    if (!(momentum.perp() >= min_pt && std::abs(momentum.eta()) < max_eta))
+      return false;
+    return min_nstubs <= 0 || int(track.getStubRefs().size()) >= min_nstubs;
+  }
+
+  // minPt, maxZ0, maxEta, chi2dofMax, bendchi2Max and nStubsmin of an edm::ParameterSet
+  template <typename ParameterSet>
+  static TrackCuts fromConfig(const ParameterSet& pset) {
+    return {(float)pset.template getParameter<double>("minPt"),      (float)pset.template getParameter<double>("maxZ0"),
+            (float)pset.template getParameter<double>("maxEta"),     (float)pset.template getParameter<double>("chi2dofMax"),
+            (float)pset.template getParameter<double>("bendchi2Max"), pset.template getParameter<int>("nStubsmin")};
+  }
+};
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef TrackRecordFile_HH
+#define TrackRecordFile_HH
+
+/*
+Binary file of the classifier inputs of recorded events, written by L1TrackRecorder and read
+back without CMSSW by the replay benchmark, so the engines can be timed on real tracks
+Layout, native (little endian) byte order:
+  header    TrackRecordHeader, 64 bytes
+  events    the RecordedTrack array of each event, padded to 8 bytes. When the header says so,
+            byte shuffled (byte k of every record, for k = 0..79) and zlib compressed
+  index     one TrackRecordIndex per event, at header.index_offset, written when the file is closed
+The version is raised whenever the layout changes, the reader refuses versions it does not know
+*/
+
+#include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// The TTTrack members read by the feature transform and the cut, and the classifier scores
+struct RecordedTrack {
+  double rinv;
+  double phi;
+  double tanl;
+  double z0;
+  double d0;
+  double chi2rphi;
+  double chi2rz;
+  double bendchi2;
+  float mva[3];
+  uint16_t hitpattern;
+  uint8_t nstubs;
+  uint8_t nfitpars;
+
+  static RecordedTrack fromTrack(const TTTrack<Ref_Phase2TrackerDigi_>& track);
+  // The track rebuilt with its momentum in the field bfield (T) and nstubs null stub references
+  TTTrack<Ref_Phase2TrackerDigi_> toTrack(double bfield) const;
+};
+static_assert(sizeof(RecordedTrack) == 80, "RecordedTrack is part of the file format");
+
+struct TrackRecordHeader {
+  static constexpr char magic_value[8] = {'L', '1', 'T', 'Q', 'R', 'E', 'C', 0};
+  static constexpr uint32_t current_version = 1;
+  static constexpr uint32_t compressed = 1;  // flags
+
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint64_t n_events;
+  uint64_t index_offset;
+  double bfield;       // in T, of the momenta of the recorded tracks
+  char algorithm[24];  // Algorithm of the classifier that filled the scores, null terminated
+};
+static_assert(sizeof(TrackRecordHeader) == 64, "TrackRecordHeader is part of the file format");
+
+struct TrackRecordIndex {
+  uint64_t event;   // event number
+  uint64_t offset;  // of the tracks in the file
+  uint32_t n_tracks;
+  uint32_t bytes;   // stored, compressed or not
+};
+static_assert(sizeof(TrackRecordIndex) == 24, "TrackRecordIndex is part of the file format");
+
+class TrackRecordWriter {
+public:
+  // Throws cms::Exception("TrackRecord") if the file cannot be created
+  TrackRecordWriter(const std::string& path, double bfield, const std::string& algorithm, bool compress);
+  ~TrackRecordWriter();
+
+  void write(uint64_t event, const std::vector<TTTrack<Ref_Phase2TrackerDigi_> >& tracks);
+  // Writes the index and the final header, the file is not readable before
+  void close();
+
+  uint64_t nEvents() const { return index_.size(); }
+
+private:
+  std::ofstream file_;
+  TrackRecordHeader header_;
+  std::vector<TrackRecordIndex> index_;
+  std::vector<RecordedTrack> records_;
+  std::vector<unsigned char> shuffled_;
+  std::vector<unsigned char> compressed_;
+};
+
+class TrackRecordReader {
+public:
+  // Maps the file into memory, throws cms::Exception("TrackRecord") if it cannot be read, is not a
+  // track record, has an unknown version or an index pointing outside the file or giving more
+  // tracks than the stored bytes can hold
+  explicit TrackRecordReader(const std::string& path);
+  ~TrackRecordReader();
+  TrackRecordReader(const TrackRecordReader&) = delete;
+  TrackRecordReader& operator=(const TrackRecordReader&) = delete;
+
+  uint64_t nEvents() const { return header_->n_events; }
+  const TrackRecordIndex& index(uint64_t i) const { return index_[i]; }
+  double bfield() const { return header_->bfield; }
+  std::string algorithm() const { return header_->algorithm; }
+  bool compressed() const { return header_->flags & TrackRecordHeader::compressed; }
+
+  // The tracks of the i-th event: in the mapped file when it is not compressed, else inflated
+  // into buffer through the reader's own shuffle buffer
+  const RecordedTrack* tracks(uint64_t i, std::vector<RecordedTrack>& buffer);
+  // The i-th event as TTTracks, replacing the content of tracks
+  void read(uint64_t i, std::vector<TTTrack<Ref_Phase2TrackerDigi_> >& tracks);
+
+private:
+  const unsigned char* data_;
+  size_t size_;
+  const TrackRecordHeader* header_;
+  const TrackRecordIndex* index_;
+  std::vector<RecordedTrack> buffer_;
+  std::vector<unsigned char> shuffled_;  // inflated bytes of an event, reused
+};
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef TrackWordFeatures_HH
+#define TrackWordFeatures_HH
+
+/*
+Classifier input features computed from the digitised fields of the track word, as the firmware
+sees the track, rather than from the floating point TTTrack members
+The fixed point path uses integer operations only: scale factors applied as integer multiplies,
+logarithms of the binned chi2 fields read from tables, and the eta bin of the hit pattern
+expansion found by comparing the tanl bits with integer edges. The floating point path decodes
+the same fields to floats and mirrors FeatureTransform, giving the reference for the emulation
+*/
+
+#include "L1Trigger/TrackQuality/interface/FixedPoint.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Fields of the track word (see setTrackWordBits in util/TTTrack.h) used by the classifier
+struct TrackWordBits {
+  unsigned int rinv;
+  unsigned int tanl;
+  unsigned int z0;
+  unsigned int chi2rphi;
+  unsigned int chi2rz;
+  unsigned int bendchi2;
+  unsigned int hitpattern;
+};
+
+// Digitisation of the track word, as TTTrack_TrackWord: signed fields are two's complement over
+// [-max, max), chi2 fields are the index of their bin
+struct TrackWordFormat {
+  unsigned int rinv_bits = 15;
+  double max_rinv = 0.006;  // in 1/cm
+  unsigned int tanl_bits = 16;
+  double max_tanl = 8.;
+  unsigned int z0_bits = 12;
+  double max_z0 = 16.;  // in cm
+  std::array<double, 16> chi2_bins = {
+      {0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 20.0, 40.0, 100.0, 200.0, 500.0, 1000.0, 3000.0}};
+  std::array<double, 8> bendchi2_bins = {{0.0, 0.5, 1.25, 2.0, 3.0, 5.0, 10.0, 50.0}};
+
+  static double step(unsigned int bits, double max) { return 2. * max / double(1u << bits); }
+  // Two's complement field value
+  static int toSigned(unsigned int field, unsigned int bits) {
+    return (field >> (bits - 1)) & 1 ? int(field) - int(1u << bits) : int(field);
+  }
+  static unsigned int digitizeSigned(double value, unsigned int bits, double max);
+  template <size_t N>
+  static unsigned int digitizeBinned(double value, const std::array<double, N>& bins);
+  // Value standing for a chi2 bin, its centre or the lower edge of the last bin
+  template <size_t N>
+  static double binValue(unsigned int index, const std::array<double, N>& bins) {
+    return index + 1 < N ? 0.5 * (bins[index] + bins[index + 1]) : bins[N - 1];
+  }
+
+  TrackWordBits digitize(double rinv, double tanl, double z0, double chi2rphi, double chi2rz, double bendchi2,
+                         unsigned int hitpattern) const;
+  // The fields of a TTTrack as its setTrackWordBits sets them: a track without the split chi2
+  // (chi2Z negative) has its total chi2 in the r-phi field and 0 in the r-z field
+  template <typename Track>
+  TrackWordBits digitize(const Track& track) const {
+    bool split = track.chi2Z() >= 0;
+    return digitize(track.rInv(), track.tanL(), track.z0(), split ? track.chi2XY() : track.chi2(),
+                    split ? track.chi2Z() : 0., track.stubPtConsistency(), track.hitPattern());
+  }
+
+  // The fields packed into one 64 bit word, from the lowest bits rinv, tanl, z0, chi2rphi (4 bits),
+  // chi2rz (4), bendchi2 (3) and hitpattern (7), 61 bits with the default widths
+  unsigned int packedBits() const { return rinv_bits + tanl_bits + z0_bits + 18; }
+  uint64_t pack(const TrackWordBits& bits) const;
+  TrackWordBits unpack(uint64_t word) const;
+};
+
+template <size_t N>
+unsigned int TrackWordFormat::digitizeBinned(double value, const std::array<double, N>& bins) {
+  unsigned int index = 0;
+  while (index + 1 < N && value >= bins[index + 1])
+    ++index;
+  return index;
+}
+
+class TrackWordFeatures {
+public:
+  // Features are named as in FeatureTransform, throws cms::Exception("Configuration") for names
+  // that are unknown or not available from the track word (pt, eta)
+  TrackWordFeatures(const std::vector<std::string>& in_features,
+                    const FixedPointType& type,
+                    const TrackWordFormat& format = TrackWordFormat());
+
+  // One row of features in the fixed point type, raw values with type().frac() fractional bits
+  void fixedPoint(const TrackWordBits& bits, int64_t* row) const;
+  // The same features computed in floating point from the decoded fields
+  void floatingPoint(const TrackWordBits& bits, float* row) const;
+  // Rows of floating point features of n_tracks words packed by TrackWordFormat::pack, the fields
+  // taken out with shifts and masks and the chi2 features read from tables. Gives the values of
+  // floatingPoint while reading 8 bytes per track
+  void floatingPoint(const uint64_t* words, size_t n_tracks, float* out) const;
+
+  unsigned int nFeatures() const { return features_.size(); }
+  const FixedPointType& type() const { return type_; }
+  const TrackWordFormat& format() const { return format_; }
+
+private:
+  enum class Feature {
+    LogChi2, LogChi2RPhi, LogChi2RZ, LogBendChi2, Chi2, Chi2RPhi, Chi2RZ, BendChi2,
+    NStubs, Hit, RInv, TanL, Z0, DTot, LTot, NLayMissInterior
+  };
+  struct Column {
+    Feature feature;
+    unsigned int hit;  // expanded hit pattern position for Hit
+  };
+
+  // Row of the HitPatternTable for the tanl field
+  int etaBin(unsigned int tanl_field) const;
+
+  std::vector<Column> features_;
+  FixedPointType type_;
+  TrackWordFormat format_;
+
+  // Integer multipliers with 30 fractional bits taking |field| to the feature value
+  static const int multiplier_frac = 30;
+  int64_t rinv_multiplier_;
+  int64_t tanl_multiplier_;
+  int64_t z0_multiplier_;
+  // Lower edges of the eta bins as |tanl| field values
+  std::vector<int64_t> eta_edges_;
+
+  // Tables of the chi2 features in the fixed point type, indexed by the field
+  std::array<int64_t, 16> log_chi2rphi_, log_chi2rz_, chi2rphi_, chi2rz_;
+  std::array<int64_t, 8> log_bendchi2_, bendchi2_;
+  std::array<int64_t, 256> log_chi2_, chi2_;  // indexed by chi2rphi << 4 | chi2rz
+
+  // The floating point chi2 features, indexed by the field, the sums by chi2rz << 4 | chi2rphi as
+  // they sit in the packed word
+  std::array<float, 16> chi2_float_, log_chi2_float_;
+  std::array<float, 8> bendchi2_float_, log_bendchi2_float_;
+  std::array<float, 256> chi2_sum_float_, log_chi2_sum_float_;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef TreeEnsemble_HH
+#define TreeEnsemble_HH
+
+/*
+Native evaluator of the binary TreeEnsembleClassifier stored in an ONNX file (the XGBoost GBDT)
+The trees are flattened into one array of 16 byte nodes, each tree stored contiguously in
+breadth first order so no node straddles a cache line. Leaves point back to themselves, so every
+tree is walked for a fixed number of steps with no leaf test and a batch of tracks is walked in
+lock step to keep several independent loads in flight
+*/
+
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TreeEnsemble {
+public:
+  // Loads the TreeEnsembleClassifier node of an ONNX model, throws cms::Exception if the model
+  // is not a binary tree ensemble classifier
+  explicit TreeEnsemble(const std::string& onnx_path);
+
+  // Scores n_tracks rows of a contiguous n_tracks x nFeatures() buffer, writing the positive
+  // class probability of each row, as in output [1][1] of ONNX runtime
+  void predict(const float* features, unsigned int n_tracks, float* scores) const;
+
+  // Moves the thresholds to the unscaled features, so the ensemble gives on raw features the
+  // decisions it gave on features scaled by FeaturePlan, clipping included
+  void foldScaling(const FeatureScaling& scaling);
+
+  unsigned int nFeatures() const { return n_features_; }
+  unsigned int nTrees() const { return roots_.size(); }
+  unsigned int nNodes() const { return nodes_.size(); }
+  unsigned int maxDepth() const;
+
+  struct Node {
+    float threshold;
+    uint16_t feature;
+    uint8_t nan_to_lt;  // missing (NaN) values follow the less-than child
+    uint8_t padding;
+    uint32_t children[2];  // [0] feature >= threshold, [1] feature < threshold
+  };
+
+  // Access to the flattened ensemble, used by the other native engines and the code generator
+  const std::vector<Node>& nodes() const { return nodes_; }
+  const std::vector<float>& leafValues() const { return values_; }  // indexed by node, 0 for branches
+  const std::vector<uint32_t>& roots() const { return roots_; }
+  const std::vector<uint32_t>& depths() const { return depths_; }
+  float baseValue() const { return base_value_; }
+  bool logistic() const { return logistic_; }
+
+private:
+  std::vector<Node> nodes_;
+  std::vector<float> values_;
+  std::vector<uint32_t> roots_;
+  std::vector<uint32_t> depths_;
+  unsigned int n_features_;
+  float base_value_;
+  bool logistic_;  // post transform, sigmoid of the summed leaf values
+};
+
+#endif
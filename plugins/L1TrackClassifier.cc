@@ -6,11 +6,39 @@
  * 
  * Uses pretrained ML models to classify tracks
  *
+ * The ONNX models are held in a global cache shared read-only by all streams.
+ * Tracks are copied and transformed in acquire, classified either straight away or,
+ * with useBatchQueue, by a queue batching the tracks of several concurrent events
+ * (ExternalWork), and written out in produce. The fixed point algorithms score each
+ * track from its track word bits in acquire. The Algorithm is a list of engines
+ * (ClassifierEngine) built once by a factory, the event loop calls them without looking
+ * at the algorithm name
+ *
+ * Algorithm All runs the engines of allEngines, up to three, into MVA1, MVA2 and MVA3. The
+ * features are computed once and the models classify the same batch, side by side with
+ * parallelEngines, each timed on its own with timingStats
+ *
+ * With timingStats each stream times its stages (ClassifierStats), the streams are
+ * merged at the end of the job and printed, and written to timingStatsJson if set
+ *
+ * With usePreselection the model algorithms run as a cascade: tracks failing the loose
+ * preselection cuts get preselectionScore in acquire and only the others are transformed
+ * and classified
+ *
+ * With outputMode ValueMap the input tracks are classified where they are and only their
+ * MVA fields are written, as ValueMaps MVA1, MVA2 and MVA3 of the input collection, rather
+ * than a copy of every track with its stub refs. With outputMode Selected only refs to the
+ * tracks whose score is above the selectionThresholds entry of the algorithm are written,
+ * with their scores and their number
+ *
  *  Created on: July 15, 2020
  *      Author: Christopher Brown
  */
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <memory>
@@ -19,123 +47,212 @@
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/Framework/interface/Frameworkfwd.h"
-#include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/Framework/interface/stream/EDProducer.h"
 
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/Framework/interface/ESHandle.h"
 
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/Exception.h"
 
+#include "DataFormats/Common/interface/Ref.h"
+#include "DataFormats/Common/interface/RefVector.h"
+#include "DataFormats/Common/interface/ValueMap.h"
 #include "PhysicsTools/ONNXRuntime/interface/ONNXRuntime.h"
+#include "L1Trigger/TrackQuality/interface/ClassifierEngine.h"
+#include "L1Trigger/TrackQuality/interface/ClassifierStats.h"
 #include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/InferenceBatchQueue.h"
+#include "L1Trigger/TrackQuality/interface/TrackCuts.h"
 #include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
 #include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+#include "tbb/task_group.h"
 
 
 
 using namespace std;
 
 
-class L1TrackClassifier : public edm::EDProducer {
+// State shared by all streams, the models and the queue batching inference across events
+struct L1TrackClassifierCache {
+  explicit L1TrackClassifierCache(const edm::ParameterSet& iConfig)
+      : models(iConfig),
+        engines(ClassifierEngine::make(iConfig.getParameter<string>("Algorithm"), models, iConfig)),
+        parallelEngines(iConfig.getParameter<bool>("parallelEngines")),
+        timingStatsJson(iConfig.getParameter<string>("timingStatsJson")) {
+    for (unsigned int i = 0; i < engines.size(); ++i) {
+      if (engines[i]->input() == ClassifierEngine::Input::Tracks)
+        trackEngines.push_back(i);
+      else if (engines[i]->input() == ClassifierEngine::Input::TrackWords)
+        wordEngines.push_back(i);
+      else
+        modelEngines.push_back(i);
+    }
+  }
+
+  ONNXModelCache models;
+  // Engines of the Algorithm, and the index of each by what it scores the tracks from, the model
+  // engines all classify the same transformed features
+  ClassifierEngine::Engines engines;
+  vector<unsigned int> trackEngines;
+  vector<unsigned int> wordEngines;
+  vector<unsigned int> modelEngines;
+  bool parallelEngines;  // model engines run side by side in TBB tasks
+  // null unless useBatchQueue is set, declared after models so it is stopped first
+  unique_ptr<InferenceBatchQueue> queue;
+
+  // Stage timings of the streams, merged as each stream ends
+  string timingStatsJson;
+  mutable std::mutex statsMutex;
+  mutable ClassifierStats stats;
+  mutable bool hasStats = false;
+};
+
+class L1TrackClassifier : public edm::stream::EDProducer<edm::GlobalCache<L1TrackClassifierCache>, edm::ExternalWork> {
 public:
 
   typedef TTTrack< Ref_Phase2TrackerDigi_ >  L1TTTrackType;
   typedef vector< L1TTTrackType > L1TTTrackCollectionType;
+  typedef edm::RefVector< L1TTTrackCollectionType > L1TTTrackRefCollectionType;
 
-  explicit L1TrackClassifier(const edm::ParameterSet&);
+  explicit L1TrackClassifier(const edm::ParameterSet&, const L1TrackClassifierCache*);
   ~L1TrackClassifier();
 
+  // ONNX sessions, loaded once per job and shared by every stream
+  static unique_ptr<L1TrackClassifierCache> initializeGlobalCache(const edm::ParameterSet&);
+  static void globalEndJob(const L1TrackClassifierCache*);
+
 private:
-  virtual void beginJob() ;
-  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob() ;
+  void acquire(const edm::Event&, const edm::EventSetup&, edm::WaitingTaskWithArenaHolder) override;
+  void produce(edm::Event&, const edm::EventSetup&) override;
+  void endStream() override;
+
+  enum class OutputMode { Tracks, ValueMap, Selected };
+
+  // Sets field k (1 to 3) of the MVA of track i of the event, on the output copy or in mvaValues
+  void setMVA(unsigned int k, size_t i, float value);
+  // Sets field k of the MVA of every track of the event
+  void setMVAs(unsigned int k, const float* values);
+  // Track word fields of track i, those of the output copy or digitised as setTrackWordBits does
+  TrackWordBits trackWordBits(size_t i) const;
+  // Runs model engine m on the features of the batch_size tracks, on its own copy of them when it
+  // lends them to ONNX runtime while other engines read them
+  void predict(unsigned int m, unsigned int batch_size, bool copy_features);
 
   // ----------member data ---------------------------
+  // configuration only, nothing here is modified once the module is constructed
   string algorithm;
 
-  float cut_min_pt_;
-  float cut_max_z0_ ;
-  float cut_max_eta_ ;
-  float cut_max_chi2_ ;
-  float cut_max_bendchi_;
-  int cut_min_nstubs_;
-
-  float trk_pt;
-  float trk_bend_chi2;
-  float trk_z0;
-  float trk_eta;
-  float trk_chi2;
-  int nStubs;
-  
-
-  vector<float> TransformedFeatures;
   vector<string> in_features;
   int n_features;
-
-  string ONNX_path;
-  string TF_path;
-
-  
-  // FloatArray type defined in https://github.com/cms-sw/cmssw/blob/master/PhysicsTools/ONNXRuntime/interface/ONNXRuntime.h
-  // as: std::vector<std::vector<float>> FloatArrays;
-  cms::Ort::FloatArrays ortinput;
-  vector<string> ortinput_names;
-  cms::Ort::FloatArrays ortoutputs;
-  vector<string> ortoutput_names;
-
-  
-
-
+  FeatureTransform::FeaturePlan featurePlan;  // in_features resolved once
+  FeatureTransform::TransformOptions transformOptions;  // also required of an L1TrackFeatures product
+  bool runModel;  // the Algorithm has engines run on the features
+  bool fromTrackWord;  // float engines fed features decoded from the packed track words
+  bool fromProduct;  // features read from an L1TrackFeatures product rather than computed here
+  bool preselect;  // only the tracks passing preselection are classified by the model
+  TrackCuts preselection;
+  float preselectionScore;  // score of the tracks failing preselection
+  OutputMode outputMode;  // the tracks are only copied for Tracks
+  unsigned int selectedMVA;  // field holding the score of the algorithm, that of its last engine
+  float selectionThreshold;  // with Selected, tracks are kept if their score is above
+
+  // Event being processed by this stream, filled in acquire and written out in produce.
+  // Each stream holds one event at a time so these are never shared between threads
+  unique_ptr< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > > L1TkTracksForOutput;
+  edm::Handle<L1TTTrackCollectionType> inputTracks;
+  const L1TTTrackType* tracks;  // tracks classified, the output copy or the input if not copied
+  vector<float> mvaValues[3];  // MVA1, MVA2 and MVA3 of each track if not copied
+  FeatureTransform::TrackColumns trackColumns;  // columns of the track members read by the features
+  vector<float> features;  // n_tracks x n_features, row major
+  vector<vector<float>> modelScores;  // of each model engine, one per classified track
+  vector<vector<float>> engineFeatures;  // copies of features for the engines run side by side
+  vector<float> engineScores;  // scores of the track and track word engines, one per track
+  vector<TrackWordBits> wordBits;  // of each track, for the track word engines
+  vector<uint64_t> trackWords;  // TrackWordFormat::pack of each track
+  vector<unsigned int> productColumns;  // column of each of in_features in the L1TrackFeatures product
+  vector<unsigned int> selected;  // index of each track passing the preselection, the rows of features
+
+  // Stage timings of this stream, null unless timingStats is set
+  unique_ptr<ClassifierStats> stats;
+  std::chrono::steady_clock::time_point submitted;  // when the event was handed to the batch queue
   
   const edm::EDGetTokenT<std::vector<TTTrack< Ref_Phase2TrackerDigi_ > > > trackToken;
+  edm::EDGetTokenT<L1TrackFeatures> featuresToken;
 
 };
 
 ///////////////
 //constructor//
 ///////////////
-L1TrackClassifier::L1TrackClassifier(const edm::ParameterSet& iConfig) :
+L1TrackClassifier::L1TrackClassifier(const edm::ParameterSet& iConfig, const L1TrackClassifierCache* cache) :
 trackToken(consumes< std::vector<TTTrack< Ref_Phase2TrackerDigi_> > > (iConfig.getParameter<edm::InputTag>("L1TrackInputTag"))){
   
 
   algorithm = (string)iConfig.getParameter<string>("Algorithm");
 
-  if ((algorithm == "Cut") | (algorithm == "All") ) {
-    // Track MET purity cut is included for comparision
-    cut_min_pt_ = (float)iConfig.getParameter<double>("minPt");
-    cut_max_z0_ = (float)iConfig.getParameter<double>("maxZ0");
-    cut_max_eta_ = (float)iConfig.getParameter<double>("maxEta");
-    cut_max_chi2_ = (float)iConfig.getParameter<double>("chi2dofMax");
-    cut_max_bendchi_ = (float)iConfig.getParameter<double>("bendchi2Max");
-    cut_min_nstubs_ = (int)iConfig.getParameter<int>("nStubsmin");
-            
-  }
-
-  
-  if ((algorithm == "GBDT") | (algorithm == "NN") | (algorithm == "All")) {
+  runModel = !cache->modelEngines.empty();
+  modelScores.resize(cache->modelEngines.size());
+  engineFeatures.resize(cache->modelEngines.size());
+  if (runModel) {
 
     in_features = iConfig.getParameter<vector<string>>("in_features");
 
     n_features = in_features.size();
-    // ONNX Neural Net and GBDT implementation
-
-    if ((algorithm == "GBDT") | (algorithm == "All")){
-      ONNX_path = edm::FileInPath(iConfig.getParameter<string>("GBDTIdONNXmodel")).fullPath();
-      ortinput_names.push_back(iConfig.getParameter<string>("GBDTIdONNXInputName"));
-      //ortoutput_names.push_back(iConfig.getParameter<string>("GBDTIdONNXOutputName"));
-
-    }
-    if (algorithm == "NN") {
-      ONNX_path = edm::FileInPath(iConfig.getParameter<string>("NNIdONNXmodel")).fullPath();
-      ortinput_names.push_back(iConfig.getParameter<string>("NNIdONNXInputName"));
-      ortoutput_names.push_back(iConfig.getParameter<string>("NNIdONNXOutputName"));
-    }
-    cout << "loading fake ID onnx model from " << ONNX_path << std::endl;
+    transformOptions.log_floor = (float)iConfig.getParameter<double>("logChi2Floor");
+    transformOptions.fast_log = iConfig.getParameter<bool>("fastLog");
+    transformOptions.scaling = cache->models.inputScaling();
+    featurePlan = FeatureTransform::FeaturePlan(in_features, transformOptions);
   
   }
 
-  produces< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > >( "Level1TTTracks" ).setBranchAlias("Level1TTTracks");
+  fromTrackWord = runModel && iConfig.getParameter<bool>("trackWordFeatures");
+  edm::InputTag featuresTag = iConfig.getParameter<edm::InputTag>("L1TrackFeaturesInputTag");
+  fromProduct = runModel && !featuresTag.label().empty();
+  if (fromProduct && fromTrackWord)
+    throw cms::Exception("Configuration") << "L1TrackFeaturesInputTag and trackWordFeatures cannot both be used";
+  if (fromProduct)
+    featuresToken = consumes<L1TrackFeatures>(featuresTag);
+
+  preselect = runModel && iConfig.getParameter<bool>("usePreselection");
+  if (preselect) {
+    preselection = TrackCuts::fromConfig(iConfig.getParameter<edm::ParameterSet>("preselection"));
+    preselectionScore = (float)iConfig.getParameter<double>("preselectionScore");
+  }
+
+#ifndef L1TRACKCLASSIFIER_NO_STATS
+  if (iConfig.getParameter<bool>("timingStats")) {
+    stats = make_unique<ClassifierStats>();
+    vector<string> engineNames;
+    for (const auto& engine : cache->engines)
+      engineNames.push_back(engine->name() + " MVA" + to_string(engine->mvaField()));
+    stats->setEngines(engineNames);
+  }
+#endif
+
+  selectedMVA = cache->engines.back()->mvaField();
+  string mode = iConfig.getParameter<string>("outputMode");
+  if (mode == "Tracks") {
+    outputMode = OutputMode::Tracks;
+    produces< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > >( "Level1TTTracks" ).setBranchAlias("Level1TTTracks");
+  } else if (mode == "ValueMap") {
+    outputMode = OutputMode::ValueMap;
+    produces<edm::ValueMap<float>>("MVA1");
+    produces<edm::ValueMap<float>>("MVA2");
+    produces<edm::ValueMap<float>>("MVA3");
+  } else if (mode == "Selected") {
+    outputMode = OutputMode::Selected;
+    const edm::ParameterSet& thresholds = iConfig.getParameter<edm::ParameterSet>("selectionThresholds");
+    if (!thresholds.exists(algorithm))
+      throw cms::Exception("Configuration") << "no selectionThresholds entry for Algorithm " << algorithm;
+    selectionThreshold = (float)thresholds.getParameter<double>(algorithm);
+    produces<L1TTTrackRefCollectionType>("Level1TTTracks");
+    produces<vector<float>>("MVA");
+    produces<unsigned int>("nSelected");
+  } else
+    throw cms::Exception("Configuration") << "unknown outputMode " << mode << ", Tracks, ValueMap or Selected";
 }
 
 //////////////
@@ -146,110 +263,299 @@ L1TrackClassifier::~L1TrackClassifier()
 
 }
 
-////////////
-//producer//
-////////////
-void L1TrackClassifier::produce(edm::Event& iEvent, const edm::EventSetup& iSetup) {
+////////////////
+//global cache//
+////////////////
+unique_ptr<L1TrackClassifierCache> L1TrackClassifier::initializeGlobalCache(const edm::ParameterSet& iConfig) {
+  // ONNX Neural Net and GBDT implementation, each model is loaded once here rather than per track
+  // or per stream, ONNXRuntime::run is const and thread safe
+  auto cache = make_unique<L1TrackClassifierCache>(iConfig);
+
+  if (iConfig.getParameter<bool>("useBatchQueue") && !cache->modelEngines.empty()) {
+    if (cache->modelEngines.size() > 1)
+      throw cms::Exception("Configuration") << "useBatchQueue runs a single model, allEngines has "
+                                            << cache->modelEngines.size();
+    const ClassifierEngine* model = cache->engines[cache->modelEngines.front()].get();
+    cache->queue = make_unique<InferenceBatchQueue>(
+        [model](vector<float>& batch, unsigned int n_rows, vector<float>& batch_scores) {
+          model->predict(batch, n_rows, batch_scores);
+        },
+        iConfig.getParameter<vector<string>>("in_features").size(),
+        iConfig.getParameter<unsigned int>("maxBatchSize"),
+        iConfig.getParameter<double>("maxBatchWait"));
+  }
+  return cache;
+}
 
-  //Get TTTracks
-  edm::Handle<L1TTTrackCollectionType> L1TTTrackHandle;
-  iEvent.getByToken(trackToken, L1TTTrackHandle);
-  L1TTTrackCollectionType::const_iterator trackIter;
-  
-  // Prepare output TTTracks
-  std::unique_ptr< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > > L1TkTracksForOutput( new std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > );
-  cout << algorithm << endl;
-  //Iterate through tracks
-  for (trackIter = L1TTTrackHandle->begin(); trackIter != L1TTTrackHandle->end(); ++trackIter) {
-
-    TTTrack< Ref_Phase2TrackerDigi_ > aTrack = *trackIter;
-        
-    if ((algorithm == "Cut") | (algorithm == "All")) {
-      trk_pt = aTrack.momentum().perp();
-      trk_bend_chi2 = aTrack.stubPtConsistency();
-      trk_z0 = aTrack.z0();
-      trk_eta = aTrack.momentum().eta();
-      trk_chi2 = aTrack.chi2();
-      const auto& stubRefs = aTrack.getStubRefs();
-      nStubs = stubRefs.size();
-
-      float classification = 0.0; // Default classification is 0
-
-      if (trk_pt >= cut_min_pt_ && 
-        abs(trk_z0) < cut_max_z0_ && 
-        abs(trk_eta) < cut_max_eta_ && 
-        trk_chi2 < cut_max_chi2_ && 
-        trk_bend_chi2 < cut_max_bendchi_ && 
-        nStubs >= cut_min_nstubs_) classification = 1.0;
-        // Classification updated to 1 if conditions are met
-
-        aTrack.settrkMVA1(classification);
-    }
+void L1TrackClassifier::globalEndJob(const L1TrackClassifierCache* cache) {
+  if (cache->queue)
+    cache->queue->printStats(cout);
+  if (cache->hasStats) {
+    cache->stats.print(cout);
+    if (!cache->timingStatsJson.empty())
+      cache->stats.writeJson(cache->timingStatsJson);
+  }
+}
 
+void L1TrackClassifier::endStream() {
+  if (!stats)
+    return;
+  lock_guard<mutex> lock(globalCache()->statsMutex);
+  globalCache()->stats.merge(*stats);
+  globalCache()->hasStats = true;
+}
 
-    if ((algorithm == "GBDT") | (algorithm == "NN") | (algorithm == "All")) {
-      
-      TransformedFeatures = FeatureTransform::Transform(aTrack,in_features); //Transform feautres
-      cms::Ort::ONNXRuntime Runtime(ONNX_path); //Setup ONNX runtime
+void L1TrackClassifier::setMVA(unsigned int k, size_t i, float value) {
+  if (outputMode != OutputMode::Tracks) {
+    mvaValues[k - 1][i] = value;
+    return;
+  }
+  TTTrack< Ref_Phase2TrackerDigi_ >& aTrack = (*L1TkTracksForOutput)[i];
+  if (k == 1)
+    aTrack.settrkMVA1(value);
+  else if (k == 2)
+    aTrack.settrkMVA2(value);
+  else
+    aTrack.settrkMVA3(value);
+}
 
-      //ONNX runtime recieves a vector of vectors of floats so push back the input
-      // vector of float to create a 1,1,21 ortinput
-      ortinput.push_back(TransformedFeatures);
+void L1TrackClassifier::setMVAs(unsigned int k, const float* values) {
+  size_t n_tracks = inputTracks->size();
+  if (outputMode != OutputMode::Tracks) {
+    std::copy(values, values + n_tracks, mvaValues[k - 1].begin());
+    return;
+  }
+  vector<L1TTTrackType>& output = *L1TkTracksForOutput;
+  if (k == 1)
+    for (size_t i = 0; i < n_tracks; ++i)
+      output[i].settrkMVA1(values[i]);
+  else if (k == 2)
+    for (size_t i = 0; i < n_tracks; ++i)
+      output[i].settrkMVA2(values[i]);
+  else
+    for (size_t i = 0; i < n_tracks; ++i)
+      output[i].settrkMVA3(values[i]);
+}
 
-      // batch_size 1 as only one set of transformed features is being processed
-      int batch_size = 1;
-      // Run classification on a batch of 1
-      ortoutputs = Runtime.run(ortinput_names,ortinput,ortoutput_names,batch_size); 
-      // access first value of nested vector
-      if (algorithm == "NN"){
-        aTrack.settrkMVA1(ortoutputs[0][0]);
-      }
+void L1TrackClassifier::predict(unsigned int m, unsigned int batch_size, bool copy_features) {
+  unsigned int index = globalCache()->modelEngines[m];
+  StageTimer timer(stats.get(), index);
+  if (copy_features) {
+    engineFeatures[m] = features;
+    globalCache()->engines[index]->predict(engineFeatures[m], batch_size, modelScores[m]);
+  } else
+    globalCache()->engines[index]->predict(features, batch_size, modelScores[m]);
+}
 
-      // The ortoutput_names vector for the GBDT is left blank due to issues returning the correct
-      // output, instead the GBDT will fill the ortoutputs with both the class prediciton and the class 
-      // probabilities. 
-      //ortoutputs[0][0] = class prediction based on a 0.5 threshold
-      //ortoutputs[1][0] = negative class probability
-      //ortoutputs[1][1] = positive class probability
-      
-      if (algorithm == "GBDT"){
-        aTrack.settrkMVA1(ortoutputs[1][1]);
-      }
+TrackWordBits L1TrackClassifier::trackWordBits(size_t i) const {
+  const L1TTTrackType& aTrack = tracks[i];
+  if (outputMode == OutputMode::Tracks)
+    return {aTrack.getRinvBits(), aTrack.getTanlBits(), aTrack.getZ0Bits(), aTrack.getChi2XYBits(),
+            aTrack.getChi2ZBits(), aTrack.getBendChi2Bits(), aTrack.getHitPatternBits()};
+  // The input tracks are const, their track word is not set
+  return globalCache()->models.trackWordFeatures()->format().digitize(aTrack);
+}
 
-      if (algorithm == "All"){
-        aTrack.settrkMVA3(ortoutputs[1][1]);
-      }
-      
-      // remove previous transformed feature ready for next track
-      ortinput.pop_back();
-    
+///////////
+//acquire//
+///////////
+void L1TrackClassifier::acquire(const edm::Event& iEvent, const edm::EventSetup& iSetup, edm::WaitingTaskWithArenaHolder holder) {
+
+  //Get TTTracks
+  {
+    StageTimer timer(stats.get(), ClassifierStats::Fetch);
+    iEvent.getByToken(trackToken, inputTracks);
+  }
+  size_t n_tracks = inputTracks->size();
+  if (stats)
+    stats->addEvent(n_tracks);
+
+  // Prepare output TTTracks, or unless outputMode is Tracks the MVA fields of the input tracks,
+  // which are then classified where they are
+  StageTimer copyTimer(stats.get(), ClassifierStats::Copy);
+  if (outputMode != OutputMode::Tracks) {
+    for (vector<float>& values : mvaValues)
+      values.resize(n_tracks);
+    for (size_t i = 0; i < n_tracks; ++i) {
+      mvaValues[0][i] = (*inputTracks)[i].trkMVA1();
+      mvaValues[1][i] = (*inputTracks)[i].trkMVA2();
+      mvaValues[2][i] = (*inputTracks)[i].trkMVA3();
     }
-  
-    else if ((algorithm == "None")){
-      // Default no algorithm
-      aTrack.settrkMVA1(-999);
-      aTrack.settrkMVA2(-999);
-      aTrack.settrkMVA3(-999);
+    tracks = inputTracks->data();
+  } else {
+    L1TkTracksForOutput.reset( new std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > );
+    L1TkTracksForOutput->reserve(n_tracks);
+    for (const L1TTTrackType& aTrack : *inputTracks) {
+      L1TkTracksForOutput->push_back(aTrack);
+      L1TkTracksForOutput->back().setTrackWordBits();
     }
-        
-    aTrack.setTrackWordBits();
-    L1TkTracksForOutput->push_back(aTrack);
+    tracks = L1TkTracksForOutput->data();
+  }
+  copyTimer.stop();
+
+  // Engines scoring the tracks themselves, the cuts or the -999 of None, and the preselection
+  StageTimer preselectionTimer(stats.get(), ClassifierStats::Preselection);
+  engineScores.resize(n_tracks);
+  for (unsigned int index : globalCache()->trackEngines) {
+    const ClassifierEngine& engine = *globalCache()->engines[index];
+    StageTimer timer(stats.get(), index);
+    engine.scoreTracks(tracks, n_tracks, engineScores.data());
+    setMVAs(engine.mvaField(), engineScores.data());
+  }
 
+  selected.clear();
+  if (preselect)
+    for (size_t i = 0; i < n_tracks; ++i)
+      if (preselection.pass(tracks[i]))
+        selected.push_back(i);
+  preselectionTimer.stop();
+
+  // Tracks sent to the model, all of them or the preselected ones
+  int batch_size = preselect ? selected.size() : n_tracks;
+  if (stats && runModel)
+    stats->addInferred(batch_size);
+
+  if (fromTrackWord) {
+    StageTimer timer(stats.get(), ClassifierStats::Pack);
+    const TrackWordFormat& format = globalCache()->models.trackWordFeatures()->format();
+    trackWords.clear();
+    for (int i = 0; i < batch_size; ++i)
+      trackWords.push_back(format.pack(trackWordBits(preselect ? selected[i] : i)));
   }
-  
-  iEvent.put( move(L1TkTracksForOutput), "Level1TTTracks");
 
-}
+  if (!globalCache()->wordEngines.empty()) {
+    // Integer emulation of the firmware, scored from the digitised track word
+    StageTimer timer(stats.get(), ClassifierStats::Inference);
+    wordBits.clear();
+    for (size_t i = 0; i < n_tracks; ++i)
+      wordBits.push_back(trackWordBits(i));
+    for (unsigned int index : globalCache()->wordEngines) {
+      const ClassifierEngine& engine = *globalCache()->engines[index];
+      StageTimer timer(stats.get(), index);
+      engine.scoreTrackWords(wordBits.data(), n_tracks, engineScores.data());
+      setMVAs(engine.mvaField(), engineScores.data());
+    }
+  }
 
-  
+  for (vector<float>& scores : modelScores)
+    scores.resize(batch_size);
+  if (!runModel || batch_size == 0)
+    return;
+
+  // The transformed features of every track in the event are stored row by row in a single
+  // contiguous n_tracks x n_features buffer so the whole event is classified in one ONNX run
+  StageTimer transformTimer(stats.get(), ClassifierStats::Transform);
+  features.resize(batch_size * n_features);
+  if (fromProduct) {
+    // Features of the same collection computed once by L1TrackFeatureProducer, the classifier
+    // only gathers its columns and applies the scaling of its model
+    edm::Handle<L1TrackFeatures> featuresHandle;
+    iEvent.getByToken(featuresToken, featuresHandle);
+    if (featuresHandle->nTracks() != n_tracks)
+      throw cms::Exception("Configuration") << "L1TrackFeatures product has " << featuresHandle->nTracks()
+                                            << " tracks but the track collection has " << n_tracks;
+    featuresHandle->checkTransform(transformOptions.log_floor, transformOptions.fast_log);
+    productColumns.clear();
+    for (const string& name : in_features)
+      productColumns.push_back(featuresHandle->index(name));
+    if (preselect)
+      featuresHandle->rows(productColumns, selected.data(), batch_size, features.data());
+    else
+      featuresHandle->rows(productColumns, features.data());
+    const FeatureScaling& scaling = globalCache()->models.inputScaling();
+    if (!scaling.identity())
+      for (size_t i = 0; i < features.size(); ++i)
+        features[i] = scaling[i % n_features].apply(features[i]);
+  } else if (fromTrackWord)
+    globalCache()->models.trackWordFeatures()->floatingPoint(trackWords.data(), batch_size, features.data());
+  else if (preselect)
+    featurePlan.transformBatch(tracks, selected.data(), batch_size, features.data(), FeatureTransform::Layout::RowMajor, trackColumns);
+  else
+    featurePlan.transformBatch(tracks, batch_size, features.data(), FeatureTransform::Layout::RowMajor, trackColumns);
+  transformTimer.stop();
+
+  if (globalCache()->queue) {
+    // The queue releases holder once the scores are written, produce then runs on a framework thread.
+    // The inference stage is then the wait for the batch, until produce
+    if (stats)
+      submitted = std::chrono::steady_clock::now();
+    globalCache()->queue->submit(features.data(), batch_size, modelScores[0].data(), move(holder));
+    return;
+  }
 
-// end producer
+  // Run classification once on the whole event, by every model engine on the same features. Side
+  // by side the engines lending the features to ONNX runtime get their own copy, and this thread
+  // runs the first engine while the others are in tasks other threads may take
+  StageTimer timer(stats.get(), ClassifierStats::Inference);
+  unsigned int n_models = modelScores.size();
+  if (globalCache()->parallelEngines && n_models > 1) {
+    tbb::task_group group;
+    for (unsigned int m = 1; m < n_models; ++m) {
+      bool copy = globalCache()->engines[globalCache()->modelEngines[m]]->lendsFeatures();
+      group.run([this, m, batch_size, copy] { predict(m, batch_size, copy); });
+    }
+    predict(0, batch_size, globalCache()->engines[globalCache()->modelEngines[0]]->lendsFeatures());
+    group.wait();
+  } else {
+    for (unsigned int m = 0; m < n_models; ++m)
+      predict(m, batch_size, false);
+  }
 
-void L1TrackClassifier::beginJob() {
 }
 
-void L1TrackClassifier::endJob() {
+////////////
+//producer//
+////////////
+void L1TrackClassifier::produce(edm::Event& iEvent, const edm::EventSetup& iSetup) {
+
+  if (stats && globalCache()->queue && runModel && !modelScores[0].empty())
+    stats->add(ClassifierStats::Inference, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                               std::chrono::steady_clock::now() - submitted).count());
+  StageTimer timer(stats.get(), ClassifierStats::Put);
+  if (runModel) {
+    // scatter the scores back to the tracks they were computed from, the tracks failing the
+    // preselection are given preselectionScore
+    for (unsigned int m = 0; m < modelScores.size(); ++m) {
+      const vector<float>& scores = modelScores[m];
+      unsigned int field = globalCache()->engines[globalCache()->modelEngines[m]]->mvaField();
+      if (preselect) {
+        for (size_t i = 0; i < inputTracks->size(); ++i)
+          setMVA(field, i, preselectionScore);
+        for (size_t j = 0; j < selected.size(); ++j)
+          setMVA(field, selected[j], scores[j]);
+      } else
+        setMVAs(field, scores.data());
+    }
+  }
+
+  if (outputMode == OutputMode::Selected) {
+    // Refs to the accepted input tracks, their scores in the same order and their number
+    const vector<float>& values = mvaValues[selectedMVA - 1];
+    auto selectedTracks = make_unique<L1TTTrackRefCollectionType>();
+    auto selectedScores = make_unique<vector<float>>();
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (values[i] > selectionThreshold) {
+        selectedTracks->push_back(edm::Ref<L1TTTrackCollectionType>(inputTracks, i));
+        selectedScores->push_back(values[i]);
+      }
+    }
+    auto nSelected = make_unique<unsigned int>(selectedTracks->size());
+    iEvent.put(move(selectedTracks), "Level1TTTracks");
+    iEvent.put(move(selectedScores), "MVA");
+    iEvent.put(move(nSelected), "nSelected");
+  } else if (outputMode == OutputMode::ValueMap) {
+    for (unsigned int k = 0; k < 3; ++k) {
+      auto valueMap = make_unique<edm::ValueMap<float>>();
+      edm::ValueMap<float>::Filler filler(*valueMap);
+      filler.insert(inputTracks, mvaValues[k].begin(), mvaValues[k].end());
+      filler.fill();
+      iEvent.put(move(valueMap), "MVA" + to_string(k + 1));
+    }
+  } else
+    iEvent.put( move(L1TkTracksForOutput), "Level1TTTracks");
 
 }
 
+// end producer
+
 DEFINE_FWK_MODULE(L1TrackClassifier);
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+ * L1TrackFeatureProducer
+ *
+ * An ED producer computing the classifier features of every L1 TTTrack of a collection once per
+ * event, into an L1TrackFeatures product with one column per feature. Any number of
+ * L1TrackClassifier instances (L1TrackFeaturesInputTag) and analysers can then read the features
+ * by token rather than each running the feature transform on the same tracks
+ *
+ * The features are computed by FeaturePlan::transformBatch writing the columns of the product
+ * directly, with the same log chi2 floor and FastLog options as the classifier
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/stream/EDProducer.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+
+using namespace std;
+
+class L1TrackFeatureProducer : public edm::stream::EDProducer<> {
+public:
+  explicit L1TrackFeatureProducer(const edm::ParameterSet&);
+
+private:
+  void produce(edm::Event&, const edm::EventSetup&) override;
+
+  const edm::EDGetTokenT<vector<TTTrack<Ref_Phase2TrackerDigi_> > > trackToken;
+  vector<string> featureNames;
+  float logFloor;
+  bool fastLog;
+  FeatureTransform::FeaturePlan featurePlan;
+  FeatureTransform::TrackColumns trackColumns;  // reused across the events of this stream
+};
+
+L1TrackFeatureProducer::L1TrackFeatureProducer(const edm::ParameterSet& iConfig)
+    : trackToken(consumes<vector<TTTrack<Ref_Phase2TrackerDigi_> > >(iConfig.getParameter<edm::InputTag>("L1TrackInputTag"))),
+      featureNames(iConfig.getParameter<vector<string> >("features")),
+      logFloor((float)iConfig.getParameter<double>("logChi2Floor")),
+      fastLog(iConfig.getParameter<bool>("fastLog")) {
+  FeatureTransform::TransformOptions transformOptions;
+  transformOptions.log_floor = logFloor;
+  transformOptions.fast_log = fastLog;
+  featurePlan = FeatureTransform::FeaturePlan(featureNames, transformOptions);
+
+  produces<L1TrackFeatures>();
+}
+
+void L1TrackFeatureProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup) {
+  edm::Handle<vector<TTTrack<Ref_Phase2TrackerDigi_> > > trackHandle;
+  iEvent.getByToken(trackToken, trackHandle);
+
+  auto features = make_unique<L1TrackFeatures>(featureNames, trackHandle->size(), logFloor, fastLog);
+  if (!trackHandle->empty())
+    featurePlan.transformBatch(trackHandle->data(), trackHandle->size(), features->data(),
+                               FeatureTransform::Layout::ColumnMajor, trackColumns);
+  iEvent.put(move(features));
+}
+
+DEFINE_FWK_MODULE(L1TrackFeatureProducer);
@@ -0,0 +1,62 @@
+/*
+ * L1TrackRecorder
+ *
+ * An ED analyser writing the tracks of each event, as classified by L1TrackClassifier, to a
+ * TrackRecordFile: the TTTrack members the feature transform and the cut read, and the MVA
+ * fields. The file is read back without CMSSW by test/replayTracks.cpp, which times the
+ * classifier engines on the recorded tracks and checks their scores against the recorded ones
+ *
+ * A one module, events are written in the order the framework processes them
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/one/EDAnalyzer.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+
+#include "L1Trigger/TrackQuality/interface/TrackRecordFile.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+
+using namespace std;
+
+class L1TrackRecorder : public edm::one::EDAnalyzer<> {
+public:
+  explicit L1TrackRecorder(const edm::ParameterSet&);
+
+private:
+  void analyze(const edm::Event&, const edm::EventSetup&) override;
+  void endJob() override;
+
+  const edm::EDGetTokenT<vector<TTTrack<Ref_Phase2TrackerDigi_> > > trackToken;
+  string fileName;
+  TrackRecordWriter writer;
+};
+
+L1TrackRecorder::L1TrackRecorder(const edm::ParameterSet& iConfig)
+    : trackToken(consumes<vector<TTTrack<Ref_Phase2TrackerDigi_> > >(iConfig.getParameter<edm::InputTag>("L1TrackInputTag"))),
+      fileName(iConfig.getParameter<string>("fileName")),
+      writer(fileName,
+             iConfig.getParameter<double>("BField"),
+             iConfig.getParameter<string>("Algorithm"),
+             iConfig.getParameter<bool>("compress")) {}
+
+void L1TrackRecorder::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup) {
+  edm::Handle<vector<TTTrack<Ref_Phase2TrackerDigi_> > > trackHandle;
+  iEvent.getByToken(trackToken, trackHandle);
+  writer.write(iEvent.id().event(), *trackHandle);
+}
+
+void L1TrackRecorder::endJob() {
+  writer.close();
+  edm::LogInfo("L1TrackRecorder") << "recorded the tracks of " << writer.nEvents() << " events to " << fileName;
+}
+
+DEFINE_FWK_MODULE(L1TrackRecorder);
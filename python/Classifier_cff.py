@@ -2,7 +2,35 @@ import FWCore.ParameterSet.Config as cms
 
 TrackClassifier = cms.EDProducer("L1TrackClassifier",
                                   L1TrackInputTag = cms.InputTag("TTTracksFromTrackletEmulation", "Level1TTTracks"), 
-                                  Algorithm = cms.string("None"), #None, Cut, NN, GBDT
+                                  Algorithm = cms.string("None"), #None, Cut, NN, NNNative, NNFixedPoint, GBDT, GBDTNative, GBDTQuickScorer, GBDTCompiled, GBDTFixedPoint, All
+
+                                  # All: up to three of Cut, NN, NNNative, GBDT, GBDTNative, GBDTQuickScorer and
+                                  # GBDTCompiled filling MVA1, MVA2 and MVA3 in this order. The features are
+                                  # computed once for all the models, which with parallelEngines classify them
+                                  # side by side in TBB tasks (experimental, off until validated in a release)
+                                  allEngines = cms.vstring("Cut", "NN", "GBDT"),
+                                  parallelEngines = cms.bool(False),
+
+                                  # Tracks: a copy of the input tracks with their MVA fields set, Level1TTTracks.
+                                  # ValueMap: only the MVA fields, as the ValueMaps MVA1, MVA2 and MVA3 of the
+                                  # input collection, read by track index downstream.
+                                  # Selected: refs to the input tracks scoring above the selectionThresholds
+                                  # entry of the Algorithm (the MVA of the last of allEngines for All, MVA1
+                                  # otherwise) as Level1TTTracks, their scores as MVA and their number as
+                                  # nSelected
+                                  outputMode = cms.string("Tracks"),
+                                  selectionThresholds = cms.PSet(
+                                      Cut = cms.double(0.5),
+                                      NN = cms.double(0.5),
+                                      NNNative = cms.double(0.5),
+                                      NNFixedPoint = cms.double(0.5),
+                                      GBDT = cms.double(0.5),
+                                      GBDTNative = cms.double(0.5),
+                                      GBDTQuickScorer = cms.double(0.5),
+                                      GBDTCompiled = cms.double(0.5),
+                                      GBDTFixedPoint = cms.double(0.5),
+                                      All = cms.double(0.5),
+                                  ),
 
                                   NNIdONNXmodel = cms.string("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx"),
                                   NNIdONNXInputName = cms.string("input_1"),
@@ -12,17 +40,73 @@ TrackClassifier = cms.EDProducer("L1TrackClassifier",
                                   GBDTIdONNXInputName = cms.string("feature_input"),
                                   GBDTIdONNXOutputName = cms.string("prediction"),
 
+                                  # Per feature standardisation of models trained on scaled inputs, a
+                                  # text file next to the .onnx (see interface/FeatureScaling.h), empty
+                                  # for none. Applied with the feature transform, or folded into the
+                                  # thresholds and weights of the native engines
+                                  NNIdScaling = cms.string(""),
+                                  GBDTIdScaling = cms.string(""),
+
                                   in_features = cms.vstring(["log_chi2","log_bendchi2","log_chi2rphi","log_chi2rz",
                                                              "nstubs","lay1_hits","lay2_hits","lay3_hits","lay4_hits",
                                                              "lay5_hits","lay6_hits","disk1_hits","disk2_hits",
                                                              "disk3_hits","disk4_hits","disk5_hits","rinv","tanl",
                                                              "z0","dtot","ltot"]),
 
+                                  # chi2 below logChi2Floor (0 and negative included) is raised to it before the log
+                                  # features, fastLog takes the logs of a batch with the SIMD FastLog
+                                  # (within 1 ulp, opt in as the scores move slightly) instead of std::log
+                                  logChi2Floor = cms.double( 1e-3 ),
+                                  fastLog = cms.bool(False),
+
+                                  # Features read from an L1TrackFeatureProducer product made from the same
+                                  # tracks (TrackFeatures_cff.py) rather than computed here, empty to compute
+                                  L1TrackFeaturesInputTag = cms.InputTag(""),
+
+                                  # Features of the float engines decoded from the packed track word, as the
+                                  # firmware sees the track, rather than from the TTTrack members. Not
+                                  # available for the pt and eta features
+                                  trackWordFeatures = cms.bool(False),
+
                                   maxZ0 = cms.double ( 15. ) ,    # in cm
                                   maxEta = cms.double ( 2.4 ) ,
                                   chi2dofMax = cms.double( 40. ),
                                   bendchi2Max = cms.double( 2.4 ),
                                   minPt = cms.double( 2. ),       # in GeV
                                   nStubsmin = cms.int32( 4 ),
+
+                                  # Cascade for the model algorithms: tracks failing the preselection, looser
+                                  # versions of the cuts above, are given preselectionScore straight away and
+                                  # only the others are transformed and classified
+                                  usePreselection = cms.bool(False),
+                                  preselectionScore = cms.double(0.),
+                                  preselection = cms.PSet(
+                                      minPt = cms.double( 2. ),        # in GeV
+                                      maxZ0 = cms.double( 20. ),       # in cm
+                                      maxEta = cms.double( 2.5 ),
+                                      chi2dofMax = cms.double( 100. ),
+                                      bendchi2Max = cms.double( 20. ),
+                                      nStubsmin = cms.int32( 0 ),      # tracks have 4 or more, 0 skips counting them
+                                  ),
+
+                                  # ExternalWork mode: tracks of several concurrent events are queued and
+                                  # classified together in batches of up to maxBatchSize tracks, a batch is
+                                  # run early once its oldest event has waited maxBatchWait
+                                  useBatchQueue = cms.bool(False),
+                                  maxBatchSize = cms.uint32( 4096 ),
+                                  maxBatchWait = cms.double( 500. ),   # in microseconds
+
+                                  # Per stage timing (fetch, copy, pack, transform, inference, put), per engine
+                                  # timing and tracks per event of every stream, printed at the end of the job
+                                  # and written as JSON to timingStatsJson if not empty
+                                  timingStats = cms.bool(False),
+                                  timingStatsJson = cms.string(""),
+
+                                  # GBDTFixedPoint and NNFixedPoint: integer emulation from the track word
+                                  # bits, in Vivado HLS ap_fixed<W,I[,quantisation[,overflow]]> types
+                                  fixedPointInput = cms.string("ap_fixed<16,6>"),    # features and NN activations
+                                  fixedPointWeight = cms.string("ap_fixed<16,5>"),   # leaf values, weights and biases
+                                  fixedPointAccum = cms.string("ap_fixed<24,8>"),    # sums
+                                  fixedPointResult = cms.string("ap_ufixed<16,0>"),  # score
                                   
     )
\ No newline at end of file
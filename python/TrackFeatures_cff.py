@@ -0,0 +1,16 @@
+import FWCore.ParameterSet.Config as cms
+
+# Features of every track computed once per event into an L1TrackFeatures product, read by the
+# classifiers through L1TrackFeaturesInputTag = cms.InputTag("L1TrackFeatures")
+L1TrackFeatures = cms.EDProducer("L1TrackFeatureProducer",
+                                 L1TrackInputTag = cms.InputTag("TTTracksFromTrackletEmulation", "Level1TTTracks"),
+                                 features = cms.vstring(["log_chi2","log_chi2rphi","log_chi2rz","log_bendchi2",
+                                                         "chi2","chi2rphi","chi2rz","bendchi2","nstubs",
+                                                         "lay1_hits","lay2_hits","lay3_hits","lay4_hits",
+                                                         "lay5_hits","lay6_hits","disk1_hits","disk2_hits",
+                                                         "disk3_hits","disk4_hits","disk5_hits","rinv","tanl",
+                                                         "z0","dtot","ltot","pt","eta","nlaymiss_interior"]),
+                                 # as logChi2Floor and fastLog of the classifiers
+                                 logChi2Floor = cms.double( 1e-3 ),
+                                 fastLog = cms.bool(False),
+    )
@@ -0,0 +1,12 @@
+import FWCore.ParameterSet.Config as cms
+
+# Writes the classified tracks of every event to a track record (interface/TrackRecordFile.h),
+# replayed without CMSSW by test/replayTracks.cpp. Algorithm and BField are those the tracks were
+# classified and fitted with, stored in the file for the replay
+TrackRecorder = cms.EDAnalyzer("L1TrackRecorder",
+                               L1TrackInputTag = cms.InputTag("TrackClassifier", "Level1TTTracks"),
+                               fileName = cms.string("tracks.l1tq"),
+                               compress = cms.bool(True),
+                               Algorithm = cms.string("None"),
+                               BField = cms.double( 3.8112 ),   # in T
+    )
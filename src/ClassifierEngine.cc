@@ -0,0 +1,119 @@
+#include "L1Trigger/TrackQuality/interface/ClassifierEngine.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "L1Trigger/TrackQuality/interface/CompiledTreeEnsemble.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FakeIDGBDTModel.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include <algorithm>
+#include <functional>
+#include <map>
+
+namespace {
+
+  typedef std::function<std::unique_ptr<const ClassifierEngine>(
+      const ONNXModelCache&, const edm::ParameterSet&, unsigned int mva_field)>
+      Maker;
+
+  // The GBDT compiled into the binary has no state, one instance serves every engine
+  const CompiledTreeEnsemble<FakeIDGBDTModel> compiledGBDT{};
+
+  // Makers of the engines run as an Algorithm of their own or as one of the engines of All, the
+  // models are those ONNXModelCache loaded for them
+  const std::map<std::string, Maker>& makers() {
+    static const std::map<std::string, Maker> makers = {
+        {"Cut",
+         [](const ONNXModelCache&, const edm::ParameterSet& iConfig, unsigned int mva_field) {
+           // Track MET purity cut is included for comparision
+           return std::make_unique<CutEngine>(TrackCuts::fromConfig(iConfig), mva_field);
+         }},
+        {"NN",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<ONNXEngine>("NN", *models.nn(), mva_field);
+         }},
+        {"GBDT",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<ONNXEngine>("GBDT", *models.gbdt(), mva_field);
+         }},
+        {"NNNative",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<NativeEngine<DenseNetwork>>("NNNative", *models.nnNative(), mva_field);
+         }},
+        {"GBDTNative",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<NativeEngine<TreeEnsemble>>("GBDTNative", *models.gbdtNative(), mva_field);
+         }},
+        {"GBDTQuickScorer",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<NativeEngine<QuickScorer>>("GBDTQuickScorer", *models.gbdtQuickScorer(), mva_field);
+         }},
+        {"GBDTCompiled",
+         [](const ONNXModelCache&, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<NativeEngine<CompiledTreeEnsemble<FakeIDGBDTModel>>>(
+               "GBDTCompiled", compiledGBDT, mva_field);
+         }},
+        {"NNFixedPoint",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<FixedPointEngine>(
+               "NNFixedPoint", *models.trackWordFeatures(), *models.fixedPoint(), mva_field);
+         }},
+        {"GBDTFixedPoint",
+         [](const ONNXModelCache& models, const edm::ParameterSet&, unsigned int mva_field) {
+           return std::make_unique<FixedPointEngine>(
+               "GBDTFixedPoint", *models.trackWordFeatures(), *models.fixedPoint(), mva_field);
+         }}};
+    return makers;
+  }
+
+}  // namespace
+
+ClassifierEngine::Engines ClassifierEngine::make(const std::string& algorithm,
+                                                 const ONNXModelCache& models,
+                                                 const edm::ParameterSet& iConfig) {
+  Engines engines;
+  if (algorithm == "None") {
+    // Default no algorithm
+    for (unsigned int field = 1; field <= 3; ++field)
+      engines.push_back(std::make_unique<ConstantEngine>(-999, field));
+    return engines;
+  }
+  if (algorithm != "All" && !makers().count(algorithm)) {
+    cms::Exception exception("Configuration");
+    exception << "unknown Algorithm " << algorithm << ", one of";
+    for (const std::string& name : algorithms())
+      exception << " " << name;
+    throw exception;
+  }
+  std::vector<std::string> names = engineNames(iConfig);
+  for (unsigned int i = 0; i < names.size(); ++i)
+    engines.push_back(makers().at(names[i])(models, iConfig, i + 1));
+  return engines;
+}
+
+std::vector<std::string> ClassifierEngine::algorithms() {
+  std::vector<std::string> names = {"None", "All"};
+  for (const auto& maker : makers())
+    names.push_back(maker.first);
+  return names;
+}
+
+std::vector<std::string> ClassifierEngine::engineNames(const edm::ParameterSet& iConfig) {
+  std::string algorithm = iConfig.getParameter<std::string>("Algorithm");
+  if (algorithm != "All")
+    return {algorithm};
+
+  // The engines of All share the transformed features of the event, the fixed point ones score
+  // the track word instead
+  std::vector<std::string> names = iConfig.getParameter<std::vector<std::string>>("allEngines");
+  if (names.empty() || names.size() > 3)
+    throw cms::Exception("Configuration") << "allEngines has " << names.size() << " engines, one to three fill MVA1 to MVA3";
+  for (auto name = names.begin(); name != names.end(); ++name) {
+    if (!makers().count(*name) || *name == "NNFixedPoint" || *name == "GBDTFixedPoint")
+      throw cms::Exception("Configuration") << "allEngines cannot run " << *name
+                                            << ", Cut, NN, NNNative, GBDT, GBDTNative, GBDTQuickScorer or GBDTCompiled";
+    if (std::find(names.begin(), name, *name) != name)
+      throw cms::Exception("Configuration") << "allEngines runs " << *name << " twice";
+  }
+  return names;
+}
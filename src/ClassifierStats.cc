@@ -0,0 +1,150 @@
+#include "L1Trigger/TrackQuality/interface/ClassifierStats.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+const char* const ClassifierStats::stage_names[n_stages] = {
+    "fetch", "copy", "preselect", "pack", "transform", "inference", "put"};
+
+// Values below 8 have a bucket each, above the 3 bits after the leading one select one of the 8
+// buckets of its power of two
+unsigned int ClassifierStats::Histogram::bucket(uint64_t value) {
+  if (value < 8)
+    return value;
+  unsigned int exponent = 63 - __builtin_clzll(value);
+  return 8 * (exponent - 2) + ((value >> (exponent - 3)) & 7);
+}
+
+uint64_t ClassifierStats::Histogram::lowerEdge(unsigned int bucket) {
+  return bucket < 8 ? bucket : uint64_t(8 + bucket % 8) << (bucket / 8 - 1);
+}
+
+uint64_t ClassifierStats::Histogram::width(unsigned int bucket) {
+  return bucket < 8 ? 1 : uint64_t(1) << (bucket / 8 - 1);
+}
+
+void ClassifierStats::Histogram::add(uint64_t value) {
+  ++counts_[bucket(value)];
+  ++count_;
+  sum_ += value;
+  max_ = std::max(max_, value);
+}
+
+void ClassifierStats::Histogram::merge(const Histogram& other) {
+  for (unsigned int i = 0; i < n_buckets; ++i)
+    counts_[i] += other.counts_[i];
+  count_ += other.count_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+double ClassifierStats::Histogram::quantile(double q) const {
+  if (!count_)
+    return 0;
+  uint64_t rank = std::max<uint64_t>(1, std::ceil(q * count_)), seen = 0;
+  for (unsigned int i = 0; i < n_buckets; ++i) {
+    seen += counts_[i];
+    if (seen >= rank)
+      return std::min(lowerEdge(i) + (width(i) - 1) / 2., double(max_));
+  }
+  return max_;
+}
+
+void ClassifierStats::setEngines(const std::vector<std::string>& names) {
+  engine_names_ = names;
+  engines_.assign(names.size(), Histogram());
+}
+
+void ClassifierStats::merge(const ClassifierStats& other) {
+  for (unsigned int stage = 0; stage < n_stages; ++stage)
+    stages_[stage].merge(other.stages_[stage]);
+  if (engines_.empty())
+    setEngines(other.engine_names_);
+  for (unsigned int engine = 0; engine < engines_.size(); ++engine)
+    engines_[engine].merge(other.engines_[engine]);
+  tracks_.merge(other.tracks_);
+  inferred_.merge(other.inferred_);
+}
+
+void ClassifierStats::print(std::ostream& os) const {
+  uint64_t total = 0;
+  for (const Histogram& stage : stages_)
+    total += stage.sum();
+
+  os << "L1TrackClassifier stages over " << tracks_.count() << " events, in us" << std::endl;
+  os << std::setw(12) << "stage" << std::setw(10) << "events" << std::setw(10) << "mean" << std::setw(10) << "p50"
+     << std::setw(10) << "p99" << std::setw(10) << "max" << std::setw(8) << "share" << std::endl;
+  os << std::fixed << std::setprecision(1);
+  auto printTime = [&](const std::string& name, const Histogram& histogram) {
+    os << std::setw(12) << name << std::setw(10) << histogram.count() << std::setw(10) << 1e-3 * histogram.mean()
+       << std::setw(10) << 1e-3 * histogram.quantile(0.5) << std::setw(10) << 1e-3 * histogram.quantile(0.99)
+       << std::setw(10) << 1e-3 * histogram.max();
+  };
+  for (unsigned int stage = 0; stage < n_stages; ++stage) {
+    const Histogram& histogram = stages_[stage];
+    if (!histogram.count())
+      continue;
+    printTime(stage_names[stage], histogram);
+    os << std::setw(7) << (total ? 100. * histogram.sum() / total : 0.) << "%" << std::endl;
+  }
+  // Already counted in the preselection and inference stages, the share is left out
+  for (unsigned int engine = 0; engine < engines_.size(); ++engine) {
+    if (!engines_[engine].count())
+      continue;
+    printTime(engine_names_[engine], engines_[engine]);
+    os << std::endl;
+  }
+  auto printTracks = [&](const char* name, const Histogram& histogram) {
+    os << std::setw(12) << name << std::setw(10) << histogram.count() << std::setw(10) << histogram.mean()
+       << std::setw(10) << histogram.quantile(0.5) << std::setw(10) << histogram.quantile(0.99) << std::setw(10)
+       << double(histogram.max()) << std::endl;
+  };
+  printTracks("tracks", tracks_);
+  if (inferred_.count()) {
+    printTracks("inferred", inferred_);
+    os << "model skipped for " << 100. * (1 - double(inferred_.sum()) / std::max<uint64_t>(tracks_.sum(), 1))
+       << "% of the tracks" << std::endl;
+  }
+  os << std::defaultfloat;
+}
+
+void ClassifierStats::writeJson(const std::string& path) const {
+  std::ofstream file(path);
+  if (!file)
+    throw cms::Exception("Configuration") << "cannot write the classifier stats to " << path;
+
+  auto write = [&](const Histogram& histogram, const char* unit) {
+    file << "{\"unit\": \"" << unit << "\", \"count\": " << histogram.count() << ", \"sum\": " << histogram.sum()
+         << ", \"mean\": " << histogram.mean() << ", \"p50\": " << histogram.quantile(0.5)
+         << ", \"p90\": " << histogram.quantile(0.9) << ", \"p99\": " << histogram.quantile(0.99)
+         << ", \"max\": " << histogram.max() << ", \"buckets\": [";
+    // [lower edge, count] of the non empty buckets
+    bool first = true;
+    for (unsigned int i = 0; i < Histogram::n_buckets; ++i) {
+      uint64_t count = histogram.bucketCount(i);
+      if (!count)
+        continue;
+      file << (first ? "" : ", ") << "[" << Histogram::lowerEdge(i) << ", " << count << "]";
+      first = false;
+    }
+    file << "]}";
+  };
+
+  file << "{\n  \"stages\": {";
+  for (unsigned int stage = 0; stage < n_stages; ++stage) {
+    file << (stage ? ",\n" : "\n") << "    \"" << stage_names[stage] << "\": ";
+    write(stages_[stage], "ns");
+  }
+  file << "\n  },\n  \"engines\": {";
+  for (unsigned int engine = 0; engine < engines_.size(); ++engine) {
+    file << (engine ? ",\n" : "\n") << "    \"" << engine_names_[engine] << "\": ";
+    write(engines_[engine], "ns");
+  }
+  file << "\n  },\n  \"tracks_per_event\": ";
+  write(tracks_, "tracks");
+  file << ",\n  \"inferred_per_event\": ";
+  write(inferred_, "tracks");
+  file << "\n}\n";
+}
@@ -0,0 +1,289 @@
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/ONNXReader.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+  // Outputs computed together by the kernel, the weights are packed to match
+  constexpr unsigned int panel = 4;
+
+  unsigned int padded(unsigned int width) { return (width + panel - 1) / panel * panel; }
+
+  // Dense layer while it is being folded, weights are [n_in][n_out] as in ONNX
+  struct Affine {
+    unsigned int n_in = 0;
+    unsigned int n_out = 0;
+    std::vector<float> weights;
+    std::vector<float> bias;
+  };
+
+  const ONNXReader::Tensor& initializer(const ONNXReader::Graph& graph, const ONNXReader::Node& node, unsigned int input) {
+    const ONNXReader::Tensor* tensor = input < node.inputs.size() ? graph.initializer(node.inputs[input]) : nullptr;
+    if (!tensor)
+      throw cms::Exception("DenseNetwork") << node.op_type << " node " << node.name << " input " << input
+                                           << " is not an initializer";
+    return *tensor;
+  }
+
+  // Per output values of size n, or a single value broadcast to all outputs
+  std::vector<float> perOutput(const ONNXReader::Tensor& tensor, unsigned int n) {
+    if (tensor.data.size() == 1)
+      return std::vector<float>(n, tensor.data[0]);
+    if (tensor.data.size() != n)
+      throw cms::Exception("DenseNetwork") << tensor.name << " has " << tensor.data.size() << " values, expected " << n;
+    return tensor.data;
+  }
+
+  float attributeF(const ONNXReader::Node& node, const std::string& name, float default_value) {
+    const ONNXReader::Attribute* attribute = node.attribute(name);
+    return attribute ? attribute->f : default_value;
+  }
+
+  int64_t attributeI(const ONNXReader::Node& node, const std::string& name, int64_t default_value) {
+    const ONNXReader::Attribute* attribute = node.attribute(name);
+    return attribute ? attribute->i : default_value;
+  }
+
+}  // namespace
+
+DenseNetwork::DenseNetwork(const std::string& onnx_path, const std::string& input_name, const std::string& output_name)
+    : n_features_(0), max_width_(0), lanes_(4) {
+  ONNXReader::Graph graph = ONNXReader::read(onnx_path);
+  auto input = std::find_if(graph.inputs.begin(), graph.inputs.end(), [&](const ONNXReader::ValueInfo& value_info) {
+    return value_info.name == input_name;
+  });
+  if (input == graph.inputs.end() || input->dims.size() != 2 || input->dims[1] <= 0)
+    throw cms::Exception("DenseNetwork") << onnx_path << " has no input " << input_name << " of shape [N, features]";
+  n_features_ = input->dims[1];
+
+  Affine affine;
+  unsigned int width = n_features_;
+  // Starts an identity layer, for nodes applied directly to an input or an activation
+  auto identity = [&]() {
+    affine.n_in = affine.n_out = width;
+    affine.weights.assign(width * width, 0);
+    for (unsigned int i = 0; i < width; ++i)
+      affine.weights[i * width + i] = 1;
+    affine.bias.assign(width, 0);
+  };
+  // Closes the dense layer being folded
+  auto close = [&](Activation activation, float alpha) {
+    if (affine.weights.empty())
+      identity();
+    Layer layer{affine.n_in, affine.n_out, {}, std::vector<float>(padded(affine.n_out), 0), activation, alpha};
+    layer.weights.assign(padded(affine.n_out) * affine.n_in, 0);
+    for (unsigned int o = 0; o < affine.n_out; ++o) {
+      layer.bias[o] = affine.bias[o];
+      for (unsigned int i = 0; i < affine.n_in; ++i)
+        layer.weights[((o / panel) * affine.n_in + i) * panel + o % panel] = affine.weights[i * affine.n_out + o];
+    }
+    layers_.push_back(layer);
+    max_width_ = std::max(max_width_, padded(std::max(affine.n_in, affine.n_out)));
+    affine = Affine();
+  };
+
+  // Follow the chain of nodes from the input, each node consuming the output of the previous one
+  std::string tensor = input_name;
+  while (tensor != output_name) {
+    auto node = std::find_if(graph.nodes.begin(), graph.nodes.end(), [&](const ONNXReader::Node& candidate) {
+      return !candidate.inputs.empty() && candidate.inputs[0] == tensor;
+    });
+    if (node == graph.nodes.end() || node->outputs.empty())
+      throw cms::Exception("DenseNetwork") << onnx_path << " has no path from " << input_name << " to " << output_name;
+    const std::string& op = node->op_type;
+
+    if (op == "MatMul" || op == "Gemm") {
+      if (!affine.weights.empty())
+        close(Activation::None, 0);
+      const ONNXReader::Tensor& b = initializer(graph, *node, 1);
+      bool transposed = op == "Gemm" && attributeI(*node, "transB", 0);
+      if (b.dims.size() != 2 || b.dims[transposed ? 1 : 0] != width || (op == "Gemm" && attributeI(*node, "transA", 0)))
+        throw cms::Exception("DenseNetwork") << op << " node " << node->name << " does not take a [N, " << width
+                                             << "] input";
+      affine.n_in = width;
+      affine.n_out = b.dims[transposed ? 0 : 1];
+      affine.weights = b.data;
+      if (transposed)
+        for (unsigned int i = 0; i < affine.n_in; ++i)
+          for (unsigned int o = 0; o < affine.n_out; ++o)
+            affine.weights[i * affine.n_out + o] = b.data[o * affine.n_in + i];
+      affine.bias.assign(affine.n_out, 0);
+      width = affine.n_out;
+      if (op == "Gemm") {
+        float alpha = attributeF(*node, "alpha", 1), beta = attributeF(*node, "beta", 1);
+        for (float& w : affine.weights)
+          w *= alpha;
+        if (node->inputs.size() > 2 && !node->inputs[2].empty()) {
+          std::vector<float> c = perOutput(initializer(graph, *node, 2), width);
+          for (unsigned int o = 0; o < width; ++o)
+            affine.bias[o] = beta * c[o];
+        }
+      }
+    } else if (op == "Add") {
+      if (affine.weights.empty())
+        identity();
+      std::vector<float> c = perOutput(initializer(graph, *node, 1), width);
+      for (unsigned int o = 0; o < width; ++o)
+        affine.bias[o] += c[o];
+    } else if (op == "BatchNormalization") {
+      // y = scale (x - mean) / sqrt(var + epsilon) + bias, folded into the weights and bias
+      if (affine.weights.empty())
+        identity();
+      std::vector<float> scale = perOutput(initializer(graph, *node, 1), width);
+      std::vector<float> bias = perOutput(initializer(graph, *node, 2), width);
+      std::vector<float> mean = perOutput(initializer(graph, *node, 3), width);
+      std::vector<float> var = perOutput(initializer(graph, *node, 4), width);
+      float epsilon = attributeF(*node, "epsilon", 1e-5);
+      for (unsigned int o = 0; o < width; ++o) {
+        float factor = scale[o] / std::sqrt(var[o] + epsilon);
+        for (unsigned int i = 0; i < affine.n_in; ++i)
+          affine.weights[i * width + o] *= factor;
+        affine.bias[o] = (affine.bias[o] - mean[o]) * factor + bias[o];
+      }
+    } else if (op == "Relu") {
+      close(Activation::Relu, 0);
+    } else if (op == "LeakyRelu") {
+      close(Activation::LeakyRelu, attributeF(*node, "alpha", 0.01));
+    } else if (op == "Sigmoid") {
+      close(Activation::Sigmoid, 0);
+    } else if (op == "Tanh") {
+      close(Activation::Tanh, 0);
+    } else if (op != "Identity") {
+      throw cms::Exception("DenseNetwork") << "unsupported operator " << op << " in " << onnx_path;
+    }
+    tensor = node->outputs[0];
+  }
+  if (!affine.weights.empty())
+    close(Activation::None, 0);
+  if (layers_.empty())
+    throw cms::Exception("DenseNetwork") << onnx_path << " has no layers between " << input_name << " and " << output_name;
+
+#if defined(__x86_64__)
+  if (__builtin_cpu_supports("avx512f"))
+    lanes_ = 16;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    lanes_ = 8;
+#endif
+}
+
+void DenseNetwork::foldScaling(const FeatureScaling& scaling) {
+  // w (x - offset) scale + b = (w scale) x + (b - w offset scale), per output in double
+  Layer& first = layers_.front();
+  for (unsigned int o = 0; o < first.n_out; ++o) {
+    double bias = first.bias[o];
+    for (unsigned int i = 0; i < first.n_in; ++i) {
+      float& weight = first.weights[((o / panel) * first.n_in + i) * panel + o % panel];
+      bias -= double(weight) * scaling[i].offset * scaling[i].scale;
+      weight = double(weight) * scaling[i].scale;
+    }
+    first.bias[o] = bias;
+  }
+}
+
+template <typename V>
+inline __attribute__((always_inline)) void DenseNetwork::predictLanes(const float* features,
+                                                                       unsigned int n_tracks,
+                                                                       float* scores) const {
+  constexpr unsigned int lanes = sizeof(V) / sizeof(float);
+  // Activations of a block of tracks, one vector of tracks per neuron. The vectors live in a
+  // plain float buffer aligned by hand, so no library code is instantiated for vector types whose
+  // calling convention depends on the target of the caller. The buffer is the thread's, grown once
+  // to the widest network so scoring does not allocate
+  thread_local std::vector<float> buffers;
+  if (buffers.size() < (2 * max_width_ + 1) * lanes)
+    buffers.resize((2 * max_width_ + 1) * lanes);
+  V* in = reinterpret_cast<V*>((reinterpret_cast<uintptr_t>(buffers.data()) + sizeof(V) - 1) / sizeof(V) * sizeof(V));
+  V* out = in + max_width_;
+  const Layer& last = layers_.back();
+
+  for (unsigned int first = 0; first < n_tracks; first += lanes) {
+    unsigned int n = std::min(lanes, n_tracks - first);
+    for (unsigned int i = 0; i < n_features_; ++i)
+      for (unsigned int j = 0; j < lanes; ++j)
+        in[i][j] = j < n ? features[size_t(first + j) * n_features_ + i] : 0.f;
+
+    for (const Layer& layer : layers_) {
+      for (unsigned int o = 0; o < layer.n_out; o += panel) {
+        const float* weights = &layer.weights[o * layer.n_in];
+        V acc0 = V{} + layer.bias[o], acc1 = V{} + layer.bias[o + 1];
+        V acc2 = V{} + layer.bias[o + 2], acc3 = V{} + layer.bias[o + 3];
+        for (unsigned int i = 0; i < layer.n_in; ++i, weights += panel) {
+          acc0 += in[i] * weights[0];
+          acc1 += in[i] * weights[1];
+          acc2 += in[i] * weights[2];
+          acc3 += in[i] * weights[3];
+        }
+        V* result = &out[o];
+        result[0] = acc0, result[1] = acc1, result[2] = acc2, result[3] = acc3;
+        for (unsigned int k = 0; k < panel; ++k) {
+          V& x = result[k];
+          switch (layer.activation) {
+            case Activation::None:
+              break;
+            // NaN passes through as in ONNX runtime, x != x only for NaN
+            case Activation::Relu:
+              x = (x > 0) | (x != x) ? x : V{};
+              break;
+            case Activation::LeakyRelu:
+              x = (x > 0) | (x != x) ? x : x * layer.alpha;
+              break;
+            case Activation::Sigmoid:
+              for (unsigned int j = 0; j < lanes; ++j)
+                x[j] = 1.f / (1.f + std::exp(-x[j]));
+              break;
+            case Activation::Tanh:
+              for (unsigned int j = 0; j < lanes; ++j)
+                x[j] = std::tanh(x[j]);
+              break;
+          }
+        }
+      }
+      std::swap(in, out);
+    }
+
+    for (unsigned int j = 0; j < n; ++j)
+      scores[first + j] = in[last.n_out - 1][j];
+  }
+}
+
+typedef float Float4 __attribute__((vector_size(16)));
+typedef float Float8 __attribute__((vector_size(32)));
+typedef float Float16 __attribute__((vector_size(64)));
+
+void DenseNetwork::predictDefault(const float* features, unsigned int n_tracks, float* scores) const {
+  predictLanes<Float4>(features, n_tracks, scores);
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2,fma"))) void DenseNetwork::predictAVX2(const float* features,
+                                                                     unsigned int n_tracks,
+                                                                     float* scores) const {
+  predictLanes<Float8>(features, n_tracks, scores);
+}
+
+__attribute__((target("avx512f"))) void DenseNetwork::predictAVX512(const float* features,
+                                                                      unsigned int n_tracks,
+                                                                      float* scores) const {
+  predictLanes<Float16>(features, n_tracks, scores);
+}
+#else
+void DenseNetwork::predictAVX2(const float* features, unsigned int n_tracks, float* scores) const {
+  predictLanes<Float4>(features, n_tracks, scores);
+}
+
+void DenseNetwork::predictAVX512(const float* features, unsigned int n_tracks, float* scores) const {
+  predictLanes<Float4>(features, n_tracks, scores);
+}
+#endif
+
+void DenseNetwork::predict(const float* features, unsigned int n_tracks, float* scores) const {
+  if (lanes_ == 16)
+    predictAVX512(features, n_tracks, scores);
+  else if (lanes_ == 8)
+    predictAVX2(features, n_tracks, scores);
+  else
+    predictDefault(features, n_tracks, scores);
+}
@@ -0,0 +1,114 @@
+#include "L1Trigger/TrackQuality/interface/FastLog.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+  typedef float Float4 __attribute__((vector_size(16)));
+  typedef float Float8 __attribute__((vector_size(32)));
+  typedef float Float16 __attribute__((vector_size(64)));
+  typedef int32_t Int4 __attribute__((vector_size(16)));
+  typedef int32_t Int8 __attribute__((vector_size(32)));
+  typedef int32_t Int16 __attribute__((vector_size(64)));
+
+  template <typename V, typename I>
+  inline __attribute__((always_inline)) void logVector(V& x, float floor) {
+    const float sqrt2 = 1.41421356237f;
+    // Raise to the floor, NaN fails the comparison and is kept
+    x = x < floor ? V{} + floor : x;
+
+    // x = m 2^e with m in [1, 2), then m in [sqrt(1/2), sqrt(2))
+    I bits = (I)x;
+    I e = ((bits >> 23) & 0xff) - 127;
+    V m = (V)((bits & 0x007fffff) | 0x3f800000);
+    I high = (I)(m > sqrt2);  // -1 where true
+    m = high ? m * 0.5f : m;
+    e -= high;
+    V fe = __builtin_convertvector(e, V);
+
+    // Cephes logf: log(1 + f) = f - f^2 / 2 + f^3 P(f)
+    V f = m - 1.f;
+    V z = f * f;
+    V y = V{} + 7.0376836292e-2f;
+    y = y * f - 1.1514610310e-1f;
+    y = y * f + 1.1676998740e-1f;
+    y = y * f - 1.2420140846e-1f;
+    y = y * f + 1.4249322787e-1f;
+    y = y * f - 1.6668057665e-1f;
+    y = y * f + 2.0000714765e-1f;
+    y = y * f - 2.4999993993e-1f;
+    y = y * f + 3.3333331174e-1f;
+    y = y * f * z;
+    // ln 2 split in two so e ln 2 is exact to float precision
+    y += fe * -2.12194440e-4f;
+    y -= 0.5f * z;
+    V result = f + y + fe * 0.693359375f;
+
+    // NaN and +inf pass through, their exponent field is all ones
+    x = (bits & 0x7f800000) == 0x7f800000 ? x : result;
+  }
+
+  template <typename V, typename I>
+  inline __attribute__((always_inline)) void logLanes(const float* in, float* out, size_t n, float floor) {
+    constexpr size_t lanes = sizeof(V) / sizeof(float);
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+      V x;
+      memcpy(&x, in + i, sizeof(V));
+      logVector<V, I>(x, floor);
+      memcpy(out + i, &x, sizeof(V));
+    }
+    if (i < n) {
+      // Tail padded with ones
+      V x = V{} + 1.f;
+      memcpy(&x, in + i, (n - i) * sizeof(float));
+      logVector<V, I>(x, floor);
+      memcpy(out + i, &x, (n - i) * sizeof(float));
+    }
+  }
+
+  void logDefault(const float* in, float* out, size_t n, float floor) { logLanes<Float4, Int4>(in, out, n, floor); }
+
+#if defined(__x86_64__)
+  __attribute__((target("avx2,fma"))) void logAVX2(const float* in, float* out, size_t n, float floor) {
+    logLanes<Float8, Int8>(in, out, n, floor);
+  }
+
+  __attribute__((target("avx512f"))) void logAVX512(const float* in, float* out, size_t n, float floor) {
+    logLanes<Float16, Int16>(in, out, n, floor);
+  }
+#endif
+
+  unsigned int detectLanes() {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f"))
+      return 16;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return 8;
+#endif
+    return 4;
+  }
+
+}  // namespace
+
+namespace FastLog {
+
+  unsigned int lanes() {
+    static const unsigned int lanes = detectLanes();
+    return lanes;
+  }
+
+  void log(const float* in, float* out, size_t n, float floor) {
+    floor = std::max(floor, FLT_MIN);
+#if defined(__x86_64__)
+    if (lanes() == 16)
+      return logAVX512(in, out, n, floor);
+    if (lanes() == 8)
+      return logAVX2(in, out, n, floor);
+#endif
+    logDefault(in, out, n, floor);
+  }
+
+}  // namespace FastLog
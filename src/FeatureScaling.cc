@@ -0,0 +1,64 @@
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+FeatureScaling::FeatureScaling(const std::string& path, const std::vector<std::string>& in_features)
+    : features_(in_features.size()) {
+  std::ifstream file(path);
+  if (!file)
+    throw cms::Exception("Configuration") << "cannot open feature scaling file " << path;
+
+  std::string line;
+  for (unsigned int line_number = 1; std::getline(file, line); ++line_number) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    std::string name, method;
+    if (!(fields >> name))
+      continue;
+    auto feature = std::find(in_features.begin(), in_features.end(), name);
+    if (feature == in_features.end())
+      throw cms::Exception("Configuration") << path << ":" << line_number << " feature " << name
+                                            << " is not in in_features";
+
+    std::vector<double> values;
+    double value;
+    fields >> method;
+    while (fields >> value)
+      values.push_back(value);
+    if (!fields.eof())
+      throw cms::Exception("Configuration") << path << ":" << line_number << " expected numbers after " << method;
+
+    Affine& affine = features_[feature - in_features.begin()];
+    if (method == "standard" && (values.size() == 2 || values.size() == 4) && values[1] > 0) {
+      affine.offset = values[0];
+      affine.scale = 1 / values[1];
+      if (values.size() == 4) {
+        affine.low = values[2];
+        affine.high = values[3];
+      }
+    } else if (method == "minmax" && values.size() == 2 && values[1] > values[0]) {
+      affine.low = affine.offset = values[0];
+      affine.high = values[1];
+      affine.scale = 1 / (values[1] - values[0]);
+    } else {
+      throw cms::Exception("Configuration") << path << ":" << line_number << " expected 'standard <mean> <std> "
+                                            << "[<low> <high>]' or 'minmax <min> <max>' with a positive std "
+                                            << "and max above min";
+    }
+  }
+}
+
+bool FeatureScaling::identity() const {
+  return std::all_of(features_.begin(), features_.end(), [](const Affine& affine) { return affine.identity(); });
+}
+
+FeatureScaling FeatureScaling::clipping() const {
+  FeatureScaling clips(*this);
+  for (Affine& affine : clips.features_) {
+    affine.offset = 0;
+    affine.scale = 1;
+  }
+  return clips;
+}
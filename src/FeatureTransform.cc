@@ -1,174 +1,231 @@
+
 /*
 Function to transform TTTrackWord variables into those used by ML models
 Inputs a TTTrack and returns a vector of floats of dimension (1,n_training_features)
 This file is specific to the training of the ML model and should be adapted accordingly
+The feature names are resolved once by FeaturePlan, after which each track writes the
+requested features, clipped and scaled if the model asks for it, straight into the caller's row
 */
 #include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
-#include <iostream>
-#include <memory>
+#include "L1Trigger/TrackQuality/interface/FastLog.h"
+#include "L1Trigger/TrackQuality/interface/HitPatternTable.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <map>
 #include <string>
 
 namespace FeatureTransform {
 
+FeaturePlan::FeaturePlan(const std::vector<std::string>& in_features, const TransformOptions& options)
+    : options_(options) {
+  static const std::map<std::string, Feature> names = {
+      {"log_chi2", Feature::LogChi2},     {"log_chi2rphi", Feature::LogChi2RPhi},
+      {"log_chi2rz", Feature::LogChi2RZ}, {"log_bendchi2", Feature::LogBendChi2},
+      {"chi2", Feature::Chi2},            {"chi2rphi", Feature::Chi2RPhi},
+      {"chi2rz", Feature::Chi2RZ},        {"bendchi2", Feature::BendChi2},
+      {"nstubs", Feature::NStubs},        {"lay1_hits", Feature::Lay1Hits},
+      {"lay2_hits", Feature::Lay2Hits},   {"lay3_hits", Feature::Lay3Hits},
+      {"lay4_hits", Feature::Lay4Hits},   {"lay5_hits", Feature::Lay5Hits},
+      {"lay6_hits", Feature::Lay6Hits},   {"disk1_hits", Feature::Disk1Hits},
+      {"disk2_hits", Feature::Disk2Hits}, {"disk3_hits", Feature::Disk3Hits},
+      {"disk4_hits", Feature::Disk4Hits}, {"disk5_hits", Feature::Disk5Hits},
+      {"rinv", Feature::RInv},            {"tanl", Feature::TanL},
+      {"z0", Feature::Z0},                {"dtot", Feature::DTot},
+      {"ltot", Feature::LTot},            {"pt", Feature::Pt},
+      {"eta", Feature::Eta},              {"nlaymiss_interior", Feature::NLayMissInterior}};
+
+  for (const std::string& name : in_features) {
+    auto feature = names.find(name);
+    if (feature == names.end())
+      throw cms::Exception("Configuration") << "unknown feature " << name << " in in_features";
+    features_.push_back(feature->second);
+    needs_hits_ |= feature->second == Feature::NStubs || feature->second == Feature::DTot ||
+                   feature->second == Feature::LTot || feature->second == Feature::NLayMissInterior ||
+                   (feature->second >= Feature::Lay1Hits && feature->second <= Feature::Disk5Hits);
+    needs_pt_ |= feature->second == Feature::Pt;
+  }
+  scaled_ = !options_.scaling.identity();
+}
 
-std::vector<float> Transform(TTTrack < Ref_Phase2TrackerDigi_ > aTrack, std::vector<std::string> in_features){
-
-    // List input features for MVA in proper order below, the features options are 
-    // {"log_chi2","log_chi2rphi","log_chi2rz","log_bendchi2","nstubs","lay1_hits","lay2_hits",
-    // "lay3_hits","lay4_hits","lay5_hits","lay6_hits","disk1_hits","disk2_hits","disk3_hits",
-    // "disk4_hits","disk5_hits","rinv","tanl","z0","dtot","ltot","chi2","chi2rz","chi2rphi",
-    // "bendchi2","pt","eta","nlaymiss_interior"}
-    
-    std::vector<float> transformed_features;
-
-    // The following converts the 7 bit hitmask in the TTTrackword to an expected
-    // 11 bit hitmask based on the eta of the track
-    std::vector<int> hitpattern_binary = {0,0,0,0,0,0,0};
-    std::vector<int> hitpattern_expanded_binary = {0,0,0,0,0,0,0,0,0,0,0,0};
-    std::vector<float> eta_bins = {0.0,0.2,0.41,0.62,0.9,1.26,1.68,2.08,2.4};
-
-
-    // Expected hitmap table, each row corresponds to an eta bin, each value corresponds to 
-    // the expected layer in the expanded hit pattern. The expanded hit pattern should be
-    // 11 bits but contains a 12th element so this hitmap table is symmetric, the 12th element 
-    // is removed.
-    int hitmap[8][7] = {{0, 1,  2,  3,  4,  5,  11},
-                        {0, 1,  2,  3,  4,  5,  11},
-                        {0, 1,  2,  3,  4,  5,  11},
-                        {0, 1,  2,  3,  4,  5,  11},
-                        {0, 1,  2,  3,  4,  5,  11},
-                        {0, 1,  2,  6,  7,  8,  9 },
-                        {0, 1,  7,  8,  9, 10,  11},
-                        {0, 6,  7,  8,  9, 10,  11}};
-
-    // iterate through bits of the hitpattern and compare to 1 filling the hitpattern binary vector
-    int tmp_trk_hitpattern = aTrack.hitPattern();
-    for (int i = 6; i >=0; i--){
-      int k = tmp_trk_hitpattern >> i;
-            if (k&1)
-                hitpattern_binary[i] = 1;
-        }
-
-    // calculate number of missed interior layers from hitpattern
-    int nbits = floor(log2(tmp_trk_hitpattern)) + 1;
-    int lay_i = 0;
-    int tmp_trk_nlaymiss_interior = 0;
-    bool seq = 0;
-    for (int i=0; i<nbits; i++){
-      lay_i = ((1<<i)&tmp_trk_hitpattern)>>i; //0 or 1 in ith bit (right to left)
-    
-      if (lay_i && !seq) seq = 1; //sequence starts when first 1 found
-      if (!lay_i && seq) tmp_trk_nlaymiss_interior++;
-    }
+float FeaturePlan::log(double chi2) const {
+  float x = chi2;
+  if (options_.fast_log) {
+    FastLog::log(&x, &x, 1, options_.log_floor);
+    return x;
+  }
+  // The FastLog guard, NaN fails the comparison and is kept
+  float floor = std::max(options_.log_floor, FLT_MIN);
+  return ::log(x < floor ? floor : x);
+}
+
+void TrackColumns::resize(size_t n_tracks) {
+  for (std::vector<float>* column : {&chi2, &chi2rphi, &chi2rz, &bendchi2, &tanl, &z0, &pt, &eta, &ltot, &dtot,
+                                     &nlaymiss_interior, &logs})
+    column->resize(n_tracks);
+  rinv.resize(n_tracks);
+  hitpattern.resize(n_tracks);
+  expanded.resize(n_tracks);
+}
+
+// Copies the members of track(i), i < n_tracks, into the columns, the momentum is only unpacked
+// when pt is a feature
+template <typename TrackAt>
+static void gatherColumns(TrackAt track, size_t n_tracks, bool needs_pt, TrackColumns& columns) {
+  columns.resize(n_tracks);
+  for (size_t i = 0; i < n_tracks; ++i) {
+    const TTTrack<Ref_Phase2TrackerDigi_>& aTrack = track(i);
+    columns.chi2[i] = aTrack.chi2();
+    columns.chi2rphi[i] = aTrack.chi2XY();
+    columns.chi2rz[i] = aTrack.chi2Z();
+    columns.bendchi2[i] = aTrack.stubPtConsistency();
+    columns.rinv[i] = aTrack.rInv();
+    columns.tanl[i] = aTrack.tanL();
+    columns.z0[i] = aTrack.z0();
+    columns.eta[i] = aTrack.eta();
+    columns.hitpattern[i] = aTrack.hitPattern();
+    if (needs_pt)
+      columns.pt[i] = aTrack.momentum().perp();
+  }
+}
 
+void FeaturePlan::transformBatch(const TTTrack<Ref_Phase2TrackerDigi_>* tracks,
+                                 size_t n_tracks,
+                                 float* out,
+                                 Layout layout,
+                                 TrackColumns& columns) const {
+  // First pass: one walk over the tracks copying the members into columns
+  gatherColumns([tracks](size_t i) -> const TTTrack<Ref_Phase2TrackerDigi_>& { return tracks[i]; },
+                n_tracks, needs_pt_, columns);
+  transformColumns(n_tracks, out, layout, columns);
+}
+
+void FeaturePlan::transformBatch(const TTTrack<Ref_Phase2TrackerDigi_>* tracks,
+                                 const unsigned int* selected,
+                                 size_t n_selected,
+                                 float* out,
+                                 Layout layout,
+                                 TrackColumns& columns) const {
+  gatherColumns([tracks, selected](size_t i) -> const TTTrack<Ref_Phase2TrackerDigi_>& { return tracks[selected[i]]; },
+                n_selected, needs_pt_, columns);
+  transformColumns(n_selected, out, layout, columns);
+}
 
-    float eta = abs(aTrack.eta());
-    int eta_size = static_cast<int>(eta_bins.size());
-    // First iterate through eta bins
-
-    for (int j=0; j<eta_size; j++)
-        {
-          if (eta >= eta_bins[j] && eta < eta_bins[j+1]) // if track in eta bin
-          {
-              // Iterate through hitpattern binary
-              for (int k=0; k<6; k++)
-                  // Fill expanded binary entries using the expected hitmap table positions 
-                  hitpattern_expanded_binary[hitmap[j][k]] = hitpattern_binary[k];   
-          }
-        }
-
-    hitpattern_expanded_binary.pop_back(); //remove final unused bit
-    int tmp_trk_ltot;
-    //calculate number of layer hits
-    for (int i=0; i<6; ++i)
-    {
-      tmp_trk_ltot += hitpattern_expanded_binary[i];
+void FeaturePlan::transformColumns(size_t n_tracks, float* out, Layout layout, TrackColumns& columns) const {
+  if (needs_hits_) {
+    for (size_t i = 0; i < n_tracks; ++i) {
+      const HitPatternTable::Entry& hits = HitPatternTable::lookup(columns.hitpattern[i], std::abs(columns.eta[i]));
+      columns.expanded[i] = hits.expanded;
+      columns.ltot[i] = hits.ltot;
+      columns.dtot[i] = hits.dtot;
+      columns.nlaymiss_interior[i] = hits.nlaymiss_interior;
+    }
+  }
+
+  // Second pass: each feature over all tracks, element i of feature f written to
+  // out[i * track_stride + f * feature_stride]
+  size_t track_stride = layout == Layout::RowMajor ? features_.size() : 1;
+  size_t feature_stride = layout == Layout::RowMajor ? 1 : n_tracks;
+  for (size_t f = 0; f < features_.size(); ++f) {
+    float* column = out + f * feature_stride;
+    const FeatureScaling::Affine& scaling = options_.scaling[f];
+    auto fill = [&](auto value) {
+      if (scaling.identity()) {
+        for (size_t i = 0; i < n_tracks; ++i)
+          column[i * track_stride] = value(i);
+      } else {
+        for (size_t i = 0; i < n_tracks; ++i)
+          column[i * track_stride] = scaling.apply(value(i));
+      }
+    };
+    auto fillLog = [&](const std::vector<float>& chi2) {
+      if (!options_.fast_log)
+        return fill([&](size_t i) { return log(chi2[i]); });
+      FastLog::log(chi2.data(), columns.logs.data(), n_tracks, options_.log_floor);
+      fill([&](size_t i) { return columns.logs[i]; });
+    };
+    switch (features_[f]) {
+      case Feature::LogChi2: fillLog(columns.chi2); break;
+      case Feature::LogChi2RPhi: fillLog(columns.chi2rphi); break;
+      case Feature::LogChi2RZ: fillLog(columns.chi2rz); break;
+      case Feature::LogBendChi2: fillLog(columns.bendchi2); break;
+      case Feature::Chi2: fill([&](size_t i) { return columns.chi2[i]; }); break;
+      case Feature::Chi2RPhi: fill([&](size_t i) { return columns.chi2rphi[i]; }); break;
+      case Feature::Chi2RZ: fill([&](size_t i) { return columns.chi2rz[i]; }); break;
+      case Feature::BendChi2: fill([&](size_t i) { return columns.bendchi2[i]; }); break;
+      case Feature::NStubs: fill([&](size_t i) { return columns.ltot[i] + columns.dtot[i]; }); break;
+      case Feature::Lay1Hits: case Feature::Lay2Hits: case Feature::Lay3Hits: case Feature::Lay4Hits:
+      case Feature::Lay5Hits: case Feature::Lay6Hits: case Feature::Disk1Hits: case Feature::Disk2Hits:
+      case Feature::Disk3Hits: case Feature::Disk4Hits: case Feature::Disk5Hits: {
+        int bit = int(features_[f]) - int(Feature::Lay1Hits);
+        fill([&](size_t i) { return float((columns.expanded[i] >> bit) & 1); });
+        break;
+      }
+      case Feature::RInv: fill([&](size_t i) { return 500 * std::abs(columns.rinv[i]); }); break;
+      case Feature::TanL: fill([&](size_t i) { return std::abs(columns.tanl[i]); }); break;
+      case Feature::Z0: fill([&](size_t i) { return std::abs(columns.z0[i]); }); break;
+      case Feature::DTot: fill([&](size_t i) { return columns.dtot[i]; }); break;
+      case Feature::LTot: fill([&](size_t i) { return columns.ltot[i]; }); break;
+      case Feature::Pt: fill([&](size_t i) { return columns.pt[i]; }); break;
+      case Feature::Eta: fill([&](size_t i) { return columns.eta[i]; }); break;
+      case Feature::NLayMissInterior: fill([&](size_t i) { return columns.nlaymiss_interior[i]; }); break;
     }
-    
+  }
+}
 
-    int tmp_trk_dtot;
-    //calculate number of disk hits
-    for (int i=6; i<11; ++i)
-    {
-      tmp_trk_dtot += hitpattern_expanded_binary[i];
+void FeaturePlan::transform(const TTTrack<Ref_Phase2TrackerDigi_>& aTrack, float* row) const {
+
+  // The hit pattern converted to the expected 11 bit hitmask based on the eta of the track
+  HitPatternTable::Entry hits = {0, 0, 0, 0, 0};
+  if (needs_hits_)
+    hits = HitPatternTable::lookup(aTrack.hitPattern(), std::abs(aTrack.eta()));
+
+  for (size_t i = 0; i < features_.size(); ++i) {
+    float value = 0;
+    switch (features_[i]) {
+      case Feature::LogChi2: value = log(aTrack.chi2()); break;
+      case Feature::LogChi2RPhi: value = log(aTrack.chi2XY()); break;
+      case Feature::LogChi2RZ: value = log(aTrack.chi2Z()); break;
+      case Feature::LogBendChi2: value = log(aTrack.stubPtConsistency()); break;
+      case Feature::Chi2: value = aTrack.chi2(); break;
+      case Feature::Chi2RPhi: value = aTrack.chi2XY(); break;
+      case Feature::Chi2RZ: value = aTrack.chi2Z(); break;
+      case Feature::BendChi2: value = aTrack.stubPtConsistency(); break;
+      case Feature::NStubs: value = hits.nstubs; break;
+      case Feature::Lay1Hits: case Feature::Lay2Hits: case Feature::Lay3Hits: case Feature::Lay4Hits:
+      case Feature::Lay5Hits: case Feature::Lay6Hits: case Feature::Disk1Hits: case Feature::Disk2Hits:
+      case Feature::Disk3Hits: case Feature::Disk4Hits: case Feature::Disk5Hits:
+        value = (hits.expanded >> (int(features_[i]) - int(Feature::Lay1Hits))) & 1;
+        break;
+      case Feature::RInv: value = 500 * std::abs(aTrack.rInv()); break;
+      case Feature::TanL: value = std::abs(aTrack.tanL()); break;
+      case Feature::Z0: value = std::abs(aTrack.z0()); break;
+      case Feature::DTot: value = hits.dtot; break;
+      case Feature::LTot: value = hits.ltot; break;
+      case Feature::Pt: value = aTrack.momentum().perp(); break;
+      case Feature::Eta: value = aTrack.eta(); break;
+      case Feature::NLayMissInterior: value = hits.nlaymiss_interior; break;
     }
+    row[i] = scaled_ ? options_.scaling[i].apply(value) : value;
+  }
+}
 
-    
-    // While not strictly necessary to define these parameters,
-    // it is included so each variable is named to avoid confusion
-    float tmp_trk_big_invr   = 500*abs(aTrack.rInv());
-    float tmp_trk_tanl  = abs(aTrack.tanL());
-    float tmp_trk_z0   = abs( aTrack.z0() );
-    float tmp_trk_pt = aTrack.momentum().perp();
-    float tmp_trk_eta = aTrack.eta();
-    float tmp_trk_chi2 = aTrack.chi2();
-    float tmp_trk_chi2rphi = aTrack.chi2XY();
-    float tmp_trk_chi2rz = aTrack.chi2Z();
-    float tmp_trk_bendchi2 = aTrack.stubPtConsistency();
-    float tmp_trk_log_chi2 = log(tmp_trk_chi2);
-    float tmp_trk_log_chi2rphi = log(tmp_trk_chi2rphi);
-    float tmp_trk_log_chi2rz = log(tmp_trk_chi2rz);
-    float tmp_trk_log_bendchi2 = log(tmp_trk_bendchi2);
-
-    // fill feature map
-    std::map<std::string,float> feat_map; 
-    feat_map["log_chi2"] = tmp_trk_log_chi2;
-    feat_map["log_chi2rphi"] = tmp_trk_log_chi2rphi;
-    feat_map["log_chi2rz"] = tmp_trk_log_chi2rz;
-    feat_map["log_bendchi2"] = tmp_trk_log_bendchi2;
-    feat_map["chi2"] = tmp_trk_chi2;
-    feat_map["chi2rphi"] = tmp_trk_chi2rphi;
-    feat_map["chi2rz"] = tmp_trk_chi2rz;
-    feat_map["bendchi2"] = tmp_trk_bendchi2;
-    feat_map["nstubs"] = float(tmp_trk_dtot+tmp_trk_ltot);
-    feat_map["lay1_hits"] = float(hitpattern_expanded_binary[0]);
-    feat_map["lay2_hits"] = float(hitpattern_expanded_binary[1]);
-    feat_map["lay3_hits"] = float(hitpattern_expanded_binary[2]);
-    feat_map["lay4_hits"] = float(hitpattern_expanded_binary[3]);
-    feat_map["lay5_hits"] = float(hitpattern_expanded_binary[4]);
-    feat_map["lay6_hits"] = float(hitpattern_expanded_binary[5]);
-    feat_map["disk1_hits"] = float(hitpattern_expanded_binary[6]);
-    feat_map["disk2_hits"] = float(hitpattern_expanded_binary[7]);
-    feat_map["disk3_hits"] = float(hitpattern_expanded_binary[8]);
-    feat_map["disk4_hits"] = float(hitpattern_expanded_binary[9]);
-    feat_map["disk5_hits"] = float(hitpattern_expanded_binary[10]);
-    feat_map["rinv"] = tmp_trk_big_invr;
-    feat_map["tanl"] = tmp_trk_tanl;
-    feat_map["z0"] = tmp_trk_z0;
-    feat_map["dtot"] = float(tmp_trk_dtot);
-    feat_map["ltot"] = float(tmp_trk_ltot);
-    feat_map["pt"] = tmp_trk_pt;
-    feat_map["eta"] = tmp_trk_eta;
-    feat_map["nlaymiss_interior"] = float(tmp_trk_nlaymiss_interior);
-
-    // fill tensor with track params
-    for (std::string feat : in_features) 
-      transformed_features.push_back(feat_map[feat]);
-    /*transformed_features.push_back(float(tmp_trk_log_chi2));
-    transformed_features.push_back(float(tmp_trk_log_chi2rphi));
-    transformed_features.push_back(float(tmp_trk_log_chi2rz));
-    transformed_features.push_back(float(tmp_trk_log_bendchi2));
-    transformed_features.push_back(float(tmp_trk_dtot+tmp_trk_ltot)); //nstubs
-    transformed_features.push_back(float(hitpattern_expanded_binary[0]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[1]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[2]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[3]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[4]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[5]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[6]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[7]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[8]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[9]));
-    transformed_features.push_back(float(hitpattern_expanded_binary[10]));
-    transformed_features.push_back(float(tmp_trk_big_invr));
-    transformed_features.push_back(float(tmp_trk_tanl));
-    transformed_features.push_back(float(tmp_trk_z0));
-    transformed_features.push_back(float(tmp_trk_dtot));
-    transformed_features.push_back(float(tmp_trk_ltot));*/
-
-    return transformed_features;
+std::vector<float> Transform(const TTTrack<Ref_Phase2TrackerDigi_>& aTrack, const std::vector<std::string>& in_features) {
+  FeaturePlan plan(in_features);
+  std::vector<float> transformed_features(plan.nFeatures());
+  plan.transform(aTrack, transformed_features.data());
+  return transformed_features;
+}
 
-    }
+std::vector<float> TransformBatch(const std::vector<TTTrack<Ref_Phase2TrackerDigi_>>& tracks,
+                                  const std::vector<std::string>& in_features,
+                                  Layout layout) {
+  FeaturePlan plan(in_features);
+  TrackColumns columns;
+  std::vector<float> transformed_features(tracks.size() * plan.nFeatures());
+  plan.transformBatch(tracks.data(), tracks.size(), transformed_features.data(), layout, columns);
+  return transformed_features;
 }
 
+}  // namespace FeatureTransform
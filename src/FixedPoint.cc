@@ -0,0 +1,88 @@
+#include "L1Trigger/TrackQuality/interface/FixedPoint.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <regex>
+#include <sstream>
+
+FixedPointType::FixedPointType(const std::string& type) {
+  static const std::regex pattern(
+      R"(\s*ap_(u?)fixed\s*<\s*(\d+)\s*,\s*(-?\d+)\s*(?:,\s*(AP_\w+)\s*)?(?:,\s*(AP_\w+)\s*)?>\s*)");
+  std::smatch match;
+  if (!std::regex_match(type, match, pattern))
+    throw cms::Exception("Configuration") << "cannot parse fixed point type " << type
+                                          << ", expected ap_fixed<W,I> or ap_ufixed<W,I> with optional modes";
+
+  Quantisation q = Quantisation::TRN;
+  Overflow o = Overflow::WRAP;
+  for (unsigned int group : {4, 5}) {
+    std::string mode = match[group];
+    if (mode.empty())
+      continue;
+    if (group == 4 && mode == "AP_TRN")
+      q = Quantisation::TRN;
+    else if (group == 4 && mode == "AP_TRN_ZERO")
+      q = Quantisation::TRN_ZERO;
+    else if (group == 4 && mode == "AP_RND")
+      q = Quantisation::RND;
+    else if (group == 4 && mode == "AP_RND_CONV")
+      q = Quantisation::RND_CONV;
+    else if (group == 5 && mode == "AP_WRAP")
+      o = Overflow::WRAP;
+    else if (group == 5 && mode == "AP_SAT")
+      o = Overflow::SAT;
+    else
+      throw cms::Exception("Configuration") << "unsupported " << (group == 4 ? "quantisation" : "overflow") << " mode "
+                                            << mode << " in " << type;
+  }
+  *this = FixedPointType(std::stoi(match[2]), std::stoi(match[3]), match[1].length() == 0, q, o);
+}
+
+FixedPointType::FixedPointType(int width, int integer, bool is_signed, Quantisation q, Overflow o)
+    : width_(width), integer_(integer), frac_(width - integer), signed_(is_signed), quantisation_(q), overflow_(o) {
+  // Products of two values must fit in 64 bits
+  if (width_ < 1 || width_ > 32 || frac_ < 0 || frac_ > 48)
+    throw cms::Exception("Configuration") << "fixed point types need 1 <= W <= 32 and 0 <= W - I <= 48, got "
+                                          << str();
+  min_ = signed_ ? -(int64_t(1) << (width_ - 1)) : 0;
+  max_ = signed_ ? (int64_t(1) << (width_ - 1)) - 1 : (int64_t(1) << width_) - 1;
+}
+
+int64_t FixedPointType::fromDouble(double value) const {
+  double scaled = std::ldexp(value, frac_);
+  switch (quantisation_) {
+    case Quantisation::TRN:
+      scaled = std::floor(scaled);
+      break;
+    case Quantisation::TRN_ZERO:
+      scaled = std::trunc(scaled);
+      break;
+    case Quantisation::RND:
+      scaled = std::floor(scaled + 0.5);
+      break;
+    case Quantisation::RND_CONV:
+      scaled = std::nearbyint(scaled);
+      break;
+  }
+  // Far outside the type even wrapping is meaningless, clamp before converting to an integer
+  scaled = std::clamp(scaled, -std::ldexp(1., 62), std::ldexp(1., 62));
+  return overflow(int64_t(scaled));
+}
+
+int64_t FixedPointType::ceilFromDouble(double value) const {
+  double scaled = std::ceil(std::ldexp(value, frac_));
+  return int64_t(std::clamp(scaled, double(min_), double(max_)));
+}
+
+std::string FixedPointType::str() const {
+  std::ostringstream type;
+  type << (signed_ ? "ap_fixed<" : "ap_ufixed<") << width_ << "," << integer_;
+  if (quantisation_ != Quantisation::TRN || overflow_ != Overflow::WRAP) {
+    const char* modes[] = {"AP_TRN", "AP_TRN_ZERO", "AP_RND", "AP_RND_CONV"};
+    type << "," << modes[int(quantisation_)];
+    if (overflow_ != Overflow::WRAP)
+      type << ",AP_SAT";
+  }
+  type << ">";
+  return type.str();
+}
@@ -0,0 +1,269 @@
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace {
+
+  std::vector<int64_t> sigmoidTable(const FixedPointType& result, int frac, int size) {
+    // Each entry holds the sigmoid at the centre of its interval
+    std::vector<int64_t> table(size);
+    for (int i = 0; i < size; ++i) {
+      double x = std::ldexp(i - size / 2 + 0.5, -frac);
+      table[i] = result.fromDouble(1. / (1. + std::exp(-x)));
+    }
+    return table;
+  }
+
+}  // namespace
+
+FixedPointModel::FixedPointModel(const TreeEnsemble& gbdt, const FixedPointPrecision& precision)
+    : precision_(precision), n_features_(gbdt.nFeatures()), sigmoid_(gbdt.logistic()) {
+  const FixedPointType& weight = precision_.weight;
+  const FixedPointType& accum = precision_.accum;
+  auto constant = [&](double value) { return accum.cast(weight.fromDouble(value), weight.frac()); };
+
+  for (size_t i = 0; i < gbdt.nodes().size(); ++i) {
+    const TreeEnsemble::Node& node = gbdt.nodes()[i];
+    // Inputs are exact in the input type, so x < t is the same test as x < ceil(t)
+    nodes_.push_back({precision_.input.ceilFromDouble(node.threshold),
+                      node.feature,
+                      {node.children[0], node.children[1]},
+                      constant(gbdt.leafValues()[i])});
+  }
+  roots_ = gbdt.roots();
+  depths_ = gbdt.depths();
+  base_value_ = constant(gbdt.baseValue());
+  sigmoid_table_ = sigmoidTable(precision_.result, sigmoid_frac, sigmoid_size);
+}
+
+FixedPointModel::FixedPointModel(const DenseNetwork& nn, const FixedPointPrecision& precision)
+    : precision_(precision), n_features_(nn.nFeatures()), sigmoid_(false), base_value_(0) {
+  const FixedPointType& input = precision_.input;
+  const FixedPointType& weight = precision_.weight;
+  const FixedPointType& accum = precision_.accum;
+  if (n_features_ > max_layer_width)
+    throw cms::Exception("Configuration") << "fixed point NN inputs are limited to " << max_layer_width << ", got "
+                                          << n_features_;
+
+  for (size_t l = 0; l < nn.layers().size(); ++l) {
+    const DenseNetwork::Layer& dense = nn.layers()[l];
+    bool last = l + 1 == nn.layers().size();
+    if (dense.n_out > max_layer_width)
+      throw cms::Exception("Configuration") << "fixed point NN layers are limited to " << max_layer_width
+                                            << " outputs, layer " << l << " has " << dense.n_out;
+    if (dense.activation == DenseNetwork::Activation::Sigmoid && last)
+      sigmoid_ = true;
+    else if (dense.activation != DenseNetwork::Activation::Relu && dense.activation != DenseNetwork::Activation::None)
+      throw cms::Exception("Configuration") << "fixed point NN supports Relu hidden layers and a Sigmoid output only";
+
+    Layer layer = {dense.n_in, dense.n_out, {}, {}, dense.activation == DenseNetwork::Activation::Relu};
+    for (unsigned int o = 0; o < dense.n_out; ++o) {
+      for (unsigned int i = 0; i < dense.n_in; ++i)
+        layer.weights.push_back(weight.fromDouble(dense.weights[((o / 4) * dense.n_in + i) * 4 + o % 4]));
+      layer.bias.push_back(accum.cast(weight.fromDouble(dense.bias[o]), weight.frac()));
+    }
+    layers_.push_back(std::move(layer));
+  }
+  sigmoid_table_ = sigmoidTable(precision_.result, sigmoid_frac, sigmoid_size);
+
+  // Truncated and rounded products are quantised with a shift, and a wrapping sum is wrapped once
+  // as long as no product overflows the integers it is summed in
+  int shift = weight.frac() + input.frac() - accum.frac();
+  shift_ = std::max(shift, 0);
+  scale_ = int64_t(1) << std::max(-shift, 0);
+  bool rounded = accum.quantisationMode() == FixedPointType::Quantisation::RND;
+  half_ = rounded && shift_ > 0 ? int64_t(1) << (shift_ - 1) : 0;
+  auto largest = [](const FixedPointType& type) { return double(std::max(-type.minRaw(), type.maxRaw())); };
+  auto fits16 = [](const FixedPointType& type, int64_t scale) {
+    return type.minRaw() * scale >= INT16_MIN && type.maxRaw() * scale <= INT16_MAX;
+  };
+  double product = largest(input) * largest(weight) * double(scale_) + double(half_);
+  sum_ = Sum::Exact;
+  if (accum.overflowMode() == FixedPointType::Overflow::WRAP &&
+      (shift_ == 0 || rounded || accum.quantisationMode() == FixedPointType::Quantisation::TRN)) {
+    if (product < std::ldexp(1., 31))
+      sum_ = fits16(input, 1) && fits16(weight, scale_) ? Sum::Short : Sum::Narrow;
+    else if (product < std::ldexp(1., 62))
+      sum_ = Sum::Wide;
+  }
+}
+
+int64_t FixedPointModel::predictRaw(const int64_t* row) const {
+  return output(layers_.empty() ? predictTrees(row) : predictLayers(row));
+}
+
+void FixedPointModel::predict(const int64_t* rows, unsigned int n_tracks, float* scores) const {
+  for (unsigned int first = 0; first < n_tracks; first += block) {
+    unsigned int n = std::min(block, n_tracks - first);
+    const int64_t* block_rows = rows + size_t(first) * n_features_;
+    int64_t sums[block];
+    if (layers_.empty())
+      predictTrees(block_rows, n, sums);
+    else if (sum_ == Sum::Narrow)
+      predictLayers<int32_t, int32_t, uint32_t>(block_rows, n, sums);
+    else if (sum_ == Sum::Short)
+      predictLayers<int16_t, int32_t, uint32_t>(block_rows, n, sums);
+    else if (sum_ == Sum::Wide)
+      predictLayers<int64_t, int64_t, uint64_t>(block_rows, n, sums);
+    else
+      for (unsigned int j = 0; j < n; ++j)
+        sums[j] = predictLayers(block_rows + size_t(j) * n_features_);
+    for (unsigned int j = 0; j < n; ++j)
+      scores[first + j] = precision_.result.toDouble(output(sums[j]));
+  }
+}
+
+int64_t FixedPointModel::predictTrees(const int64_t* row) const {
+  const FixedPointType& accum = precision_.accum;
+  int64_t sum = base_value_;
+  for (uint32_t root : roots_) {
+    uint32_t index = root;
+    // Leaves point back to themselves
+    while (nodes_[index].children[0] != index) {
+      const Node& node = nodes_[index];
+      index = node.children[row[node.feature] < node.threshold];
+    }
+    sum = accum.cast(sum + nodes_[index].value, accum.frac());
+  }
+  return sum;
+}
+
+void FixedPointModel::predictTrees(const int64_t* rows, unsigned int n, int64_t* sums) const {
+  const FixedPointType& accum = precision_.accum;
+  const Node* nodes = nodes_.data();
+  bool wrap = accum.overflowMode() == FixedPointType::Overflow::WRAP;
+  // A whole block is always walked, the tracks past n repeating the last one
+  const int64_t* row[block];
+  int64_t sum[block];
+  for (unsigned int j = 0; j < block; ++j) {
+    row[j] = rows + std::min(j, n - 1) * n_features_;
+    sum[j] = base_value_;
+  }
+
+  for (size_t tree = 0; tree < roots_.size(); ++tree) {
+    uint32_t index[block];
+    for (unsigned int j = 0; j < block; ++j)
+      index[j] = roots_[tree];
+    // Leaves point back to themselves, every track takes depth steps
+    for (uint32_t step = 0; step < depths_[tree]; ++step) {
+      for (unsigned int j = 0; j < block; ++j) {
+        const Node& node = nodes[index[j]];
+        index[j] = node.children[row[j][node.feature] < node.threshold];
+      }
+    }
+    // Saturation is applied after every tree, wrapping once at the end
+    if (wrap) {
+      for (unsigned int j = 0; j < block; ++j)
+        sum[j] += nodes[index[j]].value;
+    } else {
+      for (unsigned int j = 0; j < block; ++j)
+        sum[j] = accum.cast(sum[j] + nodes[index[j]].value, accum.frac());
+    }
+  }
+  for (unsigned int j = 0; j < n; ++j)
+    sums[j] = wrap ? accum.cast(sum[j], accum.frac()) : sum[j];
+}
+
+template <typename Value, typename Product, typename Accum>
+void FixedPointModel::predictLayers(const int64_t* rows, unsigned int n, int64_t* sums) const {
+  typedef std::make_signed_t<Accum> Signed;
+  const FixedPointType& input = precision_.input;
+  const FixedPointType& accum = precision_.accum;
+  // Wrapping to a signed type of width bits is sign extending them
+  const int accum_extend = 8 * sizeof(Accum) - accum.width();
+  const int input_extend = 8 * sizeof(Accum) - input.width();
+  const int input_shift = accum.frac() - input.frac();
+  bool input_wraps = input.isSigned() && input.quantisationMode() == FixedPointType::Quantisation::TRN &&
+                     input.overflowMode() == FixedPointType::Overflow::WRAP && input_shift >= 0;
+
+  // Activations [neuron][track] of the block, the first layer reading buffers[1]. The tracks are
+  // independent, those past n are 0 and never read back
+  Value buffers[2][max_layer_width][block];
+  for (unsigned int i = 0; i < n_features_; ++i)
+    for (unsigned int j = 0; j < block; ++j)
+      buffers[1][i][j] = j < n ? rows[j * n_features_ + i] : 0;
+  Signed last[block];
+
+  for (size_t l = 0; l < layers_.size(); ++l) {
+    const Layer& layer = layers_[l];
+    const Value(*in)[block] = buffers[(l + 1) % 2];
+    Value(*out)[block] = buffers[l % 2];
+    for (unsigned int o = 0; o < layer.n_out; ++o) {
+      const int64_t* weights = &layer.weights[size_t(o) * layer.n_in];
+      // Unsigned so the sums wrap, every track of the block summed in the same loop
+      Accum wrapped[block];
+      for (unsigned int j = 0; j < block; ++j)
+        wrapped[j] = Accum(layer.bias[o]);
+      for (unsigned int i = 0; i < layer.n_in; ++i) {
+        Value w = weights[i] * scale_;
+        for (unsigned int j = 0; j < block; ++j)
+          wrapped[j] += Accum((Product(w) * Product(in[i][j]) + Product(half_)) >> shift_);
+      }
+      for (unsigned int j = 0; j < block; ++j) {
+        last[j] = Signed(wrapped[j] << accum_extend) >> accum_extend;
+        if (layer.relu)
+          last[j] = std::max<Signed>(last[j], 0);
+      }
+      if (input_wraps) {
+        for (unsigned int j = 0; j < block; ++j)
+          out[o][j] = Signed(Accum(last[j] >> input_shift) << input_extend) >> input_extend;
+      } else {
+        for (unsigned int j = 0; j < block; ++j)
+          out[o][j] = input.cast(last[j], accum.frac());
+      }
+    }
+  }
+  // The last output of the last layer, before it is cast back to the input type
+  for (unsigned int j = 0; j < n; ++j)
+    sums[j] = last[j];
+}
+
+int64_t FixedPointModel::predictLayers(const int64_t* row) const {
+  const FixedPointType& input = precision_.input;
+  const FixedPointType& weight = precision_.weight;
+  const FixedPointType& accum = precision_.accum;
+  int64_t buffers[2][max_layer_width];
+  const int64_t* in = row;
+  int64_t sum = 0;
+
+  // With truncation and wrapping every product is floored on its own and the sum only needs
+  // wrapping once, modular arithmetic giving the same result as wrapping after each addition
+  int shift = weight.frac() + input.frac() - accum.frac();
+  bool fast = accum.quantisationMode() == FixedPointType::Quantisation::TRN &&
+              accum.overflowMode() == FixedPointType::Overflow::WRAP && shift >= 0;
+
+  for (size_t l = 0; l < layers_.size(); ++l) {
+    const Layer& layer = layers_[l];
+    int64_t* out = buffers[l % 2];
+    for (unsigned int o = 0; o < layer.n_out; ++o) {
+      const int64_t* weights = &layer.weights[size_t(o) * layer.n_in];
+      if (fast) {
+        uint64_t wrapped = layer.bias[o];
+        for (unsigned int i = 0; i < layer.n_in; ++i)
+          wrapped += uint64_t((weights[i] * in[i]) >> shift);
+        sum = accum.cast(int64_t(wrapped), accum.frac());
+      } else {
+        sum = layer.bias[o];
+        for (unsigned int i = 0; i < layer.n_in; ++i)
+          sum = accum.cast(sum + accum.multiply(weights[i], weight.frac(), in[i], input.frac()), accum.frac());
+      }
+      if (layer.relu)
+        sum = std::max<int64_t>(sum, 0);
+      out[o] = input.cast(sum, accum.frac());
+    }
+    in = out;
+  }
+  // The last output of the last layer, before it is cast back to the input type
+  return sum;
+}
+
+int64_t FixedPointModel::output(int64_t accum) const {
+  const FixedPointType& type = precision_.accum;
+  if (!sigmoid_)
+    return precision_.result.cast(accum, type.frac());
+  int shift = type.frac() - sigmoid_frac;
+  int64_t index = (shift >= 0 ? accum >> shift : accum * (int64_t(1) << -shift)) + sigmoid_size / 2;
+  return sigmoid_table_[std::clamp<int64_t>(index, 0, sigmoid_size - 1)];
+}
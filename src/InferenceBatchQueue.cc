@@ -0,0 +1,120 @@
+#include "L1Trigger/TrackQuality/interface/InferenceBatchQueue.h"
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+
+InferenceBatchQueue::InferenceBatchQueue(Model model, unsigned int n_features, unsigned int max_batch, double max_wait)
+    : model_(std::move(model)),
+      n_features_(n_features),
+      max_batch_(std::max(max_batch, 1u)),
+      max_wait_(static_cast<long long>(max_wait)),
+      pending_rows_(0),
+      stop_(false),
+      n_batches_(0),
+      n_requests_(0),
+      n_rows_(0),
+      n_full_(0),
+      max_rows_(0),
+      rows_histogram_(32, 0) {
+  features_.reserve(max_batch_ * n_features_);
+  scores_.reserve(max_batch_);
+  worker_ = std::thread(&InferenceBatchQueue::run, this);
+}
+
+InferenceBatchQueue::~InferenceBatchQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  worker_.join();
+}
+
+void InferenceBatchQueue::submit(const float* features,
+                                 unsigned int n_rows,
+                                 float* scores,
+                                 edm::WaitingTaskWithArenaHolder holder) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(Request{features, n_rows, scores, std::move(holder), std::chrono::steady_clock::now()});
+    pending_rows_ += n_rows;
+  }
+  cv_.notify_one();
+}
+
+void InferenceBatchQueue::run() {
+  std::vector<Request> batch;
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (true) {
+    cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+    if (pending_.empty())
+      return;  // stopped with nothing left to run
+
+    // Let more events join the batch until it is full or the oldest request has waited long enough
+    auto deadline = pending_.front().submitted + max_wait_;
+    bool full = cv_.wait_until(lock, deadline, [this] { return stop_ || pending_rows_ >= max_batch_; });
+
+    // A single request larger than max_batch is run on its own rather than split
+    unsigned int rows = 0;
+    while (!pending_.empty() && (batch.empty() || rows + pending_.front().n_rows <= max_batch_)) {
+      rows += pending_.front().n_rows;
+      batch.push_back(std::move(pending_.front()));
+      pending_.pop_front();
+    }
+    pending_rows_ -= rows;
+
+    ++n_batches_;
+    n_requests_ += batch.size();
+    n_rows_ += rows;
+    n_full_ += full;
+    max_rows_ = std::max(max_rows_, rows);
+    unsigned int bin = 0;
+    while ((2u << bin) <= rows && bin + 1 < rows_histogram_.size())
+      ++bin;
+    ++rows_histogram_[bin];
+
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      features_.clear();
+      for (const auto& request : batch)
+        features_.insert(features_.end(), request.features, request.features + request.n_rows * n_features_);
+      model_(features_, rows, scores_);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    // scatter the scores back to each event and release its waiting task
+    unsigned int offset = 0;
+    for (auto& request : batch) {
+      if (!error)
+        std::copy(scores_.begin() + offset, scores_.begin() + offset + request.n_rows, request.scores);
+      offset += request.n_rows;
+      request.holder.doneWaiting(error);
+    }
+    batch.clear();
+
+    lock.lock();
+  }
+}
+
+void InferenceBatchQueue::printStats(std::ostream& os) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  os << "InferenceBatchQueue: " << n_batches_ << " batches, " << n_requests_ << " events, " << n_rows_ << " tracks"
+     << std::endl;
+  if (n_batches_ == 0)
+    return;
+  os << "  mean events/batch " << double(n_requests_) / n_batches_ << ", mean tracks/batch "
+     << double(n_rows_) / n_batches_ << ", max tracks/batch " << max_rows_ << ", " << n_full_
+     << " batches full before the timeout" << std::endl;
+  os << "  tracks/batch      batches" << std::endl;
+  for (unsigned int bin = 0; bin < rows_histogram_.size(); ++bin) {
+    if (rows_histogram_[bin] == 0)
+      continue;
+    os << "  [" << std::setw(6) << (bin == 0 ? 0u : 1u << bin) << "," << std::setw(6) << (2u << bin) << ")"
+       << std::setw(12) << rows_histogram_[bin] << std::endl;
+  }
+}
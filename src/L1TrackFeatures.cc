@@ -0,0 +1,49 @@
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+
+L1TrackFeatures::L1TrackFeatures(const std::vector<std::string>& names,
+                                 size_t n_tracks,
+                                 float log_floor,
+                                 bool fast_log)
+    : names_(names),
+      n_tracks_(n_tracks),
+      log_floor_(log_floor),
+      fast_log_(fast_log),
+      values_(names.size() * n_tracks, 0.f) {}
+
+void L1TrackFeatures::checkTransform(float log_floor, bool fast_log) const {
+  if (log_floor != log_floor_)
+    throw cms::Exception("Configuration") << "L1TrackFeatures product has logChi2Floor " << log_floor_
+                                          << " but the reader uses " << log_floor;
+  if (fast_log != fast_log_)
+    throw cms::Exception("Configuration") << "L1TrackFeatures product has fastLog " << fast_log_
+                                          << " but the reader uses " << fast_log;
+}
+
+unsigned int L1TrackFeatures::index(const std::string& name) const {
+  auto found = std::find(names_.begin(), names_.end(), name);
+  if (found == names_.end())
+    throw cms::Exception("Configuration") << "feature " << name << " is not in the L1TrackFeatures product";
+  return found - names_.begin();
+}
+
+void L1TrackFeatures::rows(const std::vector<unsigned int>& features, float* out) const {
+  // One column at a time, so each read is sequential
+  for (size_t f = 0; f < features.size(); ++f) {
+    const float* in = column(features[f]);
+    for (size_t i = 0; i < n_tracks_; ++i)
+      out[i * features.size() + f] = in[i];
+  }
+}
+
+void L1TrackFeatures::rows(const std::vector<unsigned int>& features,
+                           const unsigned int* selected,
+                           size_t n_selected,
+                           float* out) const {
+  for (size_t f = 0; f < features.size(); ++f) {
+    const float* in = column(features[f]);
+    for (size_t i = 0; i < n_selected; ++i)
+      out[i * features.size() + f] = in[selected[i]];
+  }
+}
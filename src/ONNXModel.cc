@@ -0,0 +1,27 @@
+#include "L1Trigger/TrackQuality/interface/ONNXModel.h"
+#include <chrono>
+
+ONNXModel::ONNXModel(const std::string& path,
+                     const std::string& input_name,
+                     const std::vector<std::string>& output_names,
+                     unsigned int score_output,
+                     unsigned int score_columns)
+    : path_(path),
+      input_names_({input_name}),
+      output_names_(output_names),
+      score_output_(score_output),
+      score_columns_(score_columns) {
+  auto start = std::chrono::steady_clock::now();
+  runtime_ = std::make_unique<cms::Ort::ONNXRuntime>(path_);
+  load_time_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<float> ONNXModel::predict(cms::Ort::FloatArrays& input, int64_t batch_size) const {
+  cms::Ort::FloatArrays ortoutputs = runtime_->run(input_names_, input, output_names_, batch_size);
+  const std::vector<float>& probabilities = ortoutputs[score_output_];
+
+  std::vector<float> scores(batch_size);
+  for (int64_t i = 0; i < batch_size; ++i)
+    scores[i] = probabilities[(i + 1) * score_columns_ - 1];
+  return scores;
+}
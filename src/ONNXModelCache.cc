@@ -0,0 +1,156 @@
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/ClassifierEngine.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/FakeIDGBDTModel.h"
+#include <algorithm>
+#include <chrono>
+
+ONNXModelCache::ONNXModelCache(const edm::ParameterSet& iConfig) {
+  std::string algorithm = iConfig.getParameter<std::string>("Algorithm");
+  // The engines to load for, those of allEngines for All
+  std::vector<std::string> engines = ClassifierEngine::engineNames(iConfig);
+  auto uses = [&](const char* engine) { return std::find(engines.begin(), engines.end(), engine) != engines.end(); };
+
+  // Sidecar files of the models trained on scaled features, empty when there is none
+  auto scalingOf = [&](const std::string& parameter) {
+    std::string file = iConfig.getParameter<std::string>(parameter);
+    return file.empty() ? FeatureScaling()
+                        : FeatureScaling(edm::FileInPath(file).fullPath(),
+                                         iConfig.getParameter<std::vector<std::string>>("in_features"));
+  };
+  bool nn_family = uses("NN") | uses("NNNative") | uses("NNFixedPoint");
+  FeatureScaling scaling = scalingOf(nn_family ? "NNIdScaling" : "GBDTIdScaling");
+  // The models of All share one batch of features, each engine would leave a different part of
+  // its scaling to the transform
+  if (engines.size() - std::count(engines.begin(), engines.end(), "Cut") > 1 &&
+      !(scalingOf("NNIdScaling").identity() && scalingOf("GBDTIdScaling").identity()))
+    throw cms::Exception("Configuration") << "feature scaling is not supported by All with more than one model";
+  if ((uses("NNFixedPoint") | uses("GBDTFixedPoint")) && !scaling.identity())
+    throw cms::Exception("Configuration") << "feature scaling is not supported by " << algorithm
+                                          << ", the track word features are not scaled";
+  // Applied by the transform unless folded below
+  input_scaling_ = scaling;
+
+  if (uses("NN")) {
+    // The NN has a single sigmoid output per track
+    nn_ = std::make_unique<const ONNXModel>(edm::FileInPath(iConfig.getParameter<std::string>("NNIdONNXmodel")).fullPath(),
+                                            iConfig.getParameter<std::string>("NNIdONNXInputName"),
+                                            std::vector<std::string>{iConfig.getParameter<std::string>("NNIdONNXOutputName")},
+                                            0,
+                                            1);
+    edm::LogInfo("ONNXModelCache") << "loaded fake ID onnx model from " << nn_->path() << " in " << nn_->loadTime()
+                                   << " ms";
+  }
+
+  if (uses("NNNative") | uses("NNFixedPoint")) {
+    // Same NN model, evaluated by the native dense layers rather than by ONNX runtime
+    std::string path = edm::FileInPath(iConfig.getParameter<std::string>("NNIdONNXmodel")).fullPath();
+    auto start = std::chrono::steady_clock::now();
+    auto network = std::make_unique<DenseNetwork>(path,
+                                                  iConfig.getParameter<std::string>("NNIdONNXInputName"),
+                                                  iConfig.getParameter<std::string>("NNIdONNXOutputName"));
+    // Offsets and scales folded into the first layer, only the clipping is left to the transform
+    network->foldScaling(scaling);
+    input_scaling_ = scaling.clipping();
+    nn_native_ = std::move(network);
+    double load_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    edm::LogInfo("ONNXModelCache") << "loaded fake ID native NN from " << path << " (" << nn_native_->nLayers()
+                                   << " layers, " << nn_native_->lanes() << " tracks per SIMD vector) in " << load_time
+                                   << " ms";
+
+    unsigned int n_features = iConfig.getParameter<std::vector<std::string>>("in_features").size();
+    if (nn_native_->nFeatures() != n_features)
+      throw cms::Exception("Configuration") << "NN model expects " << nn_native_->nFeatures() << " features but "
+                                            << n_features << " are configured in in_features";
+  }
+
+  if (uses("GBDT")) {
+    // The output names for the GBDT are left blank due to issues returning the correct
+    // output, instead the GBDT fills the outputs with both the class prediction and the class
+    // probabilities.
+    // outputs[0][0] = class prediction based on a 0.5 threshold
+    // outputs[1][0] = negative class probability
+    // outputs[1][1] = positive class probability
+    gbdt_ = std::make_unique<const ONNXModel>(edm::FileInPath(iConfig.getParameter<std::string>("GBDTIdONNXmodel")).fullPath(),
+                                              iConfig.getParameter<std::string>("GBDTIdONNXInputName"),
+                                              std::vector<std::string>(),
+                                              1,
+                                              2);
+    edm::LogInfo("ONNXModelCache") << "loaded fake ID onnx model from " << gbdt_->path() << " in "
+                                   << gbdt_->loadTime() << " ms";
+  }
+
+  if (uses("GBDTNative") | uses("GBDTQuickScorer") | uses("GBDTFixedPoint")) {
+    // Same GBDT model, evaluated from its flattened trees rather than by ONNX runtime
+    std::string path = edm::FileInPath(iConfig.getParameter<std::string>("GBDTIdONNXmodel")).fullPath();
+    auto start = std::chrono::steady_clock::now();
+    auto ensemble = std::make_unique<TreeEnsemble>(path);
+    // Scaling and clipping folded into the thresholds, the transform is left with nothing to do
+    ensemble->foldScaling(scaling);
+    input_scaling_ = FeatureScaling();
+    gbdt_native_ = std::move(ensemble);
+    double load_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    edm::LogInfo("ONNXModelCache") << "loaded fake ID native GBDT from " << path << " (" << gbdt_native_->nTrees()
+                                   << " trees, " << gbdt_native_->nNodes() << " nodes) in " << load_time << " ms";
+
+    unsigned int n_features = iConfig.getParameter<std::vector<std::string>>("in_features").size();
+    if (gbdt_native_->nFeatures() != n_features)
+      throw cms::Exception("Configuration") << "GBDT model expects " << gbdt_native_->nFeatures() << " features but "
+                                            << n_features << " are configured in in_features";
+  }
+
+  if (uses("GBDTCompiled")) {
+    // Nothing to load, the GBDT is compiled in from interface/FakeIDGBDTModel.h
+    edm::LogInfo("ONNXModelCache") << "using fake ID GBDT compiled into the binary (" << FakeIDGBDTModel::n_trees
+                                   << " trees)";
+    unsigned int n_features = iConfig.getParameter<std::vector<std::string>>("in_features").size();
+    if (FakeIDGBDTModel::n_features != n_features)
+      throw cms::Exception("Configuration") << "compiled GBDT expects " << FakeIDGBDTModel::n_features
+                                            << " features but " << n_features << " are configured in in_features";
+  }
+
+  if (uses("GBDTQuickScorer")) {
+    // Built from the flattened trees, which are only needed while it is constructed unless
+    // GBDTNative runs next to it in All
+    gbdt_quickscorer_ = std::make_unique<const QuickScorer>(*gbdt_native_);
+    if (!uses("GBDTNative"))
+      gbdt_native_.reset();
+    edm::LogInfo("ONNXModelCache") << "using QuickScorer GBDT evaluation"
+                                   << (gbdt_quickscorer_->vectorised() ? " with AVX2"
+                                                                       : " without AVX2, one track at a time");
+  }
+
+  bool float_engine = uses("GBDT") | uses("NN") | uses("GBDTNative") | uses("GBDTQuickScorer") |
+                      uses("GBDTCompiled") | uses("NNNative");
+  if (float_engine && iConfig.getParameter<bool>("trackWordFeatures")) {
+    // Features decoded from the packed track words, the fixed point type is not used by the float path
+    if (!input_scaling_.identity())
+      throw cms::Exception("Configuration") << "feature scaling is not supported with trackWordFeatures";
+    track_word_features_ = std::make_unique<const TrackWordFeatures>(
+        iConfig.getParameter<std::vector<std::string>>("in_features"),
+        FixedPointType(iConfig.getParameter<std::string>("fixedPointInput")));
+    edm::LogInfo("ONNXModelCache") << "computing the features from the packed track word";
+  }
+
+  if (uses("GBDTFixedPoint") | uses("NNFixedPoint")) {
+    // Quantised from the native engine, which is not needed afterwards
+    FixedPointPrecision precision = {FixedPointType(iConfig.getParameter<std::string>("fixedPointInput")),
+                                     FixedPointType(iConfig.getParameter<std::string>("fixedPointWeight")),
+                                     FixedPointType(iConfig.getParameter<std::string>("fixedPointAccum")),
+                                     FixedPointType(iConfig.getParameter<std::string>("fixedPointResult"))};
+    track_word_features_ = std::make_unique<const TrackWordFeatures>(
+        iConfig.getParameter<std::vector<std::string>>("in_features"), precision.input);
+    if (gbdt_native_)
+      fixed_point_ = std::make_unique<const FixedPointModel>(*gbdt_native_, precision);
+    else
+      fixed_point_ = std::make_unique<const FixedPointModel>(*nn_native_, precision);
+    gbdt_native_.reset();
+    nn_native_.reset();
+    edm::LogInfo("ONNXModelCache") << "using fixed point emulation from the track word, input "
+                                   << precision.input.str() << ", weights " << precision.weight.str()
+                                   << ", accumulator " << precision.accum.str() << ", result "
+                                   << precision.result.str();
+  }
+}
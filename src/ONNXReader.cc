@@ -0,0 +1,374 @@
+/*
+Decoder of the protobuf wire format for the ONNX messages below, field numbers are taken from
+https://github.com/onnx/onnx/blob/master/onnx/onnx.proto
+  ModelProto:     graph = 7
+  GraphProto:     node = 1, initializer = 5, input = 11, output = 12
+  NodeProto:      input = 1, output = 2, name = 3, op_type = 4, attribute = 5, domain = 7
+  AttributeProto: name = 1, f = 2, i = 3, s = 4, t = 5, floats = 7, ints = 8, strings = 9
+  TensorProto:    dims = 1, data_type = 2, float_data = 4, int32_data = 5, int64_data = 7,
+                  name = 8, raw_data = 9, double_data = 10
+  ValueInfoProto: name = 1, type = 2
+  TypeProto:      tensor_type = 1
+  TypeProto.Tensor: shape = 2
+  TensorShapeProto: dim = 1
+  TensorShapeProto.Dimension: dim_value = 1, dim_param = 2
+*/
+#include "L1Trigger/TrackQuality/interface/ONNXReader.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace ONNXReader {
+
+  namespace {
+
+    enum WireType { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2, FIXED32 = 5 };
+
+    // Field of a message, for length delimited fields [begin, end) holds the payload
+    struct Field {
+      unsigned int number;
+      WireType type;
+      uint64_t value;
+      const uint8_t* begin;
+      const uint8_t* end;
+
+      std::string str() const { return std::string(reinterpret_cast<const char*>(begin), end - begin); }
+      float asFloat() const {
+        uint32_t bits = value;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+      }
+    };
+
+    class Message {
+    public:
+      Message(const uint8_t* begin, const uint8_t* end) : pos_(begin), end_(end) {}
+      explicit Message(const Field& field) : pos_(field.begin), end_(field.end) {}
+
+      // Reads the next field, returns false at the end of the message
+      bool next(Field& field) {
+        if (pos_ >= end_)
+          return false;
+        uint64_t key = varint();
+        field.number = key >> 3;
+        field.type = static_cast<WireType>(key & 7);
+        switch (field.type) {
+          case VARINT:
+            field.value = varint();
+            break;
+          case FIXED64:
+            field.value = fixed(8);
+            break;
+          case FIXED32:
+            field.value = fixed(4);
+            break;
+          case LENGTH_DELIMITED: {
+            uint64_t length = varint();
+            if (length > uint64_t(end_ - pos_))
+              throw cms::Exception("ONNXReader") << "truncated protobuf message";
+            field.begin = pos_;
+            field.end = pos_ + length;
+            pos_ += length;
+            break;
+          }
+          default:
+            throw cms::Exception("ONNXReader") << "unsupported protobuf wire type " << field.type;
+        }
+        return true;
+      }
+
+      bool atEnd() const { return pos_ >= end_; }
+
+      uint64_t varint() {
+        uint64_t result = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+          if (pos_ >= end_)
+            throw cms::Exception("ONNXReader") << "truncated protobuf varint";
+          uint8_t byte = *pos_++;
+          result |= uint64_t(byte & 0x7f) << shift;
+          if (!(byte & 0x80))
+            return result;
+        }
+        throw cms::Exception("ONNXReader") << "malformed protobuf varint";
+      }
+
+    private:
+      uint64_t fixed(unsigned int n_bytes) {
+        if (uint64_t(end_ - pos_) < n_bytes)
+          throw cms::Exception("ONNXReader") << "truncated protobuf message";
+        uint64_t result = 0;
+        for (unsigned int i = 0; i < n_bytes; ++i)
+          result |= uint64_t(pos_[i]) << (8 * i);
+        pos_ += n_bytes;
+        return result;
+      }
+
+      const uint8_t* pos_;
+      const uint8_t* end_;
+    };
+
+    // Repeated scalar fields may be packed into one length delimited field or written one by one
+    void readRepeated(const Field& field, std::vector<int64_t>& out) {
+      if (field.type != LENGTH_DELIMITED) {
+        out.push_back(static_cast<int64_t>(field.value));
+        return;
+      }
+      Message packed(field);
+      while (!packed.atEnd())
+        out.push_back(static_cast<int64_t>(packed.varint()));
+    }
+
+    void readRepeated(const Field& field, std::vector<float>& out) {
+      if (field.type != LENGTH_DELIMITED) {
+        out.push_back(field.asFloat());
+        return;
+      }
+      for (const uint8_t* p = field.begin; p + sizeof(float) <= field.end; p += sizeof(float)) {
+        float f;
+        std::memcpy(&f, p, sizeof(f));
+        out.push_back(f);
+      }
+    }
+
+    Tensor readTensor(const Field& tensor_field) {
+      enum { FLOAT = 1, INT32 = 6, INT64 = 7, DOUBLE = 11 };
+      Tensor tensor;
+      int data_type = FLOAT;
+      std::string raw;
+      std::vector<int64_t> int_data;
+      std::vector<double> double_data;
+
+      Message message(tensor_field);
+      Field field;
+      while (message.next(field)) {
+        switch (field.number) {
+          case 1:
+            readRepeated(field, tensor.dims);
+            break;
+          case 2:
+            data_type = field.value;
+            break;
+          case 4:
+            readRepeated(field, tensor.data);
+            break;
+          case 5:
+          case 7:
+            readRepeated(field, int_data);
+            break;
+          case 8:
+            tensor.name = field.str();
+            break;
+          case 9:
+            raw = field.str();
+            break;
+          case 10:
+            if (field.type == LENGTH_DELIMITED) {
+              for (const uint8_t* p = field.begin; p + 8 <= field.end; p += 8) {
+                double d;
+                std::memcpy(&d, p, sizeof(d));
+                double_data.push_back(d);
+              }
+            } else {
+              double d;
+              std::memcpy(&d, &field.value, sizeof(d));
+              double_data.push_back(d);
+            }
+            break;
+          default:
+            break;
+        }
+      }
+
+      if (!raw.empty()) {
+        // raw_data is little endian, as are the platforms CMSSW runs on
+        if (data_type == FLOAT) {
+          tensor.data.resize(raw.size() / sizeof(float));
+          std::memcpy(tensor.data.data(), raw.data(), tensor.data.size() * sizeof(float));
+        } else if (data_type == DOUBLE) {
+          double_data.resize(raw.size() / sizeof(double));
+          std::memcpy(double_data.data(), raw.data(), double_data.size() * sizeof(double));
+        } else if (data_type == INT64) {
+          int_data.resize(raw.size() / sizeof(int64_t));
+          std::memcpy(int_data.data(), raw.data(), int_data.size() * sizeof(int64_t));
+        } else if (data_type == INT32) {
+          std::vector<int32_t> int32_data(raw.size() / sizeof(int32_t));
+          std::memcpy(int32_data.data(), raw.data(), int32_data.size() * sizeof(int32_t));
+          int_data.assign(int32_data.begin(), int32_data.end());
+        } else {
+          throw cms::Exception("ONNXReader") << "tensor " << tensor.name << " has unsupported data type " << data_type;
+        }
+      }
+      tensor.data.insert(tensor.data.end(), int_data.begin(), int_data.end());
+      tensor.data.insert(tensor.data.end(), double_data.begin(), double_data.end());
+      return tensor;
+    }
+
+    Attribute readAttribute(const Field& attribute_field) {
+      Attribute attribute;
+      Message message(attribute_field);
+      Field field;
+      while (message.next(field)) {
+        switch (field.number) {
+          case 1:
+            attribute.name = field.str();
+            break;
+          case 2:
+            attribute.f = field.asFloat();
+            break;
+          case 3:
+            attribute.i = static_cast<int64_t>(field.value);
+            break;
+          case 4:
+            attribute.s = field.str();
+            break;
+          case 5:
+            attribute.t = readTensor(field);
+            break;
+          case 7:
+            readRepeated(field, attribute.floats);
+            break;
+          case 8:
+            readRepeated(field, attribute.ints);
+            break;
+          case 9:
+            attribute.strings.push_back(field.str());
+            break;
+          default:
+            break;
+        }
+      }
+      return attribute;
+    }
+
+    Node readNode(const Field& node_field) {
+      Node node;
+      Message message(node_field);
+      Field field;
+      while (message.next(field)) {
+        switch (field.number) {
+          case 1:
+            node.inputs.push_back(field.str());
+            break;
+          case 2:
+            node.outputs.push_back(field.str());
+            break;
+          case 3:
+            node.name = field.str();
+            break;
+          case 4:
+            node.op_type = field.str();
+            break;
+          case 5:
+            node.attributes.push_back(readAttribute(field));
+            break;
+          case 7:
+            node.domain = field.str();
+            break;
+          default:
+            break;
+        }
+      }
+      return node;
+    }
+
+    // Follows the only length delimited field of the given number, returns false if absent
+    bool findField(const Field& parent, unsigned int number, Field& field) {
+      Message message(parent);
+      while (message.next(field))
+        if (field.number == number && field.type == LENGTH_DELIMITED)
+          return true;
+      return false;
+    }
+
+    ValueInfo readValueInfo(const Field& value_info_field) {
+      ValueInfo value_info;
+      Message message(value_info_field);
+      Field field;
+      while (message.next(field)) {
+        if (field.number == 1) {
+          value_info.name = field.str();
+        } else if (field.number == 2) {
+          Field tensor_type, shape;
+          if (!findField(field, 1, tensor_type) || !findField(tensor_type, 2, shape))
+            continue;
+          Message dims(shape);
+          Field dim;
+          while (dims.next(dim)) {
+            if (dim.number != 1)
+              continue;
+            int64_t size = -1;
+            Message dimension(dim);
+            Field value;
+            while (dimension.next(value))
+              if (value.number == 1 && value.type == VARINT)
+                size = static_cast<int64_t>(value.value);
+            value_info.dims.push_back(size);
+          }
+        }
+      }
+      return value_info;
+    }
+
+    Graph readGraph(const Field& graph_field) {
+      Graph graph;
+      Message message(graph_field);
+      Field field;
+      while (message.next(field)) {
+        switch (field.number) {
+          case 1:
+            graph.nodes.push_back(readNode(field));
+            break;
+          case 5:
+            graph.initializers.push_back(readTensor(field));
+            break;
+          case 11:
+            graph.inputs.push_back(readValueInfo(field));
+            break;
+          case 12:
+            graph.outputs.push_back(readValueInfo(field));
+            break;
+          default:
+            break;
+        }
+      }
+      return graph;
+    }
+
+  }  // namespace
+
+  const Attribute* Node::attribute(const std::string& attribute_name) const {
+    for (const auto& a : attributes)
+      if (a.name == attribute_name)
+        return &a;
+    return nullptr;
+  }
+
+  const Tensor* Graph::initializer(const std::string& tensor_name) const {
+    for (const auto& t : initializers)
+      if (t.name == tensor_name)
+        return &t;
+    return nullptr;
+  }
+
+  Graph read(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+      throw cms::Exception("ONNXReader") << "cannot open " << path;
+    std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    try {
+      Message model(buffer.data(), buffer.data() + buffer.size());
+      Field field;
+      while (model.next(field))
+        if (field.number == 7 && field.type == LENGTH_DELIMITED)
+          return readGraph(field);
+    } catch (cms::Exception& e) {
+      e << " while reading " << path;
+      throw;
+    }
+    throw cms::Exception("ONNXReader") << path << " contains no graph";
+  }
+
+}  // namespace ONNXReader
@@ -0,0 +1,165 @@
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+  struct Split {
+    uint16_t feature;
+    float threshold;
+    uint32_t tree;
+    uint32_t mask;
+    bool nan_to_lt;
+  };
+
+  // Numbers the leaves below index from the less-than side, the children[1] side, to the other,
+  // recording the leaf values and one split per branch. Returns the number of leaves
+  uint32_t numberLeaves(const TreeEnsemble& ensemble,
+                        uint32_t index,
+                        uint32_t tree,
+                        uint32_t first_leaf,
+                        std::vector<float>& leaf_values,
+                        std::vector<Split>& splits) {
+    const TreeEnsemble::Node& node = ensemble.nodes()[index];
+    if (node.children[0] == index) {
+      leaf_values.push_back(ensemble.leafValues()[index]);
+      return 1;
+    }
+    uint32_t n_below = numberLeaves(ensemble, node.children[1], tree, first_leaf, leaf_values, splits);
+    uint32_t n_above = numberLeaves(ensemble, node.children[0], tree, first_leaf + n_below, leaf_values, splits);
+    if (first_leaf + n_below + n_above > 32)
+      throw cms::Exception("QuickScorer") << "tree " << tree << " has more than 32 leaves";
+    if (std::isnan(node.threshold))
+      throw cms::Exception("QuickScorer") << "tree " << tree << " has a NaN split threshold";
+
+    // A false split, feature >= threshold, removes the leaves of its less-than subtree
+    uint32_t below = (n_below == 32 ? ~0u : (1u << n_below) - 1) << first_leaf;
+    splits.push_back({node.feature, node.threshold, tree, ~below, bool(node.nan_to_lt)});
+    return n_below + n_above;
+  }
+
+}  // namespace
+
+QuickScorer::QuickScorer(const TreeEnsemble& ensemble)
+    : n_features_(ensemble.nFeatures()), base_value_(ensemble.baseValue()), logistic_(ensemble.logistic()), avx2_(false) {
+  std::vector<Split> splits;
+  for (uint32_t tree = 0; tree < ensemble.nTrees(); ++tree) {
+    leaf_offsets_.push_back(leaf_values_.size());
+    numberLeaves(ensemble, ensemble.roots()[tree], tree, 0, leaf_values_, splits);
+  }
+
+  std::stable_sort(splits.begin(), splits.end(), [](const Split& a, const Split& b) {
+    return a.feature != b.feature ? a.feature < b.feature : a.threshold < b.threshold;
+  });
+  feature_begin_.assign(n_features_ + 1, 0);
+  nan_begin_.assign(n_features_ + 1, 0);
+  for (const Split& split : splits) {
+    ++feature_begin_[split.feature + 1];
+    thresholds_.push_back(split.threshold);
+    split_trees_.push_back(split.tree);
+    split_masks_.push_back(split.mask);
+    if (!split.nan_to_lt) {
+      ++nan_begin_[split.feature + 1];
+      nan_trees_.push_back(split.tree);
+      nan_masks_.push_back(split.mask);
+    }
+  }
+  for (unsigned int feature = 0; feature < n_features_; ++feature) {
+    feature_begin_[feature + 1] += feature_begin_[feature];
+    nan_begin_[feature + 1] += nan_begin_[feature];
+  }
+
+#if defined(__x86_64__)
+  avx2_ = __builtin_cpu_supports("avx2");
+#endif
+}
+
+float QuickScorer::scoreTrack(const float* row, uint32_t* leaves) const {
+  std::fill(leaves, leaves + nTrees(), ~0u);
+  for (unsigned int feature = 0; feature < n_features_; ++feature) {
+    float x = row[feature];
+    for (uint32_t split = feature_begin_[feature]; split < feature_begin_[feature + 1]; ++split) {
+      if (!(thresholds_[split] <= x))
+        break;
+      leaves[split_trees_[split]] &= split_masks_[split];
+    }
+    if (std::isnan(x))
+      for (uint32_t split = nan_begin_[feature]; split < nan_begin_[feature + 1]; ++split)
+        leaves[nan_trees_[split]] &= nan_masks_[split];
+  }
+
+  float sum = base_value_;
+  for (unsigned int tree = 0; tree < nTrees(); ++tree)
+    sum += leaf_values_[leaf_offsets_[tree] + __builtin_ctz(leaves[tree])];
+  return sum;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) void QuickScorer::scoreBlock(const float* rows, float* sums, uint32_t* leaves) const {
+  const __m256i all = _mm256_set1_epi32(-1);
+  for (unsigned int tree = 0; tree < nTrees(); ++tree)
+    _mm256_storeu_si256((__m256i*)(leaves + 8 * tree), all);
+
+  const __m256i row_offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(n_features_));
+  for (unsigned int feature = 0; feature < n_features_; ++feature) {
+    __m256 x = _mm256_i32gather_ps(rows + feature, row_offsets, 4);
+    for (uint32_t split = feature_begin_[feature]; split < feature_begin_[feature + 1]; ++split) {
+      __m256 is_false = _mm256_cmp_ps(_mm256_set1_ps(thresholds_[split]), x, _CMP_LE_OQ);
+      if (!_mm256_movemask_ps(is_false))
+        break;
+      __m256i* tree_leaves = (__m256i*)(leaves + 8 * split_trees_[split]);
+      __m256i keep = _mm256_blendv_epi8(all, _mm256_set1_epi32(split_masks_[split]), _mm256_castps_si256(is_false));
+      _mm256_storeu_si256(tree_leaves, _mm256_and_si256(_mm256_loadu_si256(tree_leaves), keep));
+    }
+    if (nan_begin_[feature] == nan_begin_[feature + 1])
+      continue;
+    __m256 is_nan = _mm256_cmp_ps(x, x, _CMP_UNORD_Q);
+    if (!_mm256_movemask_ps(is_nan))
+      continue;
+    for (uint32_t split = nan_begin_[feature]; split < nan_begin_[feature + 1]; ++split) {
+      __m256i* tree_leaves = (__m256i*)(leaves + 8 * nan_trees_[split]);
+      __m256i keep = _mm256_blendv_epi8(all, _mm256_set1_epi32(nan_masks_[split]), _mm256_castps_si256(is_nan));
+      _mm256_storeu_si256(tree_leaves, _mm256_and_si256(_mm256_loadu_si256(tree_leaves), keep));
+    }
+  }
+
+  // The exit leaf is the lowest bit set, its index is read from the exponent of the isolated bit
+  // converted to float. Trees are summed in order so the result matches TreeEnsemble exactly
+  __m256 sum = _mm256_set1_ps(base_value_);
+  for (unsigned int tree = 0; tree < nTrees(); ++tree) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(leaves + 8 * tree));
+    __m256i lowest = _mm256_and_si256(v, _mm256_sub_epi32(_mm256_setzero_si256(), v));
+    __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23);
+    __m256i leaf = _mm256_sub_epi32(_mm256_and_si256(exponent, _mm256_set1_epi32(0xff)), _mm256_set1_epi32(127));
+    sum = _mm256_add_ps(sum, _mm256_i32gather_ps(&leaf_values_[leaf_offsets_[tree]], leaf, 4));
+  }
+  _mm256_storeu_ps(sums, sum);
+}
+#else
+void QuickScorer::scoreBlock(const float* rows, float* sums, uint32_t* leaves) const {
+  for (unsigned int j = 0; j < 8; ++j)
+    sums[j] = scoreTrack(rows + j * n_features_, leaves);
+}
+#endif
+
+void QuickScorer::predict(const float* features, unsigned int n_tracks, float* scores) const {
+  // Scratch of the thread, grown once to the largest ensemble so scoring does not allocate
+  thread_local std::vector<uint32_t> leaves;
+  if (leaves.size() < 8 * nTrees())
+    leaves.resize(8 * nTrees());
+  unsigned int first = 0;
+  if (avx2_)
+    for (; first + 8 <= n_tracks; first += 8)
+      scoreBlock(features + size_t(first) * n_features_, scores + first, leaves.data());
+  for (; first < n_tracks; ++first)
+    scores[first] = scoreTrack(features + size_t(first) * n_features_, leaves.data());
+
+  if (logistic_)
+    for (unsigned int i = 0; i < n_tracks; ++i)
+      scores[i] = 1.f / (1.f + std::exp(-scores[i]));
+}
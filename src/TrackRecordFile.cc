@@ -0,0 +1,171 @@
+#include "L1Trigger/TrackQuality/interface/TrackRecordFile.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace {
+
+  // Deflate expands its input at most 1032 times, an index entry claiming more tracks than this
+  // allows from its stored bytes is corrupted
+  constexpr uint64_t max_inflation = 1032;
+
+}  // namespace
+
+RecordedTrack RecordedTrack::fromTrack(const TTTrack<Ref_Phase2TrackerDigi_>& track) {
+  RecordedTrack record;
+  record.rinv = track.rInv();
+  record.phi = track.phi();
+  record.tanl = track.tanL();
+  record.z0 = track.z0();
+  record.d0 = track.d0();
+  record.chi2rphi = track.chi2XY();
+  record.chi2rz = track.chi2Z();
+  record.bendchi2 = track.stubPtConsistency();
+  record.mva[0] = track.trkMVA1();
+  record.mva[1] = track.trkMVA2();
+  record.mva[2] = track.trkMVA3();
+  record.hitpattern = track.hitPattern();
+  record.nstubs = track.getStubRefs().size();
+  record.nfitpars = track.nFitPars();
+  return record;
+}
+
+TTTrack<Ref_Phase2TrackerDigi_> RecordedTrack::toTrack(double bfield) const {
+  TTTrack<Ref_Phase2TrackerDigi_> track(
+      rinv, phi, tanl, z0, d0, chi2rphi, chi2rz, mva[0], mva[1], mva[2], hitpattern, nfitpars, bfield);
+  track.setStubPtConsistency(bendchi2);
+  for (unsigned int stub = 0; stub < nstubs; ++stub)
+    track.addStubRef({});
+  return track;
+}
+
+TrackRecordWriter::TrackRecordWriter(const std::string& path,
+                                     double bfield,
+                                     const std::string& algorithm,
+                                     bool compress)
+    : file_(path, std::ios::binary | std::ios::trunc) {
+  if (!file_)
+    throw cms::Exception("TrackRecord") << "cannot create " << path;
+  memset(&header_, 0, sizeof(header_));
+  memcpy(header_.magic, TrackRecordHeader::magic_value, sizeof(header_.magic));
+  header_.version = TrackRecordHeader::current_version;
+  header_.flags = compress ? TrackRecordHeader::compressed : 0;
+  header_.bfield = bfield;
+  strncpy(header_.algorithm, algorithm.c_str(), sizeof(header_.algorithm) - 1);
+  // Written again by close() with the event count and the index offset
+  file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+}
+
+TrackRecordWriter::~TrackRecordWriter() {
+  if (file_.is_open())
+    close();
+}
+
+void TrackRecordWriter::write(uint64_t event, const std::vector<TTTrack<Ref_Phase2TrackerDigi_> >& tracks) {
+  records_.clear();
+  for (const TTTrack<Ref_Phase2TrackerDigi_>& track : tracks)
+    records_.push_back(RecordedTrack::fromTrack(track));
+
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(records_.data());
+  uLong bytes = records_.size() * sizeof(RecordedTrack);
+  if (header_.flags & TrackRecordHeader::compressed) {
+    // Byte k of every record stored together, so the slowly varying exponent and sign bytes of
+    // the doubles and the small integers form long runs, then deflated at level 1 as the record
+    // is written while the job runs
+    shuffled_.resize(bytes);
+    for (size_t k = 0; k < sizeof(RecordedTrack); ++k)
+      for (size_t i = 0; i < records_.size(); ++i)
+        shuffled_[k * records_.size() + i] = data[i * sizeof(RecordedTrack) + k];
+    uLongf compressed_bytes = compressBound(bytes);
+    compressed_.resize(compressed_bytes);
+    if (compress2(compressed_.data(), &compressed_bytes, shuffled_.data(), bytes, 1) != Z_OK)
+      throw cms::Exception("TrackRecord") << "compression of event " << event << " failed";
+    data = compressed_.data();
+    bytes = compressed_bytes;
+  }
+
+  index_.push_back({event, uint64_t(file_.tellp()), uint32_t(records_.size()), uint32_t(bytes)});
+  file_.write(reinterpret_cast<const char*>(data), bytes);
+  // Padded so the next event and the index stay 8 byte aligned in the mapped file
+  static const char padding[8] = {};
+  file_.write(padding, (8 - bytes % 8) % 8);
+  if (!file_)
+    throw cms::Exception("TrackRecord") << "write of event " << event << " failed";
+}
+
+void TrackRecordWriter::close() {
+  header_.n_events = index_.size();
+  header_.index_offset = file_.tellp();
+  file_.write(reinterpret_cast<const char*>(index_.data()), index_.size() * sizeof(TrackRecordIndex));
+  file_.seekp(0);
+  file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+  file_.close();
+}
+
+TrackRecordReader::TrackRecordReader(const std::string& path) : data_(nullptr), size_(0) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw cms::Exception("TrackRecord") << "cannot open " << path;
+  struct stat status;
+  if (fstat(fd, &status) == 0 && size_t(status.st_size) >= sizeof(TrackRecordHeader)) {
+    size_ = status.st_size;
+    void* map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    data_ = map == MAP_FAILED ? nullptr : static_cast<const unsigned char*>(map);
+  }
+  ::close(fd);
+  if (!data_)
+    throw cms::Exception("TrackRecord") << "cannot map " << path;
+
+  header_ = reinterpret_cast<const TrackRecordHeader*>(data_);
+  std::string error;
+  if (memcmp(header_->magic, TrackRecordHeader::magic_value, sizeof(header_->magic)))
+    error = "is not a track record";
+  else if (header_->version != TrackRecordHeader::current_version)
+    error = "has version " + std::to_string(header_->version) + ", this reader knows version " +
+            std::to_string(TrackRecordHeader::current_version);
+  else if (header_->index_offset < sizeof(TrackRecordHeader) || header_->index_offset > size_ ||
+           (size_ - header_->index_offset) / sizeof(TrackRecordIndex) < header_->n_events)
+    error = "has no complete index, it was not closed";
+  if (error.empty()) {
+    index_ = reinterpret_cast<const TrackRecordIndex*>(data_ + header_->index_offset);
+    for (uint64_t i = 0; i < header_->n_events && error.empty(); ++i)
+      if (index_[i].offset < sizeof(TrackRecordHeader) || index_[i].offset + index_[i].bytes > header_->index_offset ||
+          (!compressed() && index_[i].bytes != index_[i].n_tracks * sizeof(RecordedTrack)) ||
+          (compressed() && uint64_t(index_[i].n_tracks) * sizeof(RecordedTrack) > uint64_t(index_[i].bytes) * max_inflation))
+        error = "has a corrupted index at event " + std::to_string(i);
+  }
+  if (!error.empty()) {
+    munmap(const_cast<unsigned char*>(data_), size_);
+    throw cms::Exception("TrackRecord") << path << " " << error;
+  }
+}
+
+TrackRecordReader::~TrackRecordReader() { munmap(const_cast<unsigned char*>(data_), size_); }
+
+const RecordedTrack* TrackRecordReader::tracks(uint64_t i, std::vector<RecordedTrack>& buffer) {
+  const TrackRecordIndex& entry = index_[i];
+  if (!compressed())
+    return reinterpret_cast<const RecordedTrack*>(data_ + entry.offset);
+
+  shuffled_.resize(size_t(entry.n_tracks) * sizeof(RecordedTrack));
+  uLongf bytes = shuffled_.size();
+  if (uncompress(shuffled_.data(), &bytes, data_ + entry.offset, entry.bytes) != Z_OK || bytes != shuffled_.size())
+    throw cms::Exception("TrackRecord") << "event " << entry.event << " cannot be decompressed";
+  buffer.resize(entry.n_tracks);
+  unsigned char* out = reinterpret_cast<unsigned char*>(buffer.data());
+  for (size_t k = 0; k < sizeof(RecordedTrack); ++k)
+    for (size_t i = 0; i < entry.n_tracks; ++i)
+      out[i * sizeof(RecordedTrack) + k] = shuffled_[k * entry.n_tracks + i];
+  return buffer.data();
+}
+
+void TrackRecordReader::read(uint64_t i, std::vector<TTTrack<Ref_Phase2TrackerDigi_> >& tracks) {
+  const RecordedTrack* records = this->tracks(i, buffer_);
+  tracks.clear();
+  for (uint32_t track = 0; track < index_[i].n_tracks; ++track)
+    tracks.push_back(records[track].toTrack(header_->bfield));
+}
@@ -0,0 +1,236 @@
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include "L1Trigger/TrackQuality/interface/HitPatternTable.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+unsigned int TrackWordFormat::digitizeSigned(double value, unsigned int bits, double max) {
+  double limit = double(1u << (bits - 1));
+  double field = std::clamp(std::floor(value / step(bits, max)), -limit, limit - 1);
+  return unsigned(int(field)) & ((1u << bits) - 1);
+}
+
+TrackWordBits TrackWordFormat::digitize(double rinv, double tanl, double z0, double chi2rphi, double chi2rz,
+                                        double bendchi2, unsigned int hitpattern) const {
+  return {digitizeSigned(rinv, rinv_bits, max_rinv),
+          digitizeSigned(tanl, tanl_bits, max_tanl),
+          digitizeSigned(z0, z0_bits, max_z0),
+          digitizeBinned(chi2rphi, chi2_bins),
+          digitizeBinned(chi2rz, chi2_bins),
+          digitizeBinned(bendchi2, bendchi2_bins),
+          hitpattern & 0x7f};
+}
+
+uint64_t TrackWordFormat::pack(const TrackWordBits& bits) const {
+  unsigned int shift = 0;
+  uint64_t word = 0;
+  for (auto field : {std::make_pair(bits.rinv, rinv_bits), std::make_pair(bits.tanl, tanl_bits),
+                     std::make_pair(bits.z0, z0_bits), std::make_pair(bits.chi2rphi, 4u),
+                     std::make_pair(bits.chi2rz, 4u), std::make_pair(bits.bendchi2, 3u),
+                     std::make_pair(bits.hitpattern, 7u)}) {
+    word |= uint64_t(field.first & ((1u << field.second) - 1)) << shift;
+    shift += field.second;
+  }
+  return word;
+}
+
+TrackWordBits TrackWordFormat::unpack(uint64_t word) const {
+  TrackWordBits bits;
+  for (auto field : {std::make_pair(&bits.rinv, rinv_bits), std::make_pair(&bits.tanl, tanl_bits),
+                     std::make_pair(&bits.z0, z0_bits), std::make_pair(&bits.chi2rphi, 4u),
+                     std::make_pair(&bits.chi2rz, 4u), std::make_pair(&bits.bendchi2, 3u),
+                     std::make_pair(&bits.hitpattern, 7u)}) {
+    *field.first = word & ((1u << field.second) - 1);
+    word >>= field.second;
+  }
+  return bits;
+}
+
+TrackWordFeatures::TrackWordFeatures(const std::vector<std::string>& in_features,
+                                     const FixedPointType& type,
+                                     const TrackWordFormat& format)
+    : type_(type), format_(format) {
+  static const std::map<std::string, Column> columns = {
+      {"log_chi2", {Feature::LogChi2, 0}},       {"log_chi2rphi", {Feature::LogChi2RPhi, 0}},
+      {"log_chi2rz", {Feature::LogChi2RZ, 0}},   {"log_bendchi2", {Feature::LogBendChi2, 0}},
+      {"chi2", {Feature::Chi2, 0}},              {"chi2rphi", {Feature::Chi2RPhi, 0}},
+      {"chi2rz", {Feature::Chi2RZ, 0}},          {"bendchi2", {Feature::BendChi2, 0}},
+      {"nstubs", {Feature::NStubs, 0}},          {"lay1_hits", {Feature::Hit, 0}},
+      {"lay2_hits", {Feature::Hit, 1}},          {"lay3_hits", {Feature::Hit, 2}},
+      {"lay4_hits", {Feature::Hit, 3}},          {"lay5_hits", {Feature::Hit, 4}},
+      {"lay6_hits", {Feature::Hit, 5}},          {"disk1_hits", {Feature::Hit, 6}},
+      {"disk2_hits", {Feature::Hit, 7}},         {"disk3_hits", {Feature::Hit, 8}},
+      {"disk4_hits", {Feature::Hit, 9}},         {"disk5_hits", {Feature::Hit, 10}},
+      {"rinv", {Feature::RInv, 0}},              {"tanl", {Feature::TanL, 0}},
+      {"z0", {Feature::Z0, 0}},                  {"dtot", {Feature::DTot, 0}},
+      {"ltot", {Feature::LTot, 0}},              {"nlaymiss_interior", {Feature::NLayMissInterior, 0}}};
+  for (const std::string& name : in_features) {
+    auto column = columns.find(name);
+    if (column == columns.end())
+      throw cms::Exception("Configuration") << "feature " << name << " cannot be computed from the track word";
+    features_.push_back(column->second);
+  }
+
+  if (format_.packedBits() > 64)
+    throw cms::Exception("Configuration") << "track word fields of " << format_.packedBits()
+                                          << " bits do not fit in a 64 bit packed word";
+
+  auto multiplier = [](double scale) { return int64_t(std::llround(std::ldexp(scale, multiplier_frac))); };
+  double tanl_step = TrackWordFormat::step(format_.tanl_bits, format_.max_tanl);
+  rinv_multiplier_ = multiplier(500. * TrackWordFormat::step(format_.rinv_bits, format_.max_rinv));
+  tanl_multiplier_ = multiplier(tanl_step);
+  z0_multiplier_ = multiplier(TrackWordFormat::step(format_.z0_bits, format_.max_z0));
+
+  // |eta| >= edge exactly when |tanl| >= sinh(edge)
+  for (double edge : HitPatternTable::eta_bins)
+    eta_edges_.push_back(int64_t(std::ceil(std::sinh(edge) / tanl_step)));
+
+  for (unsigned int i = 0; i < 16; ++i) {
+    double chi2 = TrackWordFormat::binValue(i, format_.chi2_bins);
+    log_chi2rphi_[i] = log_chi2rz_[i] = type_.fromDouble(std::log(chi2));
+    chi2rphi_[i] = chi2rz_[i] = type_.fromDouble(chi2);
+    for (unsigned int j = 0; j < 16; ++j) {
+      double total = chi2 + TrackWordFormat::binValue(j, format_.chi2_bins);
+      log_chi2_[i << 4 | j] = type_.fromDouble(std::log(total));
+      chi2_[i << 4 | j] = type_.fromDouble(total);
+    }
+  }
+  for (unsigned int i = 0; i < 8; ++i) {
+    double bendchi2 = TrackWordFormat::binValue(i, format_.bendchi2_bins);
+    log_bendchi2_[i] = type_.fromDouble(std::log(bendchi2));
+    bendchi2_[i] = type_.fromDouble(bendchi2);
+  }
+
+  // In float as floatingPoint computes them
+  for (unsigned int i = 0; i < 16; ++i) {
+    chi2_float_[i] = TrackWordFormat::binValue(i, format_.chi2_bins);
+    log_chi2_float_[i] = std::log(chi2_float_[i]);
+  }
+  for (unsigned int i = 0; i < 256; ++i) {
+    chi2_sum_float_[i] = chi2_float_[i & 0xf] + chi2_float_[i >> 4];
+    log_chi2_sum_float_[i] = std::log(chi2_sum_float_[i]);
+  }
+  for (unsigned int i = 0; i < 8; ++i) {
+    bendchi2_float_[i] = TrackWordFormat::binValue(i, format_.bendchi2_bins);
+    log_bendchi2_float_[i] = std::log(bendchi2_float_[i]);
+  }
+}
+
+int TrackWordFeatures::etaBin(unsigned int tanl_field) const {
+  int64_t abs_tanl = std::abs(TrackWordFormat::toSigned(tanl_field, format_.tanl_bits));
+  int bin = 0;
+  for (int j = 1; j <= HitPatternTable::n_eta_bins; ++j)
+    bin += abs_tanl >= eta_edges_[j];
+  return bin;
+}
+
+void TrackWordFeatures::fixedPoint(const TrackWordBits& bits, int64_t* row) const {
+  const HitPatternTable::Entry& hits = HitPatternTable::table[etaBin(bits.tanl) * 128 + (bits.hitpattern & 0x7f)];
+  int64_t abs_rinv = std::abs(TrackWordFormat::toSigned(bits.rinv, format_.rinv_bits));
+  int64_t abs_tanl = std::abs(TrackWordFormat::toSigned(bits.tanl, format_.tanl_bits));
+  int64_t abs_z0 = std::abs(TrackWordFormat::toSigned(bits.z0, format_.z0_bits));
+  unsigned int chi2 = bits.chi2rphi << 4 | bits.chi2rz;
+
+  for (size_t i = 0; i < features_.size(); ++i) {
+    switch (features_[i].feature) {
+      case Feature::LogChi2: row[i] = log_chi2_[chi2]; break;
+      case Feature::LogChi2RPhi: row[i] = log_chi2rphi_[bits.chi2rphi]; break;
+      case Feature::LogChi2RZ: row[i] = log_chi2rz_[bits.chi2rz]; break;
+      case Feature::LogBendChi2: row[i] = log_bendchi2_[bits.bendchi2]; break;
+      case Feature::Chi2: row[i] = chi2_[chi2]; break;
+      case Feature::Chi2RPhi: row[i] = chi2rphi_[bits.chi2rphi]; break;
+      case Feature::Chi2RZ: row[i] = chi2rz_[bits.chi2rz]; break;
+      case Feature::BendChi2: row[i] = bendchi2_[bits.bendchi2]; break;
+      case Feature::NStubs: row[i] = type_.cast(hits.nstubs, 0); break;
+      case Feature::Hit: row[i] = type_.cast((hits.expanded >> features_[i].hit) & 1, 0); break;
+      case Feature::RInv: row[i] = type_.cast(abs_rinv * rinv_multiplier_, multiplier_frac); break;
+      case Feature::TanL: row[i] = type_.cast(abs_tanl * tanl_multiplier_, multiplier_frac); break;
+      case Feature::Z0: row[i] = type_.cast(abs_z0 * z0_multiplier_, multiplier_frac); break;
+      case Feature::DTot: row[i] = type_.cast(hits.dtot, 0); break;
+      case Feature::LTot: row[i] = type_.cast(hits.ltot, 0); break;
+      case Feature::NLayMissInterior: row[i] = type_.cast(hits.nlaymiss_interior, 0); break;
+    }
+  }
+}
+
+void TrackWordFeatures::floatingPoint(const TrackWordBits& bits, float* row) const {
+  float rinv = TrackWordFormat::toSigned(bits.rinv, format_.rinv_bits) *
+               TrackWordFormat::step(format_.rinv_bits, format_.max_rinv);
+  float tanl = TrackWordFormat::toSigned(bits.tanl, format_.tanl_bits) *
+               TrackWordFormat::step(format_.tanl_bits, format_.max_tanl);
+  float z0 = TrackWordFormat::toSigned(bits.z0, format_.z0_bits) * TrackWordFormat::step(format_.z0_bits, format_.max_z0);
+  float chi2rphi = TrackWordFormat::binValue(bits.chi2rphi, format_.chi2_bins);
+  float chi2rz = TrackWordFormat::binValue(bits.chi2rz, format_.chi2_bins);
+  float bendchi2 = TrackWordFormat::binValue(bits.bendchi2, format_.bendchi2_bins);
+  const HitPatternTable::Entry& hits = HitPatternTable::lookup(bits.hitpattern, std::asinh(std::abs(tanl)));
+
+  for (size_t i = 0; i < features_.size(); ++i) {
+    switch (features_[i].feature) {
+      case Feature::LogChi2: row[i] = std::log(chi2rphi + chi2rz); break;
+      case Feature::LogChi2RPhi: row[i] = std::log(chi2rphi); break;
+      case Feature::LogChi2RZ: row[i] = std::log(chi2rz); break;
+      case Feature::LogBendChi2: row[i] = std::log(bendchi2); break;
+      case Feature::Chi2: row[i] = chi2rphi + chi2rz; break;
+      case Feature::Chi2RPhi: row[i] = chi2rphi; break;
+      case Feature::Chi2RZ: row[i] = chi2rz; break;
+      case Feature::BendChi2: row[i] = bendchi2; break;
+      case Feature::NStubs: row[i] = hits.nstubs; break;
+      case Feature::Hit: row[i] = (hits.expanded >> features_[i].hit) & 1; break;
+      case Feature::RInv: row[i] = 500 * std::abs(rinv); break;
+      case Feature::TanL: row[i] = std::abs(tanl); break;
+      case Feature::Z0: row[i] = std::abs(z0); break;
+      case Feature::DTot: row[i] = hits.dtot; break;
+      case Feature::LTot: row[i] = hits.ltot; break;
+      case Feature::NLayMissInterior: row[i] = hits.nlaymiss_interior; break;
+    }
+  }
+}
+
+void TrackWordFeatures::floatingPoint(const uint64_t* words, size_t n_tracks, float* out) const {
+  const unsigned int tanl_shift = format_.rinv_bits;
+  const unsigned int z0_shift = tanl_shift + format_.tanl_bits;
+  const unsigned int chi2_shift = z0_shift + format_.z0_bits;
+  const unsigned int bendchi2_shift = chi2_shift + 8;
+  const unsigned int hitpattern_shift = bendchi2_shift + 3;
+  const double rinv_step = TrackWordFormat::step(format_.rinv_bits, format_.max_rinv);
+  const double tanl_step = TrackWordFormat::step(format_.tanl_bits, format_.max_tanl);
+  const double z0_step = TrackWordFormat::step(format_.z0_bits, format_.max_z0);
+  // Two's complement field at shift sign extended by moving its top bit to bit 63
+  auto field = [](uint64_t word, unsigned int shift, unsigned int bits) {
+    return int64_t(word << (64 - shift - bits)) >> (64 - bits);
+  };
+
+  for (size_t t = 0; t < n_tracks; ++t) {
+    uint64_t word = words[t];
+    float* row = out + t * features_.size();
+    int64_t tanl_field = field(word, tanl_shift, format_.tanl_bits);
+    unsigned int chi2 = (word >> chi2_shift) & 0xff;  // chi2rz << 4 | chi2rphi
+    unsigned int bendchi2 = (word >> bendchi2_shift) & 0x7;
+    int eta_bin = 0;
+    for (int j = 1; j <= HitPatternTable::n_eta_bins; ++j)
+      eta_bin += std::abs(tanl_field) >= eta_edges_[j];
+    const HitPatternTable::Entry& hits = HitPatternTable::table[eta_bin * 128 + ((word >> hitpattern_shift) & 0x7f)];
+
+    for (size_t i = 0; i < features_.size(); ++i) {
+      switch (features_[i].feature) {
+        case Feature::LogChi2: row[i] = log_chi2_sum_float_[chi2]; break;
+        case Feature::LogChi2RPhi: row[i] = log_chi2_float_[chi2 & 0xf]; break;
+        case Feature::LogChi2RZ: row[i] = log_chi2_float_[chi2 >> 4]; break;
+        case Feature::LogBendChi2: row[i] = log_bendchi2_float_[bendchi2]; break;
+        case Feature::Chi2: row[i] = chi2_sum_float_[chi2]; break;
+        case Feature::Chi2RPhi: row[i] = chi2_float_[chi2 & 0xf]; break;
+        case Feature::Chi2RZ: row[i] = chi2_float_[chi2 >> 4]; break;
+        case Feature::BendChi2: row[i] = bendchi2_float_[bendchi2]; break;
+        case Feature::NStubs: row[i] = hits.nstubs; break;
+        case Feature::Hit: row[i] = (hits.expanded >> features_[i].hit) & 1; break;
+        case Feature::RInv: row[i] = 500 * std::abs(float(field(word, 0, format_.rinv_bits) * rinv_step)); break;
+        case Feature::TanL: row[i] = std::abs(float(tanl_field * tanl_step)); break;
+        case Feature::Z0: row[i] = std::abs(float(field(word, z0_shift, format_.z0_bits) * z0_step)); break;
+        case Feature::DTot: row[i] = hits.dtot; break;
+        case Feature::LTot: row[i] = hits.ltot; break;
+        case Feature::NLayMissInterior: row[i] = hits.nlaymiss_interior; break;
+      }
+    }
+  }
+}
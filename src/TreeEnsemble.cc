@@ -0,0 +1,225 @@
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "L1Trigger/TrackQuality/interface/ONNXReader.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <map>
+
+namespace {
+
+  const std::vector<int64_t>& intsOf(const ONNXReader::Node& node, const std::string& name, bool required = true) {
+    static const std::vector<int64_t> empty;
+    const ONNXReader::Attribute* attribute = node.attribute(name);
+    if (!attribute && required)
+      throw cms::Exception("TreeEnsemble") << "TreeEnsembleClassifier has no attribute " << name;
+    return attribute ? attribute->ints : empty;
+  }
+
+  const std::vector<float>& floatsOf(const ONNXReader::Node& node, const std::string& name, bool required = true) {
+    static const std::vector<float> empty;
+    const ONNXReader::Attribute* attribute = node.attribute(name);
+    if (!attribute && required)
+      throw cms::Exception("TreeEnsemble") << "TreeEnsembleClassifier has no attribute " << name;
+    return attribute ? attribute->floats : empty;
+  }
+
+  // Node as described by the ONNX attributes, ids are local to the tree
+  struct OnnxNode {
+    std::string mode;
+    int64_t feature = 0;
+    float threshold = 0;
+    int64_t true_id = 0;
+    int64_t false_id = 0;
+    bool missing_tracks_true = false;
+    float weight = 0;
+  };
+
+}  // namespace
+
+TreeEnsemble::TreeEnsemble(const std::string& onnx_path) : n_features_(0), base_value_(0), logistic_(false) {
+  ONNXReader::Graph graph = ONNXReader::read(onnx_path);
+  auto ensemble = std::find_if(graph.nodes.begin(), graph.nodes.end(), [](const ONNXReader::Node& node) {
+    return node.op_type == "TreeEnsembleClassifier";
+  });
+  if (ensemble == graph.nodes.end())
+    throw cms::Exception("TreeEnsemble") << onnx_path << " contains no TreeEnsembleClassifier";
+  const ONNXReader::Node& node = *ensemble;
+
+  const auto& tree_ids = intsOf(node, "nodes_treeids");
+  const auto& node_ids = intsOf(node, "nodes_nodeids");
+  const auto& feature_ids = intsOf(node, "nodes_featureids");
+  const auto& true_ids = intsOf(node, "nodes_truenodeids");
+  const auto& false_ids = intsOf(node, "nodes_falsenodeids");
+  const auto& missing = intsOf(node, "nodes_missing_value_tracks_true", false);
+  const auto& thresholds = floatsOf(node, "nodes_values");
+  const ONNXReader::Attribute* modes = node.attribute("nodes_modes");
+  if (!modes || modes->strings.size() != tree_ids.size())
+    throw cms::Exception("TreeEnsemble") << "TreeEnsembleClassifier has no valid nodes_modes";
+
+  const auto& class_tree_ids = intsOf(node, "class_treeids");
+  const auto& class_node_ids = intsOf(node, "class_nodeids");
+  const auto& class_ids = intsOf(node, "class_ids");
+  const auto& class_weights = floatsOf(node, "class_weights");
+
+  // Only the binary case written by XGBoost is supported: two class labels and leaf weights
+  // for a single class, whose summed weight gives the positive class score
+  const ONNXReader::Attribute* labels = node.attribute("classlabels_int64s");
+  if (!labels || labels->ints.empty())
+    labels = node.attribute("classlabels_strings");
+  unsigned int n_labels = labels ? std::max(labels->ints.size(), labels->strings.size()) : 0;
+  if (n_labels != 2 || std::any_of(class_ids.begin(), class_ids.end(), [&](int64_t id) { return id != class_ids[0]; }))
+    throw cms::Exception("TreeEnsemble") << onnx_path << " is not a binary classifier with a single weighted class";
+
+  const auto& base_values = floatsOf(node, "base_values", false);
+  if (base_values.size() > 1)
+    throw cms::Exception("TreeEnsemble") << "per class base_values are not supported";
+  base_value_ = base_values.empty() ? 0 : base_values[0];
+
+  const ONNXReader::Attribute* post_transform = node.attribute("post_transform");
+  std::string transform = post_transform ? post_transform->s : "NONE";
+  if (transform != "NONE" && transform != "LOGISTIC")
+    throw cms::Exception("TreeEnsemble") << "unsupported post_transform " << transform;
+  logistic_ = transform == "LOGISTIC";
+
+  // Gather the nodes tree by tree
+  std::map<int64_t, std::map<int64_t, OnnxNode>> trees;
+  for (size_t i = 0; i < tree_ids.size(); ++i) {
+    OnnxNode& onnx_node = trees[tree_ids[i]][node_ids[i]];
+    onnx_node.mode = modes->strings[i];
+    onnx_node.feature = feature_ids[i];
+    onnx_node.threshold = thresholds[i];
+    onnx_node.true_id = true_ids[i];
+    onnx_node.false_id = false_ids[i];
+    onnx_node.missing_tracks_true = i < missing.size() && missing[i];
+    if (onnx_node.mode != "LEAF")
+      n_features_ = std::max<unsigned int>(n_features_, feature_ids[i] + 1);
+  }
+  for (size_t i = 0; i < class_tree_ids.size(); ++i)
+    trees[class_tree_ids[i]][class_node_ids[i]].weight += class_weights[i];
+
+  // Rows are as wide as the model input, which may hold features no tree splits on
+  if (!graph.inputs.empty() && graph.inputs[0].dims.size() == 2 && graph.inputs[0].dims[1] > 0)
+    n_features_ = std::max<unsigned int>(n_features_, graph.inputs[0].dims[1]);
+
+  // Flatten each tree in breadth first order
+  for (const auto& tree : trees) {
+    const auto& tree_nodes = tree.second;
+    uint32_t root = nodes_.size();
+    roots_.push_back(root);
+
+    std::map<int64_t, uint32_t> index;
+    std::vector<int64_t> order;
+    std::vector<uint32_t> node_depth;
+    std::deque<std::pair<int64_t, uint32_t>> queue = {{tree_nodes.begin()->first, 0}};
+    while (!queue.empty()) {
+      auto id = queue.front();
+      queue.pop_front();
+      if (index.count(id.first))
+        continue;
+      auto found = tree_nodes.find(id.first);
+      if (found == tree_nodes.end())
+        throw cms::Exception("TreeEnsemble") << "tree " << tree.first << " refers to missing node " << id.first;
+      index[id.first] = root + order.size();
+      order.push_back(id.first);
+      node_depth.push_back(id.second);
+      if (found->second.mode != "LEAF") {
+        queue.push_back({found->second.true_id, id.second + 1});
+        queue.push_back({found->second.false_id, id.second + 1});
+      }
+    }
+    depths_.push_back(*std::max_element(node_depth.begin(), node_depth.end()));
+
+    for (int64_t id : order) {
+      const OnnxNode& onnx_node = tree_nodes.at(id);
+      uint32_t self = index[id];
+      Node flat = {0, 0, 0, 0, {self, self}};
+      if (onnx_node.mode != "LEAF") {
+        // Every comparison is rewritten as feature < threshold, taking the next float above the
+        // threshold for the inclusive modes
+        bool inclusive = onnx_node.mode == "BRANCH_LEQ" || onnx_node.mode == "BRANCH_GT";
+        bool true_below = onnx_node.mode == "BRANCH_LT" || onnx_node.mode == "BRANCH_LEQ";
+        if (!inclusive && !true_below && onnx_node.mode != "BRANCH_GTE")
+          throw cms::Exception("TreeEnsemble") << "unsupported node mode " << onnx_node.mode;
+        flat.threshold = inclusive ? std::nextafter(onnx_node.threshold, std::numeric_limits<float>::infinity())
+                                   : onnx_node.threshold;
+        flat.feature = onnx_node.feature;
+        uint32_t true_index = index[onnx_node.true_id];
+        uint32_t false_index = index[onnx_node.false_id];
+        flat.children[1] = true_below ? true_index : false_index;
+        flat.children[0] = true_below ? false_index : true_index;
+        // NaN fails the comparison and lands on children[0] unless redirected
+        flat.nan_to_lt = onnx_node.missing_tracks_true == true_below;
+      }
+      nodes_.push_back(flat);
+      values_.push_back(onnx_node.mode == "LEAF" ? onnx_node.weight : 0.f);
+    }
+  }
+}
+
+void TreeEnsemble::foldScaling(const FeatureScaling& scaling) {
+  const float inf = std::numeric_limits<float>::infinity();
+  for (uint32_t index = 0; index < nodes_.size(); ++index) {
+    Node& node = nodes_[index];
+    if (node.children[0] == index)
+      continue;
+    const FeatureScaling::Affine& affine = scaling[node.feature];
+    if (affine.identity())
+      continue;
+
+    // The scaling is non decreasing, so raw x < c exactly when scaled x < threshold for c the
+    // smallest float scaling to threshold or above. Started from the inverse and stepped to the
+    // float boundary, so no track changes branch because of rounding
+    if (!(affine.apply(-inf) < node.threshold)) {
+      node.threshold = -inf;  // never below
+    } else if (affine.apply(inf) < node.threshold) {
+      node.threshold = inf;  // always below
+    } else {
+      float c = std::min(std::max(float(double(node.threshold) / affine.scale + affine.offset), affine.low), affine.high);
+      while (affine.apply(c) < node.threshold)
+        c = std::nextafter(c, inf);
+      while (affine.apply(std::nextafter(c, -inf)) >= node.threshold)
+        c = std::nextafter(c, -inf);
+      node.threshold = c;
+    }
+  }
+}
+
+unsigned int TreeEnsemble::maxDepth() const {
+  return depths_.empty() ? 0 : *std::max_element(depths_.begin(), depths_.end());
+}
+
+void TreeEnsemble::predict(const float* features, unsigned int n_tracks, float* scores) const {
+  // Tracks walked together through each tree
+  constexpr unsigned int block = 8;
+  const Node* nodes = nodes_.data();
+  const float* values = values_.data();
+
+  for (unsigned int first = 0; first < n_tracks; first += block) {
+    unsigned int n = std::min(block, n_tracks - first);
+    const float* rows = features + size_t(first) * n_features_;
+    float sum[block];
+    for (unsigned int j = 0; j < n; ++j)
+      sum[j] = base_value_;
+
+    for (size_t tree = 0; tree < roots_.size(); ++tree) {
+      uint32_t index[block];
+      for (unsigned int j = 0; j < n; ++j)
+        index[j] = roots_[tree];
+      for (uint32_t step = 0; step < depths_[tree]; ++step) {
+        for (unsigned int j = 0; j < n; ++j) {
+          const Node& node = nodes[index[j]];
+          float x = rows[j * n_features_ + node.feature];
+          unsigned int below = (x < node.threshold) | (node.nan_to_lt & std::isnan(x));
+          index[j] = node.children[below];
+        }
+      }
+      for (unsigned int j = 0; j < n; ++j)
+        sum[j] += values[index[j]];
+    }
+
+    for (unsigned int j = 0; j < n; ++j)
+      scores[first + j] = logistic_ ? 1.f / (1.f + std::exp(-sum[j])) : sum[j];
+  }
+}
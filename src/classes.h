@@ -0,0 +1,2 @@
+#include "DataFormats/Common/interface/Wrapper.h"
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
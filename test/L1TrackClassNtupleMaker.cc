@@ -26,6 +26,7 @@
 #include "DataFormats/L1TrackTrigger/interface/TTCluster.h"
 #include "DataFormats/L1TrackTrigger/interface/TTStub.h"
 #include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
 #include "SimDataFormats/TrackingAnalysis/interface/TrackingParticle.h"
 #include "SimDataFormats/TrackingAnalysis/interface/TrackingVertex.h"
 #include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
@@ -124,6 +125,7 @@ private:
   edm::InputTag L1TrackInputTag;        // L1 track collection
   edm::InputTag MCTruthTrackInputTag;
   edm::InputTag MVATrackInputTag;   // MVA collection
+  edm::InputTag L1TrackFeaturesInputTag;  // L1TrackFeatures of the L1 track collection, optional
   edm::InputTag MCTruthClusterInputTag; // MC truth collection
   edm::InputTag L1StubInputTag;
   edm::InputTag MCTruthStubInputTag;
@@ -138,6 +140,7 @@ private:
 
   edm::EDGetTokenT< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > > ttTrackToken_;
   edm::EDGetTokenT< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > > ttTrackMVAToken_;
+  edm::EDGetTokenT< L1TrackFeatures > ttTrackFeaturesToken_;
   edm::EDGetTokenT< TTTrackAssociationMap< Ref_Phase2TrackerDigi_ > > ttTrackMCTruthToken_;
 
   edm::EDGetTokenT< std::vector< TrackingParticle > > TrackingParticleToken_;
@@ -177,6 +180,8 @@ private:
   std::vector<float>* m_trk_MVA1; // Track Classifier Output
   std::vector<float>* m_trk_MVA2; // No Output
   std::vector<float>* m_trk_MVA3; // No Ouput
+  std::vector<std::string> SaveFeatures;          // features of the L1TrackFeatures product to save
+  std::vector<std::vector<float>*> m_trk_features; // trk_feature_<name> for each of SaveFeatures
   std::vector<int>*   m_trk_matchtp_pdgid;
   std::vector<float>* m_trk_matchtp_pt;
   std::vector<float>* m_trk_matchtp_eta;
@@ -301,6 +306,8 @@ L1TrackClassNtupleMaker::L1TrackClassNtupleMaker(edm::ParameterSet const& iConfi
   L1TrackInputTag      = iConfig.getParameter<edm::InputTag>("L1TrackInputTag");
   MCTruthTrackInputTag = iConfig.getParameter<edm::InputTag>("MCTruthTrackInputTag");
   MVATrackInputTag = iConfig.getParameter<edm::InputTag>("MVATrackInputTag");
+  L1TrackFeaturesInputTag = iConfig.getParameter<edm::InputTag>("L1TrackFeaturesInputTag");
+  SaveFeatures     = iConfig.getParameter< std::vector<std::string> >("SaveFeatures");
   L1Tk_minNStub        = iConfig.getParameter< int >("L1Tk_minNStub");
 
   TrackingInJets = iConfig.getParameter< bool >("TrackingInJets");
@@ -315,6 +322,8 @@ L1TrackClassNtupleMaker::L1TrackClassNtupleMaker(edm::ParameterSet const& iConfi
   ttTrackToken_          = consumes< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > >(L1TrackInputTag);
   ttTrackMCTruthToken_   = consumes< TTTrackAssociationMap< Ref_Phase2TrackerDigi_ > >(MCTruthTrackInputTag);
   ttTrackMVAToken_       = consumes< std::vector< TTTrack< Ref_Phase2TrackerDigi_ > > >(MVATrackInputTag);
+  if (!SaveFeatures.empty())
+    ttTrackFeaturesToken_ = consumes< L1TrackFeatures >(L1TrackFeaturesInputTag);
   ttStubToken_           = consumes< edmNew::DetSetVector< TTStub< Ref_Phase2TrackerDigi_ > > >(L1StubInputTag);
   ttClusterMCTruthToken_ = consumes< TTClusterAssociationMap< Ref_Phase2TrackerDigi_ > >(MCTruthClusterInputTag);
   ttStubMCTruthToken_    = consumes< TTStubAssociationMap< Ref_Phase2TrackerDigi_ > >(MCTruthStubInputTag);
@@ -377,6 +386,8 @@ void L1TrackClassNtupleMaker::beginJob()
   m_trk_MVA1          = new std::vector<float>;
   m_trk_MVA2          = new std::vector<float>;
   m_trk_MVA3          = new std::vector<float>;
+  for (size_t i = 0; i < SaveFeatures.size(); ++i)
+    m_trk_features.push_back(new std::vector<float>);
   m_trk_matchtp_pdgid = new std::vector<int>;
   m_trk_matchtp_pt    = new std::vector<float>;
   m_trk_matchtp_eta   = new std::vector<float>;
@@ -494,6 +505,8 @@ void L1TrackClassNtupleMaker::beginJob()
     eventTree->Branch("trk_MVA1",         &m_trk_MVA1);
     eventTree->Branch("trk_MVA2",         &m_trk_MVA2);
     eventTree->Branch("trk_MVA3",         &m_trk_MVA3);
+    for (size_t i = 0; i < SaveFeatures.size(); ++i)
+      eventTree->Branch(("trk_feature_" + SaveFeatures[i]).c_str(), &m_trk_features[i]);
     eventTree->Branch("trk_matchtp_pdgid",&m_trk_matchtp_pdgid);
     eventTree->Branch("trk_matchtp_pt",   &m_trk_matchtp_pt);
     eventTree->Branch("trk_matchtp_eta",  &m_trk_matchtp_eta);
@@ -642,6 +655,8 @@ void L1TrackClassNtupleMaker::analyze(const edm::Event& iEvent, const edm::Event
     m_trk_MVA1->clear();
     m_trk_MVA2->clear();
     m_trk_MVA3->clear();
+    for (std::vector<float>* feature : m_trk_features)
+      feature->clear();
     m_trk_matchtp_pdgid->clear();
     m_trk_matchtp_pt->clear();
     m_trk_matchtp_eta->clear();
@@ -971,6 +986,16 @@ void L1TrackClassNtupleMaker::analyze(const edm::Event& iEvent, const edm::Event
 
      }
 
+    // features of the L1 tracks, computed once per event by L1TrackFeatureProducer
+    if (!SaveFeatures.empty()) {
+      edm::Handle< L1TrackFeatures > TTTrackFeaturesHandle;
+      iEvent.getByToken(ttTrackFeaturesToken_, TTTrackFeaturesHandle);
+      for (size_t i = 0; i < SaveFeatures.size(); ++i) {
+        const float* column = TTTrackFeaturesHandle->column(TTTrackFeaturesHandle->index(SaveFeatures[i]));
+        m_trk_features[i]->assign(column, column + TTTrackFeaturesHandle->nTracks());
+      }
+    }
+
 
     int this_l1track = 0;
     std::vector< TTTrack< Ref_Phase2TrackerDigi_ > >::const_iterator iterL1Track;
@@ -151,6 +151,11 @@ process.load("L1Trigger.TrackQuality.Classifier_cff")
 process.TrackClassifier.L1TrackInputTag = cms.InputTag(L1TRK_NAME, L1TRK_LABEL) 
 process.TrackClassifier.Algorithm = cms.string("NN")
 
+# Features computed once per event, read by the classifier and saved by the ntuple
+process.load("L1Trigger.TrackQuality.TrackFeatures_cff")
+process.L1TrackFeatures.L1TrackInputTag = cms.InputTag(L1TRK_NAME, L1TRK_LABEL)
+process.TrackClassifier.L1TrackFeaturesInputTag = cms.InputTag("L1TrackFeatures")
+
 
 process.load("RecoVertex.BeamSpotProducer.BeamSpot_cfi")
 process.load("SimTracker.TrackTriggerAssociation.TrackTriggerAssociator_cff")
@@ -159,7 +164,7 @@ process.TTTrackAssociatorFromPixelDigis.TTTracks = cms.VInputTag(cms.InputTag(L1
 ## emulation 
 process.TTTracksEmulation = cms.Path(process.offlineBeamSpot*L1TRK_PROC)
 process.TTTracksEmulationWithTruth = cms.Path(process.offlineBeamSpot*L1TRK_PROC*process.TrackTriggerAssociatorTracks)
-process.TTTracksEmulationWithTruthWithClass = cms.Path(process.offlineBeamSpot*L1TRK_PROC*process.TrackTriggerAssociatorTracks*process.TrackClassifier)
+process.TTTracksEmulationWithTruthWithClass = cms.Path(process.offlineBeamSpot*L1TRK_PROC*process.TrackTriggerAssociatorTracks*process.L1TrackFeatures*process.TrackClassifier)
 #L1TRK_PROC.asciiFileName = cms.untracked.string("evlist.txt")
 
 
@@ -191,6 +196,10 @@ process.L1TrackClassNtuple = cms.EDAnalyzer('L1TrackClassNtupleMaker',
                                        L1TrackInputTag = cms.InputTag(L1TRK_NAME, L1TRK_LABEL), # TTTrack input
                                        MCTruthTrackInputTag = cms.InputTag("TTTrackAssociatorFromPixelDigis",  L1TRK_LABEL),  ## MCTruth input
                                        MVATrackInputTag =  cms.InputTag("TrackClassifier", L1TRK_LABEL),
+                                       # features of the L1TrackFeatures product saved as trk_feature_<name>
+                                       L1TrackFeaturesInputTag = cms.InputTag("L1TrackFeatures"),
+                                       SaveFeatures = cms.vstring(["log_chi2","log_chi2rphi","log_chi2rz","log_bendchi2",
+                                                                   "nlaymiss_interior"]),
                                        # other input collections
                                        L1StubInputTag = cms.InputTag("TTStubsFromPhase2TrackerDigis","StubAccepted"),
                                        MCTruthClusterInputTag = cms.InputTag("TTClusterAssociatorFromPixelDigis", "ClusterAccepted"),
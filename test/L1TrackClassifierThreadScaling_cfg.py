@@ -0,0 +1,65 @@
+############################################################
+# Runs only the TrackClassifier on a file that already contains L1 TTTracks
+# (e.g. output_dataset.root written by L1TrackClassNtupleMaker_cfg.py with
+# WRITE_DATA = True) and reports the event throughput for the given number
+# of threads, see runThreadScaling.sh
+############################################################
+
+import FWCore.ParameterSet.Config as cms
+from FWCore.ParameterSet.VarParsing import VarParsing
+
+options = VarParsing('analysis')
+options.register('nThreads', 1, VarParsing.multiplicity.singleton, VarParsing.varType.int,
+                 "number of threads and streams")
+options.register('Algorithm', 'NN', VarParsing.multiplicity.singleton, VarParsing.varType.string,
+                 "TrackClassifier algorithm: None, Cut, NN, GBDT, All")
+options.register('useBatchQueue', False, VarParsing.multiplicity.singleton, VarParsing.varType.bool,
+                 "batch inference across concurrent events")
+options.register('outputMode', 'Tracks', VarParsing.multiplicity.singleton, VarParsing.varType.string,
+                 "TrackClassifier output: Tracks, ValueMap or Selected")
+options.register('outputFile', '', VarParsing.multiplicity.singleton, VarParsing.varType.string,
+                 "file keeping only the TrackClassifier products, for edmEventSize, none if empty")
+options.register('L1TrackInputTag', 'TTTracksFromTrackletEmulation:Level1TTTracks', VarParsing.multiplicity.singleton,
+                 VarParsing.varType.string, "TTTrack input collection")
+options.setDefault('inputFiles', 'file:output_dataset.root')
+options.setDefault('maxEvents', -1)
+options.parseArguments()
+
+process = cms.Process("L1TrackClassThreadScaling")
+
+process.load('FWCore.MessageService.MessageLogger_cfi')
+process.MessageLogger.cerr.FwkReport.reportEvery = 1000
+
+process.options = cms.untracked.PSet(
+    numberOfThreads = cms.untracked.uint32(options.nThreads),
+    numberOfStreams = cms.untracked.uint32(options.nThreads),
+    wantSummary = cms.untracked.bool(False)
+)
+
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(options.maxEvents))
+process.source = cms.Source("PoolSource", fileNames = cms.untracked.vstring(options.inputFiles))
+
+# Prints "Average throughput: X ev/s" at the end of the job
+process.ThroughputService = cms.Service("ThroughputService",
+                                        eventRange = cms.untracked.uint32(1000),
+                                        eventResolution = cms.untracked.uint32(1),
+                                        printEventSummary = cms.untracked.bool(True),
+                                        enableDQM = cms.untracked.bool(False)
+)
+
+process.load("L1Trigger.TrackQuality.Classifier_cff")
+process.TrackClassifier.L1TrackInputTag = cms.InputTag(options.L1TrackInputTag)
+process.TrackClassifier.Algorithm = cms.string(options.Algorithm)
+process.TrackClassifier.useBatchQueue = cms.bool(options.useBatchQueue)
+process.TrackClassifier.outputMode = cms.string(options.outputMode)
+
+process.classify = cms.Path(process.TrackClassifier)
+process.schedule = cms.Schedule(process.classify)
+
+if options.outputFile:
+    process.out = cms.OutputModule("PoolOutputModule",
+                                   fileName = cms.untracked.string(options.outputFile),
+                                   outputCommands = cms.untracked.vstring("drop *", "keep *_TrackClassifier_*_*")
+    )
+    process.write = cms.EndPath(process.out)
+    process.schedule.append(process.write)
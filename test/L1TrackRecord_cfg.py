@@ -0,0 +1,41 @@
+############################################################
+# Runs the TrackClassifier on a file that already contains L1 TTTracks
+# (e.g. output_dataset.root written by L1TrackClassNtupleMaker_cfg.py with
+# WRITE_DATA = True) and records the classified tracks to a track record,
+# replayed without CMSSW by replayTracks
+############################################################
+
+import FWCore.ParameterSet.Config as cms
+from FWCore.ParameterSet.VarParsing import VarParsing
+
+options = VarParsing('analysis')
+options.register('Algorithm', 'GBDTNative', VarParsing.multiplicity.singleton, VarParsing.varType.string,
+                 "TrackClassifier algorithm, stored in the record")
+options.register('compress', True, VarParsing.multiplicity.singleton, VarParsing.varType.bool,
+                 "zlib compressed record")
+options.register('L1TrackInputTag', 'TTTracksFromTrackletEmulation:Level1TTTracks', VarParsing.multiplicity.singleton,
+                 VarParsing.varType.string, "TTTrack input collection")
+options.setDefault('inputFiles', 'file:output_dataset.root')
+options.setDefault('outputFile', 'tracks.l1tq')
+options.setDefault('maxEvents', -1)
+options.parseArguments()
+
+process = cms.Process("L1TrackRecord")
+
+process.load('FWCore.MessageService.MessageLogger_cfi')
+process.MessageLogger.cerr.FwkReport.reportEvery = 1000
+
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(options.maxEvents))
+process.source = cms.Source("PoolSource", fileNames = cms.untracked.vstring(options.inputFiles))
+
+process.load("L1Trigger.TrackQuality.Classifier_cff")
+process.TrackClassifier.L1TrackInputTag = cms.InputTag(options.L1TrackInputTag)
+process.TrackClassifier.Algorithm = cms.string(options.Algorithm)
+
+process.load("L1Trigger.TrackQuality.TrackRecorder_cff")
+process.TrackRecorder.fileName = cms.string(options.outputFile)
+process.TrackRecorder.compress = cms.bool(options.compress)
+process.TrackRecorder.Algorithm = process.TrackClassifier.Algorithm
+
+process.record = cms.Path(process.TrackClassifier * process.TrackRecorder)
+process.schedule = cms.Schedule(process.record)
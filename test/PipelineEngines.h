@@ -0,0 +1,220 @@
+#ifndef PipelineEngines_HH
+#define PipelineEngines_HH
+
+/*
+The classification of one event as done by L1TrackClassifier for each Algorithm, with the
+defaults of python/Classifier_cff.py, and its timing over a set of events, for benchPipeline and
+replayTracks. Engines whose model cannot be loaded (ONNX runtime in a standalone build without
+it) are left out with a message
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/CompiledTreeEnsemble.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FakeIDGBDTModel.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModel.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TrackCuts.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+
+class PipelineEngines {
+public:
+  typedef TTTrack<Ref_Phase2TrackerDigi_> Track;
+
+  // Classifies the tracks of one event, writing one score per track
+  struct Engine {
+    std::string name;
+    std::function<void(const std::vector<Track>&, float*)> classify;
+  };
+
+  struct Result {
+    double tracks_per_second;
+    double ns_per_track;
+    double p50;  // per event latency, in microseconds
+    double p99;
+    double mean_score;
+  };
+
+  PipelineEngines() : plan_(in_features(), transformOptions()) {
+    engines_.push_back({"Cut", [](const std::vector<Track>& tracks, float* scores) {
+                          const TrackCuts cuts = {2., 15., 2.4, 40., 2.4, 4};
+                          for (size_t i = 0; i < tracks.size(); ++i)
+                            scores[i] = cuts.pass(tracks[i]);
+                        }});
+    engines_.push_back({"FeatureTransform", [this](const std::vector<Track>& tracks, float* scores) {
+                          transform(tracks);
+                          std::fill(scores, scores + tracks.size(), 0.f);
+                        }});
+
+    add("NN", [this] {
+      auto model = std::make_shared<ONNXModel>(edm::FileInPath(nn_model).fullPath(), "input_1",
+                                               std::vector<std::string>{"Sigmoid_Output_Layer"}, 0, 1);
+      return Engine{"NN", ort(model)};
+    });
+    add("GBDT", [this] {
+      auto model = std::make_shared<ONNXModel>(edm::FileInPath(gbdt_model).fullPath(), "feature_input",
+                                               std::vector<std::string>{}, 1, 2);
+      return Engine{"GBDT", ort(model)};
+    });
+    add("NNNative", [this] {
+      auto nn = std::make_shared<const DenseNetwork>(edm::FileInPath(nn_model).fullPath(), "input_1",
+                                                     "Sigmoid_Output_Layer");
+      return Engine{"NNNative", [this, nn](const std::vector<Track>& tracks, float* scores) {
+                      transform(tracks);
+                      nn->predict(features_.data(), tracks.size(), scores);
+                    }};
+    });
+    add("GBDTNative", [this] {
+      auto gbdt = std::make_shared<const TreeEnsemble>(edm::FileInPath(gbdt_model).fullPath());
+      return Engine{"GBDTNative", [this, gbdt](const std::vector<Track>& tracks, float* scores) {
+                      transform(tracks);
+                      gbdt->predict(features_.data(), tracks.size(), scores);
+                    }};
+    });
+    add("GBDTQuickScorer", [this] {
+      auto quickscorer = std::make_shared<const QuickScorer>(TreeEnsemble(edm::FileInPath(gbdt_model).fullPath()));
+      return Engine{"GBDTQuickScorer", [this, quickscorer](const std::vector<Track>& tracks, float* scores) {
+                      transform(tracks);
+                      quickscorer->predict(features_.data(), tracks.size(), scores);
+                    }};
+    });
+    engines_.push_back({"GBDTCompiled", [this](const std::vector<Track>& tracks, float* scores) {
+                          transform(tracks);
+                          CompiledTreeEnsemble<FakeIDGBDTModel>::predict(features_.data(), tracks.size(), scores);
+                        }});
+
+    add("NNFixedPoint", [this] {
+      DenseNetwork nn(edm::FileInPath(nn_model).fullPath(), "input_1", "Sigmoid_Output_Layer");
+      return Engine{"NNFixedPoint", fixedPoint(std::make_shared<const FixedPointModel>(nn, precision()))};
+    });
+    add("GBDTFixedPoint", [this] {
+      TreeEnsemble gbdt(edm::FileInPath(gbdt_model).fullPath());
+      return Engine{"GBDTFixedPoint", fixedPoint(std::make_shared<const FixedPointModel>(gbdt, precision()))};
+    });
+  }
+  // The engines keep pointers to this object
+  PipelineEngines(const PipelineEngines&) = delete;
+  PipelineEngines& operator=(const PipelineEngines&) = delete;
+
+  const std::vector<Engine>& engines() const { return engines_; }
+
+  // Runs the engine over every event, after a few warm up events
+  static Result measure(const Engine& engine, const std::vector<std::vector<Track>>& events) {
+    std::vector<float> scores;
+    for (size_t i = 0; i < std::min<size_t>(events.size(), 10); ++i) {
+      scores.resize(events[i].size());
+      engine.classify(events[i], scores.data());
+    }
+
+    std::vector<double> latencies;
+    double total = 0, score_sum = 0;
+    size_t n_tracks = 0;
+    for (const std::vector<Track>& tracks : events) {
+      scores.resize(tracks.size());
+      auto start = std::chrono::steady_clock::now();
+      engine.classify(tracks, scores.data());
+      double latency = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      latencies.push_back(latency);
+      total += latency;
+      n_tracks += tracks.size();
+      for (float score : scores)
+        score_sum += score;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double fraction) {
+      return 1e6 * latencies[std::min(latencies.size() - 1, size_t(fraction * latencies.size()))];
+    };
+    return {n_tracks / total, 1e9 * total / n_tracks, percentile(0.5), percentile(0.99), score_sum / n_tracks};
+  }
+
+  static void printHeader() {
+    printf("%-18s %12s %10s %12s %12s %10s\n", "", "tracks/s", "ns/track", "p50 us/evt", "p99 us/evt", "mean score");
+  }
+  static void print(const std::string& name, const Result& result) {
+    printf("%-18s %12.4g %10.1f %12.1f %12.1f %10.4f\n", name.c_str(), result.tracks_per_second, result.ns_per_track,
+           result.p50, result.p99, result.mean_score);
+  }
+
+private:
+  static constexpr const char* nn_model = "L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx";
+  static constexpr const char* gbdt_model = "L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx";
+
+  static std::vector<std::string> in_features() {
+    return {"log_chi2",   "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+            "lay3_hits",  "lay4_hits",    "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+            "disk4_hits", "disk5_hits",   "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+  }
+  static FeatureTransform::TransformOptions transformOptions() {
+    FeatureTransform::TransformOptions options;
+    options.log_floor = 1e-3;
+    options.fast_log = true;
+    return options;
+  }
+  static FixedPointPrecision precision() {
+    return {FixedPointType("ap_fixed<16,6>"), FixedPointType("ap_fixed<16,5>"), FixedPointType("ap_fixed<24,8>"),
+            FixedPointType("ap_ufixed<16,0>")};
+  }
+
+  // Rows of features of the event in features_, the transform buffers reused across events
+  void transform(const std::vector<Track>& tracks) {
+    features_.resize(tracks.size() * plan_.nFeatures());
+    if (!tracks.empty())
+      plan_.transformBatch(
+          tracks.data(), tracks.size(), features_.data(), FeatureTransform::Layout::RowMajor, columns_);
+  }
+
+  // Each engine is loaded as the ONNXModelCache of its Algorithm would
+  void add(const std::string& name, const std::function<Engine()>& load) {
+    try {
+      engines_.push_back(load());
+    } catch (const cms::Exception& exception) {
+      printf("%s skipped: %s\n", name.c_str(), exception.message().c_str());
+    }
+  }
+
+  // The features are lent to the ONNX input, as in the producer
+  std::function<void(const std::vector<Track>&, float*)> ort(const std::shared_ptr<ONNXModel>& model) {
+    return [this, model](const std::vector<Track>& tracks, float* scores) {
+      transform(tracks);
+      cms::Ort::FloatArrays input(1);
+      input[0].swap(features_);
+      std::vector<float> output = model->predict(input, tracks.size());
+      features_.swap(input[0]);
+      std::copy(output.begin(), output.end(), scores);
+    };
+  }
+
+  // Digitised into the track word as setTrackWordBits does, then scored from the word bits
+  std::function<void(const std::vector<Track>&, float*)> fixedPoint(const std::shared_ptr<const FixedPointModel>& model) {
+    auto word_features = std::make_shared<const TrackWordFeatures>(in_features(), model->precision().input);
+    auto rows = std::make_shared<std::vector<int64_t>>();
+    return [word_features, model, rows](const std::vector<Track>& tracks, float* scores) {
+      unsigned int n_features = word_features->nFeatures();
+      rows->resize(std::max(rows->size(), tracks.size() * n_features));
+      for (size_t i = 0; i < tracks.size(); ++i) {
+        TrackWordBits bits = word_features->format().digitize(tracks[i]);
+        word_features->fixedPoint(bits, &(*rows)[i * n_features]);
+      }
+      model->predict(rows->data(), tracks.size(), scores);
+    };
+  }
+
+  FeatureTransform::FeaturePlan plan_;
+  FeatureTransform::TrackColumns columns_;
+  std::vector<float> features_;
+  std::vector<Engine> engines_;
+};
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef SyntheticEnsemble_HH
+#define SyntheticEnsemble_HH
+
+/*
+Random binary GBDT of a chosen size written as an ONNX TreeEnsembleClassifier, laid out like the
+XGBoost export of GBDT_model.onnx, so ONNX runtime and the native engines can be compared on
+ensembles with more trees or deeper trees than the trained model
+Thresholds are feature values of random rows, so splits fall where the tracks are
+*/
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SyntheticEnsemble {
+
+  // Protocol buffer encoding of the few ONNX messages needed
+  class Message {
+  public:
+    Message& varint(int field, uint64_t value) {
+      key(field, 0);
+      raw(value);
+      return *this;
+    }
+    Message& bytes(int field, const std::string& value) {
+      key(field, 2);
+      raw(value.size());
+      data_ += value;
+      return *this;
+    }
+    Message& message(int field, const Message& value) { return bytes(field, value.data_); }
+    Message& floats(int field, const std::vector<float>& values) {
+      return bytes(field, std::string((const char*)values.data(), values.size() * sizeof(float)));
+    }
+    Message& ints(int field, const std::vector<int64_t>& values) {
+      Message packed;
+      for (int64_t value : values)
+        packed.raw(value);
+      return bytes(field, packed.data_);
+    }
+    const std::string& data() const { return data_; }
+
+  private:
+    void key(int field, int wire_type) { raw((uint64_t(field) << 3) | wire_type); }
+    void raw(uint64_t value) {
+      for (; value >= 0x80; value >>= 7)
+        data_ += char(value | 0x80);
+      data_ += char(value);
+    }
+    std::string data_;
+  };
+
+  // AttributeProto types
+  enum { FLOATS = 6, INTS = 7, STRING = 3, STRINGS = 8 };
+
+  inline Message intsAttribute(const std::string& name, const std::vector<int64_t>& values) {
+    return Message().bytes(1, name).ints(8, values).varint(20, INTS);
+  }
+  inline Message floatsAttribute(const std::string& name, const std::vector<float>& values) {
+    return Message().bytes(1, name).floats(7, values).varint(20, FLOATS);
+  }
+
+  // Float tensor of shape [N, columns], or [N] of int64 if columns is 0
+  inline Message valueInfo(const std::string& name, unsigned int columns) {
+    Message shape;
+    shape.message(1, Message().bytes(2, "N"));
+    if (columns)
+      shape.message(1, Message().varint(1, columns));
+    Message tensor = Message().varint(1, columns ? 1 : 7).message(2, shape);
+    return Message().bytes(1, name).message(2, Message().message(1, tensor));
+  }
+
+  // Writes n_trees complete trees of the given depth splitting on the columns of rows
+  inline void write(const std::string& path,
+                    unsigned int n_trees,
+                    unsigned int depth,
+                    const std::vector<float>& rows,
+                    unsigned int n_features,
+                    unsigned int seed = 2020) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<unsigned int> pick_feature(0, n_features - 1);
+    std::uniform_int_distribution<size_t> pick_row(0, rows.size() / n_features - 1);
+    std::normal_distribution<float> weight(0., 0.1);
+
+    std::vector<int64_t> tree_ids, node_ids, feature_ids, true_ids, false_ids, missing;
+    std::vector<float> thresholds;
+    Message modes = Message().bytes(1, "nodes_modes").varint(20, STRINGS);
+    std::vector<int64_t> class_tree_ids, class_node_ids, class_ids;
+    std::vector<float> class_weights;
+
+    // Nodes are numbered breadth first, the children of node i are 2i+1 and 2i+2
+    int64_t n_branches = (int64_t(1) << depth) - 1;
+    for (unsigned int tree = 0; tree < n_trees; ++tree) {
+      for (int64_t node = 0; node < 2 * n_branches + 1; ++node) {
+        bool leaf = node >= n_branches;
+        unsigned int feature = pick_feature(rng);
+        tree_ids.push_back(tree);
+        node_ids.push_back(node);
+        feature_ids.push_back(leaf ? 0 : feature);
+        thresholds.push_back(leaf ? 0 : rows[pick_row(rng) * n_features + feature]);
+        true_ids.push_back(leaf ? 0 : 2 * node + 1);
+        false_ids.push_back(leaf ? 0 : 2 * node + 2);
+        missing.push_back(!leaf);
+        modes.bytes(9, leaf ? "LEAF" : "BRANCH_LT");
+        if (leaf) {
+          class_tree_ids.push_back(tree);
+          class_node_ids.push_back(node);
+          class_ids.push_back(0);
+          class_weights.push_back(weight(rng));
+        }
+      }
+    }
+
+    Message node;
+    node.bytes(1, "feature_input").bytes(2, "label").bytes(2, "probabilities");
+    node.bytes(3, "TreeEnsembleClassifier").bytes(4, "TreeEnsembleClassifier").bytes(7, "ai.onnx.ml");
+    node.message(5, intsAttribute("class_ids", class_ids));
+    node.message(5, intsAttribute("class_nodeids", class_node_ids));
+    node.message(5, intsAttribute("class_treeids", class_tree_ids));
+    node.message(5, floatsAttribute("class_weights", class_weights));
+    node.message(5, intsAttribute("classlabels_int64s", {0, 1}));
+    node.message(5, intsAttribute("nodes_falsenodeids", false_ids));
+    node.message(5, intsAttribute("nodes_featureids", feature_ids));
+    node.message(5, intsAttribute("nodes_missing_value_tracks_true", missing));
+    node.message(5, modes);
+    node.message(5, intsAttribute("nodes_nodeids", node_ids));
+    node.message(5, intsAttribute("nodes_treeids", tree_ids));
+    node.message(5, intsAttribute("nodes_truenodeids", true_ids));
+    node.message(5, floatsAttribute("nodes_values", thresholds));
+    node.message(5, Message().bytes(1, "post_transform").bytes(4, "LOGISTIC").varint(20, STRING));
+
+    Message graph;
+    graph.message(1, node).bytes(2, "synthetic_gbdt");
+    graph.message(11, valueInfo("feature_input", n_features));
+    graph.message(12, valueInfo("label", 0)).message(12, valueInfo("probabilities", 2));
+
+    Message model;
+    model.varint(1, 7).bytes(2, "SyntheticEnsemble").message(7, graph);
+    model.message(8, Message().bytes(1, "ai.onnx.ml").varint(2, 1));
+
+    std::ofstream(path, std::ios::binary) << model.data();
+  }
+
+}  // namespace SyntheticEnsemble
+#endif
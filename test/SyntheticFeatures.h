@@ -0,0 +1,48 @@
+#ifndef SyntheticFeatures_HH
+#define SyntheticFeatures_HH
+
+/*
+Random rows of transformed features for the inference benchmarks, in the in_features order of
+Classifier_cff.py, drawn from rough approximations of the PU200 track distributions
+*/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace SyntheticFeatures {
+
+  const unsigned int n_features = 21;
+
+  // n_tracks x n_features, row major
+  inline std::vector<float> generate(unsigned int n_tracks, unsigned int seed = 12345) {
+    std::mt19937 rng(seed);
+    std::exponential_distribution<float> chi2(0.1), chi2rphi(0.15), chi2rz(0.25), bendchi2(0.7);
+    std::bernoulli_distribution hit(0.75);
+    std::uniform_real_distribution<float> rinv(0., 2.85);  // 500 x |rInv| for pt above 2 GeV
+    std::normal_distribution<float> tanl(0., 1.8), z0(0., 6.);
+
+    std::vector<float> rows(size_t(n_tracks) * n_features);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+      float* row = &rows[size_t(i) * n_features];
+      row[0] = std::log(chi2(rng));
+      row[1] = std::log(bendchi2(rng));
+      row[2] = std::log(chi2rphi(rng));
+      row[3] = std::log(chi2rz(rng));
+      int ltot = 0, dtot = 0;
+      for (int layer = 0; layer < 11; ++layer) {
+        row[5 + layer] = hit(rng);
+        (layer < 6 ? ltot : dtot) += row[5 + layer];
+      }
+      row[4] = ltot + dtot;
+      row[16] = rinv(rng);
+      row[17] = std::abs(tanl(rng));
+      row[18] = std::abs(z0(rng));
+      row[19] = dtot;
+      row[20] = ltot;
+    }
+    return rows;
+  }
+
+}  // namespace SyntheticFeatures
+#endif
@@ -0,0 +1,89 @@
+#ifndef SyntheticTracks_HH
+#define SyntheticTracks_HH
+
+/*
+Random TTTracks for the feature transform benchmarks, with the parameters, chi2 and hit
+patterns drawn from rough approximations of the PU200 track distributions
+event() draws the tracks of one bunch crossing at a given pileup instead, as a mix of genuine
+and fake tracks with stubs attached
+*/
+
+#include "DataFormats/L1TrackTrigger/interface/TTTrack.h"
+#include "DataFormats/L1TrackTrigger/interface/TTTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace SyntheticTracks {
+
+  typedef TTTrack<Ref_Phase2TrackerDigi_> Track;
+
+  inline std::vector<Track> generate(unsigned int n_tracks, unsigned int seed = 12345) {
+    const double bfield = 3.8112;  // in T
+    std::mt19937 rng(seed);
+    std::exponential_distribution<double> chi2rphi(0.15), chi2rz(0.25), bendchi2(0.7);
+    std::uniform_real_distribution<double> rinv(-0.0057, 0.0057), phi(-M_PI, M_PI);  // pt above 2 GeV
+    std::normal_distribution<double> tanl(0., 1.8), z0(0., 6.);
+    std::bernoulli_distribution hit(0.75);
+
+    std::vector<Track> tracks;
+    tracks.reserve(n_tracks);
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+      unsigned int hitpattern = 0;
+      for (int bit = 0; bit < 7; ++bit)
+        hitpattern |= hit(rng) << bit;
+      double r = rinv(rng), p = phi(rng), t = tanl(rng), z = z0(rng), xy = chi2rphi(rng), rz = chi2rz(rng);
+      tracks.emplace_back(r, p, t, z, 0., xy, rz, 0., 0., 0., hitpattern, 4, bfield);
+      tracks.back().setStubPtConsistency(bendchi2(rng));
+    }
+    return tracks;
+  }
+
+  // Tracks of one bunch crossing: about 1.3 tracks above 2 GeV per pileup interaction, of which
+  // the fakes are a fraction growing from 5% to 20% at PU200. Genuine tracks come from vertices
+  // spread along the beam line with a falling pt spectrum, chi2 distributed for their degrees of
+  // freedom and nearly every expected layer hit. Fakes are flat in z0 with large chi2, bend chi2
+  // and missing layers. Each track has one null stub reference per hit, at least 4
+  inline std::vector<Track> event(double pileup, std::mt19937& rng) {
+    const double bfield = 3.8112;                           // in T
+    const double curvature = 0.299792458 * bfield / 100.0;  // rinv * pt, rinv in cm-1
+    std::poisson_distribution<unsigned int> n_tracks(1.3 * pileup);
+    std::bernoulli_distribution fake(std::min(0.05 + 0.15 * pileup / 200., 0.5)), positive(0.5);
+    std::uniform_real_distribution<double> unit(0., 1.), eta(-2.4, 2.4), phi(-M_PI, M_PI), fake_z0(-15., 15.);
+    std::normal_distribution<double> vertex_z0(0., 5.), resolution_z0(0., 0.3);
+    std::exponential_distribution<double> fake_chi2(0.05), bendchi2(1.25), fake_bendchi2(0.33);
+    std::bernoulli_distribution hit(0.92), fake_hit(0.7);
+
+    std::vector<Track> tracks;
+    unsigned int n = n_tracks(rng);
+    tracks.reserve(n);
+    for (unsigned int i = 0; i < n; ++i) {
+      bool is_fake = fake(rng);
+      unsigned int hitpattern = 0, n_stubs = 0;
+      while (n_stubs < 4) {
+        hitpattern = 0;
+        for (int bit = 0; bit < 7; ++bit)
+          hitpattern |= (is_fake ? fake_hit(rng) : hit(rng)) << bit;
+        n_stubs = __builtin_popcount(hitpattern);
+      }
+
+      double pt = 2. / std::sqrt(1. - unit(rng));  // pt^-3 above 2 GeV
+      double r = (positive(rng) ? 1 : -1) * curvature / pt;
+      double t = std::sinh(eta(rng));
+      double z = is_fake ? fake_z0(rng) : vertex_z0(rng) + resolution_z0(rng);
+      // n_stubs - 2 degrees of freedom in each view
+      std::gamma_distribution<double> chi2((n_stubs - 2) / 2., 2.);
+      double xy = is_fake ? fake_chi2(rng) : chi2(rng), rz = is_fake ? fake_chi2(rng) : chi2(rng);
+
+      tracks.emplace_back(r, phi(rng), t, z, 0., xy, rz, 0., 0., 0., hitpattern, 4, bfield);
+      tracks.back().setStubPtConsistency(is_fake ? fake_bendchi2(rng) : bendchi2(rng));
+      for (unsigned int stub = 0; stub < n_stubs; ++stub)
+        tracks.back().addStubRef({});
+    }
+    return tracks;
+  }
+
+}  // namespace SyntheticTracks
+#endif
@@ -0,0 +1,101 @@
+/*
+Compares the feature transform paths on synthetic tracks: Transform (names resolved per track),
+FeaturePlan::transform track by track, and FeaturePlan::transformBatch writing row and column
+major matrices, with the logs from std::log and from FastLog. Prints tracks/sec for each, returns
+1 if the batch features with std::log differ from the per track ones
+  benchFeatureTransform [n_tracks] [batch_size]
+*/
+
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "SyntheticTracks.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+using namespace FeatureTransform;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// tracks/sec of transform() run over all tracks in batches of batch_size, best of three
+static double throughput(unsigned int n_tracks, unsigned int batch_size, const std::function<void(unsigned int, unsigned int)>& transform) {
+  double best = 0;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int first = 0; first < n_tracks; first += batch_size)
+      transform(first, std::min(batch_size, n_tracks - first));
+    best = std::max(best, n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 200000;
+  unsigned int batch_size = argc > 2 ? std::atoi(argv[2]) : 256;  // about the tracks of a PU200 event
+
+  std::vector<SyntheticTracks::Track> tracks = SyntheticTracks::generate(n_tracks);
+  FeaturePlan plan(in_features);
+  unsigned int n_features = plan.nFeatures();
+  TrackColumns columns;
+  std::vector<float> per_track(size_t(n_tracks) * n_features), row_major(per_track.size()), column_major(per_track.size());
+  std::vector<float> scratch(size_t(batch_size) * n_features);
+
+  double legacy_rate = throughput(n_tracks, batch_size, [&](unsigned int first, unsigned int n) {
+    for (unsigned int i = first; i < first + n; ++i) {
+      std::vector<float> row = Transform(tracks[i], in_features);
+      std::copy(row.begin(), row.end(), &per_track[size_t(i) * n_features]);
+    }
+  });
+  double plan_rate = throughput(n_tracks, batch_size, [&](unsigned int first, unsigned int n) {
+    for (unsigned int i = first; i < first + n; ++i)
+      plan.transform(tracks[i], &per_track[size_t(i) * n_features]);
+  });
+  double row_rate = throughput(n_tracks, batch_size, [&](unsigned int first, unsigned int n) {
+    plan.transformBatch(&tracks[first], n, &row_major[size_t(first) * n_features], Layout::RowMajor, columns);
+  });
+  // Column major batches are written to scratch and scattered below for the comparison
+  double column_rate = throughput(n_tracks, batch_size, [&](unsigned int first, unsigned int n) {
+    plan.transformBatch(&tracks[first], n, scratch.data(), Layout::ColumnMajor, columns);
+  });
+  TransformOptions fast_options;
+  fast_options.fast_log = true;
+  FeaturePlan fast_plan(in_features, fast_options);
+  std::vector<float> fast_log(per_track.size());
+  double fast_rate = throughput(n_tracks, batch_size, [&](unsigned int first, unsigned int n) {
+    fast_plan.transformBatch(&tracks[first], n, &fast_log[size_t(first) * n_features], Layout::RowMajor, columns);
+  });
+  double fast_diff = 0;
+  for (size_t i = 0; i < per_track.size(); ++i)
+    fast_diff = std::max(fast_diff, double(std::abs(fast_log[i] - per_track[i])));
+
+  for (unsigned int first = 0; first < n_tracks; first += batch_size) {
+    unsigned int n = std::min(batch_size, n_tracks - first);
+    plan.transformBatch(&tracks[first], n, scratch.data(), Layout::ColumnMajor, columns);
+    for (unsigned int f = 0; f < n_features; ++f)
+      for (unsigned int i = 0; i < n; ++i)
+        column_major[size_t(first + i) * n_features + f] = scratch[size_t(f) * n + i];
+  }
+
+  printf("%u tracks, %u features, batches of %u tracks\n", n_tracks, n_features, batch_size);
+  printf("%-34s %10.3g tracks/s\n", "Transform (names per track)", legacy_rate);
+  printf("%-34s %10.3g tracks/s\n", "FeaturePlan::transform", plan_rate);
+  printf("%-34s %10.3g tracks/s  x%.2f\n", "FeaturePlan::transformBatch rows", row_rate, row_rate / plan_rate);
+  printf("%-34s %10.3g tracks/s  x%.2f\n", "FeaturePlan::transformBatch cols", column_rate, column_rate / plan_rate);
+  printf("%-34s %10.3g tracks/s  x%.2f, max |feature difference| %g\n", "FeaturePlan::transformBatch FastLog",
+         fast_rate, fast_rate / plan_rate, fast_diff);
+
+  // Bitwise comparison, NaN included
+  bool same = !memcmp(per_track.data(), row_major.data(), per_track.size() * sizeof(float)) &&
+              !memcmp(per_track.data(), column_major.data(), per_track.size() * sizeof(float));
+  if (!same) {
+    printf("FAILED: batch features differ from the per track features\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*
+Compares the native GBDT evaluator (TreeEnsemble) with ONNX runtime on synthetic tracks
+Prints the largest score difference and the tracks/sec of both engines for several batch sizes,
+returns 1 if the scores differ by more than the tolerance
+  benchGBDTNative [n_tracks] [tolerance]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticFeatures.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+// tracks/sec of score() run over all tracks in batches of batch_size
+static double throughput(unsigned int n_tracks, unsigned int batch_size, const std::function<void(unsigned int, unsigned int)>& score) {
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int first = 0; first < n_tracks; first += batch_size)
+    score(first, std::min(batch_size, n_tracks - first));
+  return n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 100000;
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 1e-6;
+
+  std::string path = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  ONNXModel ort(path, "feature_input", {}, 1, 2);
+  TreeEnsemble native(path);
+  printf("%s: %u trees, %u nodes, max depth %u\n", path.c_str(), native.nTrees(), native.nNodes(), native.maxDepth());
+
+  unsigned int n_features = SyntheticFeatures::n_features;
+  std::vector<float> features = SyntheticFeatures::generate(n_tracks);
+  std::vector<float> ort_scores(n_tracks), native_scores(n_tracks);
+
+  auto run_ort = [&](unsigned int first, unsigned int n) {
+    cms::Ort::FloatArrays input(1);
+    input[0].assign(features.begin() + size_t(first) * n_features, features.begin() + size_t(first + n) * n_features);
+    std::vector<float> scores = ort.predict(input, n);
+    std::copy(scores.begin(), scores.end(), ort_scores.begin() + first);
+  };
+  auto run_native = [&](unsigned int first, unsigned int n) {
+    native.predict(&features[size_t(first) * n_features], n, &native_scores[first]);
+  };
+
+  // Parity
+  run_ort(0, n_tracks);
+  run_native(0, n_tracks);
+  double max_diff = 0;
+  unsigned int n_identical = 0;
+  for (unsigned int i = 0; i < n_tracks; ++i) {
+    max_diff = std::max(max_diff, double(std::abs(ort_scores[i] - native_scores[i])));
+    n_identical += ort_scores[i] == native_scores[i];
+  }
+  printf("parity: max |native - ORT| = %g, %u / %u scores bitwise identical\n", max_diff, n_identical, n_tracks);
+
+  // Throughput
+  printf("%10s %16s %16s %8s\n", "batch", "ORT tracks/s", "native tracks/s", "speedup");
+  for (unsigned int batch_size : {1u, 16u, 256u, 4096u}) {
+    double ort_rate = throughput(n_tracks, batch_size, run_ort);
+    double native_rate = throughput(n_tracks, batch_size, run_native);
+    printf("%10u %16.3g %16.3g %8.1f\n", batch_size, ort_rate, native_rate, native_rate / ort_rate);
+  }
+
+  if (max_diff > tolerance) {
+    printf("FAILED: scores differ by more than %g\n", tolerance);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,102 @@
+/*
+Compares the QuickScorer GBDT evaluation with the flattened tree walk (TreeEnsemble) and ONNX
+runtime, first on the trained model then on random ensembles of increasing tree count and depth
+Prints the tracks/sec of the three engines and the largest score differences, returns 1 if
+QuickScorer differs from ONNX runtime by more than the tolerance
+  benchGBDTQuickScorer [n_tracks] [tolerance]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticEnsemble.h"
+#include "SyntheticFeatures.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+// tracks/sec of score() run over all tracks in batches of batch_size
+static double throughput(unsigned int n_tracks, unsigned int batch_size, const std::function<void(unsigned int, unsigned int)>& score) {
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int first = 0; first < n_tracks; first += batch_size)
+    score(first, std::min(batch_size, n_tracks - first));
+  return n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double maxDiff(const std::vector<float>& a, const std::vector<float>& b) {
+  double max_diff = 0;
+  for (size_t i = 0; i < a.size(); ++i)
+    max_diff = std::max(max_diff, double(std::abs(a[i] - b[i])));
+  return max_diff;
+}
+
+// Runs the three engines on the model at path and prints one line per batch size, returns the
+// largest difference between QuickScorer and ONNX runtime
+static double compare(const std::string& label, const std::string& path, const std::vector<float>& features,
+                      const std::vector<unsigned int>& batch_sizes) {
+  unsigned int n_features = SyntheticFeatures::n_features;
+  unsigned int n_tracks = features.size() / n_features;
+  ONNXModel ort(path, "feature_input", {}, 1, 2);
+  TreeEnsemble native(path);
+  QuickScorer quickscorer(native);
+  std::vector<float> ort_scores(n_tracks), native_scores(n_tracks), qs_scores(n_tracks);
+
+  auto run_ort = [&](unsigned int first, unsigned int n) {
+    cms::Ort::FloatArrays input(1);
+    input[0].assign(features.begin() + size_t(first) * n_features, features.begin() + size_t(first + n) * n_features);
+    std::vector<float> scores = ort.predict(input, n);
+    std::copy(scores.begin(), scores.end(), ort_scores.begin() + first);
+  };
+  auto run_native = [&](unsigned int first, unsigned int n) {
+    native.predict(&features[size_t(first) * n_features], n, &native_scores[first]);
+  };
+  auto run_qs = [&](unsigned int first, unsigned int n) {
+    quickscorer.predict(&features[size_t(first) * n_features], n, &qs_scores[first]);
+  };
+
+  run_ort(0, n_tracks);
+  run_native(0, n_tracks);
+  run_qs(0, n_tracks);
+  double ort_diff = maxDiff(qs_scores, ort_scores);
+
+  for (unsigned int batch_size : batch_sizes) {
+    double ort_rate = throughput(n_tracks, batch_size, run_ort);
+    double native_rate = throughput(n_tracks, batch_size, run_native);
+    double qs_rate = throughput(n_tracks, batch_size, run_qs);
+    printf("%-18s %6u %5u %6u %12.3g %12.3g %12.3g %10.2g %10.2g\n", label.c_str(), native.nTrees(), native.maxDepth(),
+           batch_size, ort_rate, native_rate, qs_rate, ort_diff, maxDiff(qs_scores, native_scores));
+  }
+  return ort_diff;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 100000;
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 1e-6;
+  std::vector<float> features = SyntheticFeatures::generate(n_tracks);
+
+  std::string path = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  printf("QuickScorer %s AVX2\n", QuickScorer(TreeEnsemble(path)).vectorised() ? "with" : "without");
+  printf("%-18s %6s %5s %6s %12s %12s %12s %10s %10s\n", "model", "trees", "depth", "batch", "ORT trk/s",
+         "native trk/s", "QS trk/s", "|QS-ORT|", "|QS-nat|");
+  double worst = compare("GBDT_model.onnx", path, features, {1, 16, 256, 4096});
+
+  // Random ensembles over tree count at the depth of the trained model, then over depth
+  std::vector<std::pair<unsigned int, unsigned int>> shapes = {{50, 3}, {100, 3}, {200, 3}, {400, 3}, {800, 3},
+                                                               {100, 2}, {100, 4}, {100, 5}};
+  std::string synthetic_path = "benchGBDTQuickScorer_synthetic.onnx";
+  for (const auto& shape : shapes) {
+    SyntheticEnsemble::write(synthetic_path, shape.first, shape.second, features, SyntheticFeatures::n_features);
+    worst = std::max(worst, compare("synthetic", synthetic_path, features, {4096}));
+  }
+  std::remove(synthetic_path.c_str());
+
+  if (worst > tolerance) {
+    printf("FAILED: QuickScorer and ONNX runtime scores differ by up to %g\n", worst);
+    return 1;
+  }
+  return 0;
+}
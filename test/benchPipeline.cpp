@@ -0,0 +1,37 @@
+/*
+Benchmark of the whole classification of synthetic events at a given pileup, as done by
+L1TrackClassifier for each Algorithm: the Cut on the track members, FeaturePlan::transformBatch
+alone, and the transform followed by each scoring engine (the fixed point engines digitise the
+tracks into track words instead). Prints for each the tracks/sec, ns/track, the median and 99th
+percentile of the per event latency and the mean score. Engines whose model cannot be loaded,
+ONNX runtime in a standalone build without it, are skipped
+Builds in CMSSW, or anywhere with test/standalone/Makefile
+  benchPipeline [pileup] [n_events] [seed]
+*/
+
+#include "PipelineEngines.h"
+#include "SyntheticTracks.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 2000;
+  unsigned int seed = argc > 3 ? std::atoi(argv[3]) : 12345;
+
+  std::mt19937 rng(seed);
+  std::vector<std::vector<SyntheticTracks::Track>> events;
+  size_t n_tracks = 0;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    events.push_back(SyntheticTracks::event(pileup, rng));
+    n_tracks += events.back().size();
+  }
+  printf("%u events at pileup %g, %.1f tracks per event\n", n_events, pileup, double(n_tracks) / n_events);
+
+  PipelineEngines pipeline;
+  PipelineEngines::printHeader();
+  for (const PipelineEngines::Engine& engine : pipeline.engines())
+    PipelineEngines::print(engine.name, PipelineEngines::measure(engine, events));
+  return 0;
+}
@@ -0,0 +1,150 @@
+/*
+Output of L1TrackClassifier per event for each outputMode, on synthetic events at a given
+pileup scored by GBDTNative: Tracks copies every track with its stub refs and sets its MVA fields,
+ValueMap keeps only the three MVA values of each track for the ValueMaps of the input collection,
+and Selected keeps refs to the tracks above the working point with their scores. Prints the bytes
+held by the output of an event, the time taken to fill it, and the time a downstream consumer
+summing the transverse momentum of the accepted tracks (as track MET does) spends on it. The size
+written to file is measured with edmEventSize on the outputFile of
+L1TrackClassifierThreadScaling_cfg.py
+  benchScoreOutput [pileup] [n_events] [working point]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace FeatureTransform;
+
+typedef SyntheticTracks::Track Track;
+
+struct Result {
+  double bytes = 0;  // per event
+  double fill = 0;   // seconds
+  double consume = 0;
+};
+
+static double since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 2000;
+  float working_point = argc > 3 ? std::atof(argv[3]) : 0.5;
+
+  std::mt19937 rng(12345);
+  std::vector<std::vector<Track>> events;
+  size_t n_tracks = 0;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    events.push_back(SyntheticTracks::event(pileup, rng));
+    n_tracks += events.back().size();
+  }
+
+  // Scores of every track, the MVA1 the classifier computes
+  TreeEnsemble gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath());
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan plan({"log_chi2",   "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+                    "lay3_hits",  "lay4_hits",    "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+                    "disk4_hits", "disk5_hits",   "rinv",         "tanl",       "z0",         "dtot",       "ltot"},
+                   options);
+  TrackColumns columns;
+  std::vector<std::vector<float>> scores(n_events);
+  std::vector<float> features;
+  size_t n_accepted = 0;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    features.resize(events[i].size() * plan.nFeatures());
+    scores[i].resize(events[i].size());
+    if (events[i].empty())
+      continue;
+    plan.transformBatch(events[i].data(), events[i].size(), features.data(), Layout::RowMajor, columns);
+    gbdt.predict(features.data(), events[i].size(), scores[i].data());
+    for (float score : scores[i])
+      n_accepted += score > working_point;
+  }
+  printf("%u events at pileup %g, %.1f tracks per event, %.1f above %g\n", n_events, pileup,
+         double(n_tracks) / n_events, double(n_accepted) / n_events, working_point);
+  printf("%zu bytes per TTTrack and %zu per stub ref\n", sizeof(Track), sizeof(Track().getStubRefs()[0]));
+
+  // Each event filled into a new output, as the producer puts new products per event
+  Result tracks, valueMap, selected;
+  double met = 0;
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    tracks = valueMap = selected = Result();
+    for (unsigned int event = 0; event < n_events; ++event) {
+      const std::vector<Track>& input = events[event];
+      const std::vector<float>& score = scores[event];
+
+      auto start = std::chrono::steady_clock::now();
+      auto copy = std::make_unique<std::vector<Track>>();
+      copy->reserve(input.size());
+      for (size_t i = 0; i < input.size(); ++i) {
+        copy->push_back(input[i]);
+        copy->back().settrkMVA1(score[i]);
+      }
+      tracks.fill += since(start);
+      tracks.bytes += copy->capacity() * sizeof(Track);
+      for (const Track& track : *copy)
+        tracks.bytes += track.getStubRefs().size() * sizeof(track.getStubRefs()[0]);
+      start = std::chrono::steady_clock::now();
+      for (const Track& track : *copy)
+        if (track.trkMVA1() > working_point)
+          met += track.momentum().perp();
+      tracks.consume += since(start);
+
+      start = std::chrono::steady_clock::now();
+      std::vector<float> mva[3];
+      for (std::vector<float>& values : mva)
+        values.reserve(input.size());
+      for (size_t i = 0; i < input.size(); ++i) {
+        mva[0].push_back(score[i]);
+        mva[1].push_back(input[i].trkMVA2());
+        mva[2].push_back(input[i].trkMVA3());
+      }
+      valueMap.fill += since(start);
+      // A ValueMap also holds the ProductID and offset of the collection it refers to
+      for (const std::vector<float>& values : mva)
+        valueMap.bytes += values.capacity() * sizeof(float) + 16;
+      start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < input.size(); ++i)
+        if (mva[0][i] > working_point)
+          met += input[i].momentum().perp();
+      valueMap.consume += since(start);
+
+      // A RefVector holds one RefCore and, per ref, the key and a cached pointer
+      start = std::chrono::steady_clock::now();
+      std::vector<unsigned int> keys;
+      std::vector<float> accepted;
+      for (size_t i = 0; i < input.size(); ++i) {
+        if (score[i] > working_point) {
+          keys.push_back(i);
+          accepted.push_back(score[i]);
+        }
+      }
+      unsigned int n_selected = keys.size();
+      selected.fill += since(start);
+      selected.bytes += keys.capacity() * (sizeof(unsigned int) + sizeof(void*)) + 24 +
+                        accepted.capacity() * sizeof(float) + sizeof(n_selected);
+      start = std::chrono::steady_clock::now();
+      for (unsigned int key : keys)
+        met += input[key].momentum().perp();
+      selected.consume += since(start);
+    }
+  }
+
+  printf("%-10s %14s %14s %16s\n", "", "bytes/event", "fill us/event", "consume us/event");
+  for (auto mode : {std::make_pair("Tracks", tracks), std::make_pair("ValueMap", valueMap),
+                    std::make_pair("Selected", selected)})
+    printf("%-10s %14.0f %14.2f %16.2f\n", mode.first, mode.second.bytes / n_events, 1e6 * mode.second.fill / n_events,
+           1e6 * mode.second.consume / n_events);
+  printf("(sum of accepted pt %g)\n", met);
+  return 0;
+}
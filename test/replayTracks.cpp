@@ -0,0 +1,80 @@
+/*
+Replays the events of a track record written by L1TrackRecorder (interface/TrackRecordFile.h):
+the memory mapped file is read into TTTracks, which every engine then classifies as in
+benchPipeline, printing the same table. The engine of the recorded Algorithm is checked against
+the recorded MVA fields (for All the Cut against MVA1 and the GBDT against MVA3), which holds for
+records made with the default Classifier_cff.py options. Returns 1 if a score differs by more
+than the tolerance
+  replayTracks file [tolerance]
+*/
+
+#include "L1Trigger/TrackQuality/interface/TrackRecordFile.h"
+#include "PipelineEngines.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    printf("usage: replayTracks file [tolerance]\n");
+    return 1;
+  }
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 1e-5;
+
+  TrackRecordReader reader(argv[1]);
+  std::vector<std::vector<PipelineEngines::Track>> events(reader.nEvents());
+  size_t n_tracks = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < reader.nEvents(); ++i) {
+    reader.read(i, events[i]);
+    n_tracks += events[i].size();
+  }
+  double read_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%s: %lu events, %.1f tracks per event, %s, classified by %s\n", argv[1], (unsigned long)reader.nEvents(),
+         double(n_tracks) / std::max<uint64_t>(reader.nEvents(), 1), reader.compressed() ? "compressed" : "uncompressed",
+         reader.algorithm().c_str());
+  printf("read in %.1f ms, %.3g tracks/s\n", 1e3 * read_time, n_tracks / read_time);
+
+  PipelineEngines pipeline;
+  PipelineEngines::printHeader();
+  for (const PipelineEngines::Engine& engine : pipeline.engines())
+    PipelineEngines::print(engine.name, PipelineEngines::measure(engine, events));
+
+  // Engines and the MVA field they filled when the events were recorded, the default allEngines
+  // for All
+  std::vector<std::pair<std::string, unsigned int>> checks;
+  if (reader.algorithm() == "All")
+    checks = {{"Cut", 0}, {"NN", 1}, {"GBDT", 2}};
+  else if (reader.algorithm() != "None")
+    checks = {{reader.algorithm(), 0}};
+
+  bool ok = true;
+  for (const auto& check : checks) {
+    auto engine = std::find_if(pipeline.engines().begin(), pipeline.engines().end(),
+                               [&](const PipelineEngines::Engine& engine) { return engine.name == check.first; });
+    if (engine == pipeline.engines().end()) {
+      printf("%s not available, MVA%u not checked\n", check.first.c_str(), check.second + 1);
+      continue;
+    }
+    double max_diff = 0;
+    std::vector<float> scores;
+    for (const std::vector<PipelineEngines::Track>& tracks : events) {
+      scores.resize(tracks.size());
+      engine->classify(tracks, scores.data());
+      for (size_t i = 0; i < tracks.size(); ++i) {
+        double recorded = check.second == 0 ? tracks[i].trkMVA1() : tracks[i].trkMVA3();
+        max_diff = std::max(max_diff, std::abs(scores[i] - recorded));
+      }
+    }
+    printf("%s against the recorded MVA%u: max deviation %.3g\n", check.first.c_str(), check.second + 1, max_diff);
+    ok &= max_diff <= tolerance;
+  }
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,19 @@
+#!/bin/bash
+# Runs L1TrackClassifierThreadScaling_cfg.py with 1, 2, 4, 8 and 16 threads and prints
+# the event throughput of each job, extra arguments are passed on to cmsRun, e.g.
+#   ./runThreadScaling.sh inputFiles=file:output_dataset.root Algorithm=GBDT
+
+CFG=$(dirname $0)/L1TrackClassifierThreadScaling_cfg.py
+
+printf "%8s %14s %10s\n" "threads" "events/s" "speedup"
+for THREADS in 1 2 4 8 16; do
+  LOG=threadScaling_${THREADS}.log
+  cmsRun $CFG nThreads=$THREADS "$@" > $LOG 2>&1
+  RATE=$(grep "Average throughput" $LOG | tail -1 | sed 's/.*Average throughput: *\([0-9.e+-]*\).*/\1/')
+  if [ -z "$RATE" ]; then
+    echo "cmsRun failed with $THREADS threads, see $LOG"
+    exit 1
+  fi
+  if [ $THREADS -eq 1 ]; then BASE=$RATE; fi
+  printf "%8d %14.1f %10.2f\n" $THREADS $RATE $(echo "$RATE / $BASE" | bc -l)
+done
@@ -0,0 +1,140 @@
+#ifndef L1_TRACK_TRIGGER_TRACK_FORMAT_H
+#define L1_TRACK_TRIGGER_TRACK_FORMAT_H
+
+/*
+Stand-in for the CMSSW TTTrack used by the standalone build of the benchmarks
+Keeps the members read by the feature transform and the cut classifier, computed as in
+util/TTTrack.h: the momentum is a float vector built from rInv, phi and tanL in the given field,
+and the chi2 is the sum of the r-phi and r-z chi2, or given alone with both of them -999 by the
+constructor without the split chi2. The stubs are null references, only their
+number is meaningful, and the track word bits are not filled
+*/
+
+#include <cmath>
+#include <vector>
+
+class GlobalVector {
+public:
+  GlobalVector() : x_(0), y_(0), z_(0) {}
+  GlobalVector(float x, float y, float z) : x_(x), y_(y), z_(z) {}
+
+  float x() const { return x_; }
+  float y() const { return y_; }
+  float z() const { return z_; }
+  float perp() const { return std::sqrt(x_ * x_ + y_ * y_); }
+  float eta() const {
+    float ratio = z_ / perp();
+    return std::log(ratio + std::sqrt(ratio * ratio + 1.f));
+  }
+
+private:
+  float x_, y_, z_;
+};
+
+// A stub reference of a track, null here but of the size of an edm::Ref (product pointer,
+// ProductID, product getter and key) so copies of the tracks cost what they do in CMSSW
+template <typename T>
+struct TTStubRef {
+  const void* product = nullptr;
+  unsigned int process_and_product = 0;
+  const void* getter = nullptr;
+  unsigned int key = 0;
+};
+
+template <typename T>
+class TTTrack {
+public:
+  TTTrack() {}
+  TTTrack(double aRinv,
+          double aphi0,
+          double aTanlambda,
+          double az0,
+          double ad0,
+          double aChi2XY,
+          double aChi2Z,
+          double trkMVA1,
+          double trkMVA2,
+          double trkMVA3,
+          unsigned int aHitPattern,
+          unsigned int nPar,
+          double aBfield)
+      : theRInv_(aRinv),
+        thePhi_(aphi0),
+        theTanL_(aTanlambda),
+        theD0_(ad0),
+        theZ0_(az0),
+        theChi2_(aChi2XY + aChi2Z),
+        theChi2_XY_(aChi2XY),
+        theChi2_Z_(aChi2Z),
+        theNumFitPars_(nPar),
+        theHitPattern_(aHitPattern),
+        theTrkMVA1_(trkMVA1),
+        theTrkMVA2_(trkMVA2),
+        theTrkMVA3_(trkMVA3) {
+    double pt = std::abs(MagConstant / aRinv * aBfield / 100.0);  // Rinv is in cm-1
+    theMomentum_ = GlobalVector(pt * std::cos(aphi0), pt * std::sin(aphi0), pt * aTanlambda);
+  }
+  TTTrack(double aRinv,
+          double aphi0,
+          double aTanlambda,
+          double az0,
+          double ad0,
+          double aChi2,
+          double trkMVA1,
+          double trkMVA2,
+          double trkMVA3,
+          unsigned int aHitPattern,
+          unsigned int nPar,
+          double aBfield)
+      : TTTrack(aRinv, aphi0, aTanlambda, az0, ad0, -999., -999., trkMVA1, trkMVA2, trkMVA3, aHitPattern, nPar, aBfield) {
+    theChi2_ = aChi2;
+  }
+
+  std::vector<TTStubRef<T> > getStubRefs() const { return theStubRefs; }
+  void addStubRef(TTStubRef<T> aStub) { theStubRefs.push_back(aStub); }
+
+  GlobalVector momentum() const { return theMomentum_; }
+  double rInv() const { return theRInv_; }
+  double phi() const { return thePhi_; }
+  double tanL() const { return theTanL_; }
+  double d0() const { return theD0_; }
+  double z0() const { return theZ0_; }
+  double eta() const { return theMomentum_.eta(); }
+
+  double chi2() const { return theChi2_; }
+  double chi2XY() const { return theChi2_XY_; }
+  double chi2Z() const { return theChi2_Z_; }
+  double stubPtConsistency() const { return theStubPtConsistency_; }
+  void setStubPtConsistency(double aPtConsistency) { theStubPtConsistency_ = aPtConsistency; }
+  int nFitPars() const { return theNumFitPars_; }
+  unsigned int hitPattern() const { return theHitPattern_; }
+
+  double trkMVA1() const { return theTrkMVA1_; }
+  void settrkMVA1(double atrkMVA1) { theTrkMVA1_ = atrkMVA1; }
+  double trkMVA2() const { return theTrkMVA2_; }
+  void settrkMVA2(double atrkMVA2) { theTrkMVA2_ = atrkMVA2; }
+  double trkMVA3() const { return theTrkMVA3_; }
+  void settrkMVA3(double atrkMVA3) { theTrkMVA3_ = atrkMVA3; }
+
+private:
+  static constexpr double MagConstant = 0.299792458;
+
+  std::vector<TTStubRef<T> > theStubRefs;
+  GlobalVector theMomentum_;
+  double theRInv_ = 0;
+  double thePhi_ = 0;
+  double theTanL_ = 0;
+  double theD0_ = 0;
+  double theZ0_ = 0;
+  double theStubPtConsistency_ = 0;
+  double theChi2_ = 0;
+  double theChi2_XY_ = 0;
+  double theChi2_Z_ = 0;
+  unsigned int theNumFitPars_ = 0;
+  unsigned int theHitPattern_ = 0;
+  double theTrkMVA1_ = 0;
+  double theTrkMVA2_ = 0;
+  double theTrkMVA3_ = 0;
+};
+
+#endif
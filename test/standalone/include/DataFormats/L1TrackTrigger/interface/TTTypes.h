@@ -0,0 +1,11 @@
+#ifndef L1_TRACK_TRIGGER_TYPES_H
+#define L1_TRACK_TRIGGER_TYPES_H
+
+/*
+Stand-in for the CMSSW TTTypes.h used by the standalone build of the benchmarks, only the digi
+reference type the tracks are templated on
+*/
+
+struct Ref_Phase2TrackerDigi_ {};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef FWCore_ParameterSet_FileInPath_h
+#define FWCore_ParameterSet_FileInPath_h
+
+/*
+Stand-in for the CMSSW edm::FileInPath used by the standalone build of the benchmarks: the
+relative path is looked up in each directory of CMSSW_SEARCH_PATH (colon separated), then in
+STANDALONE_SEARCH_PATH, set by the Makefile to the directory holding L1Trigger/TrackQuality
+*/
+
+#include "FWCore/Utilities/interface/Exception.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifndef STANDALONE_SEARCH_PATH
+#define STANDALONE_SEARCH_PATH "."
+#endif
+
+namespace edm {
+
+  class FileInPath {
+  public:
+    explicit FileInPath(const std::string& relative) : relative_(relative) {
+      const char* environment = std::getenv("CMSSW_SEARCH_PATH");
+      std::string search_path = std::string(environment ? environment : "") + ":" + STANDALONE_SEARCH_PATH;
+      std::istringstream directories(search_path);
+      std::string directory;
+      while (std::getline(directories, directory, ':')) {
+        if (directory.empty())
+          continue;
+        std::string candidate = directory + "/" + relative;
+        if (std::ifstream(candidate).good()) {
+          full_path_ = candidate;
+          return;
+        }
+      }
+      throw cms::Exception("FileInPathError") << relative << " not found in CMSSW_SEARCH_PATH or "
+                                              << STANDALONE_SEARCH_PATH;
+    }
+
+    const std::string& relativePath() const { return relative_; }
+    const std::string& fullPath() const { return full_path_; }
+
+  private:
+    std::string relative_;
+    std::string full_path_;
+  };
+
+}  // namespace edm
+
+#endif
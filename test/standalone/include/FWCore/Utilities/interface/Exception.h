@@ -0,0 +1,55 @@
+#ifndef FWCore_Utilities_Exception_h
+#define FWCore_Utilities_Exception_h
+
+/*
+Stand-in for the CMSSW cms::Exception used by the standalone build of the benchmarks: an
+exception with a category, whose message is streamed in with operator<<
+*/
+
+#include <exception>
+#include <sstream>
+#include <string>
+
+namespace cms {
+
+  class Exception : public std::exception {
+  public:
+    explicit Exception(const std::string& category) : category_(category) {}
+    Exception(const std::string& category, const std::string& message) : category_(category) { append(message); }
+    Exception(const Exception& other) : std::exception(other), category_(other.category_), message_(other.message_) {}
+
+    const std::string& category() const { return category_; }
+    std::string message() const { return message_; }
+    const char* what() const noexcept override {
+      what_ = "An exception of category '" + category_ + "' occurred.\n" + message_;
+      return what_.c_str();
+    }
+
+    template <typename T>
+    void append(const T& value) {
+      std::ostringstream stream;
+      stream << value;
+      message_ += stream.str();
+    }
+
+  private:
+    std::string category_;
+    std::string message_;
+    mutable std::string what_;
+  };
+
+  template <typename T>
+  Exception& operator<<(Exception& exception, const T& value) {
+    exception.append(value);
+    return exception;
+  }
+
+  template <typename T>
+  Exception&& operator<<(Exception&& exception, const T& value) {
+    exception.append(value);
+    return std::move(exception);
+  }
+
+}  // namespace cms
+
+#endif
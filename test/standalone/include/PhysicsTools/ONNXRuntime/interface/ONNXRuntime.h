@@ -0,0 +1,120 @@
+#ifndef PhysicsTools_ONNXRuntime_ONNXRuntime_h
+#define PhysicsTools_ONNXRuntime_ONNXRuntime_h
+
+/*
+Stand-in for the CMSSW cms::Ort::ONNXRuntime used by the standalone build of the benchmarks
+Built with STANDALONE_ONNXRUNTIME (make ORT_DIR=...) it runs the models with the ONNX runtime
+C++ API as the CMSSW class does: one single threaded session per model, inputs of shape
+[batch_size, size / batch_size] and the float outputs returned whole (other output types are
+returned empty). Without it constructing a model throws, and the ONNX runtime engines are skipped
+*/
+
+#include "FWCore/Utilities/interface/Exception.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef STANDALONE_ONNXRUNTIME
+#include <onnxruntime_cxx_api.h>
+#else
+namespace Ort {
+  struct SessionOptions {};
+}  // namespace Ort
+#endif
+
+namespace cms::Ort {
+
+  typedef std::vector<std::vector<float>> FloatArrays;
+
+#ifdef STANDALONE_ONNXRUNTIME
+
+  class ONNXRuntime {
+  public:
+    ONNXRuntime(const std::string& model_path, const ::Ort::SessionOptions* session_options = nullptr) {
+      ::Ort::SessionOptions options;
+      if (!session_options) {
+        options.SetIntraOpNumThreads(1);
+        session_options = &options;
+      }
+      session_ = std::make_unique<::Ort::Session>(env(), model_path.c_str(), *session_options);
+
+      ::Ort::AllocatorWithDefaultOptions allocator;
+      for (size_t i = 0; i < session_->GetOutputCount(); ++i)
+        output_names_.push_back(session_->GetOutputNameAllocated(i, allocator).get());
+    }
+
+    FloatArrays run(const std::vector<std::string>& input_names,
+                    FloatArrays& input_values,
+                    const std::vector<std::string>& output_names = {},
+                    int64_t batch_size = 1) const {
+      ::Ort::MemoryInfo memory = ::Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+      std::vector<::Ort::Value> inputs;
+      std::vector<const char*> input_c_names;
+      for (size_t i = 0; i < input_names.size(); ++i) {
+        std::vector<int64_t> shape = {batch_size, int64_t(input_values[i].size()) / batch_size};
+        inputs.push_back(::Ort::Value::CreateTensor<float>(
+            memory, input_values[i].data(), input_values[i].size(), shape.data(), shape.size()));
+        input_c_names.push_back(input_names[i].c_str());
+      }
+
+      const std::vector<std::string>& run_output_names = output_names.empty() ? output_names_ : output_names;
+      std::vector<const char*> output_c_names;
+      for (const std::string& name : run_output_names)
+        output_c_names.push_back(name.c_str());
+
+      std::vector<::Ort::Value> outputs = session_->Run(::Ort::RunOptions{nullptr},
+                                                        input_c_names.data(),
+                                                        inputs.data(),
+                                                        inputs.size(),
+                                                        output_c_names.data(),
+                                                        output_c_names.size());
+
+      FloatArrays values;
+      for (::Ort::Value& output : outputs) {
+        values.emplace_back();
+        if (!output.IsTensor())
+          continue;
+        ::Ort::TensorTypeAndShapeInfo info = output.GetTensorTypeAndShapeInfo();
+        if (info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+          continue;
+        const float* data = output.GetTensorData<float>();
+        values.back().assign(data, data + info.GetElementCount());
+      }
+      return values;
+    }
+
+    const std::vector<std::string>& getOutputNames() const { return output_names_; }
+
+  private:
+    static ::Ort::Env& env() {
+      static ::Ort::Env env(ORT_LOGGING_LEVEL_ERROR, "");
+      return env;
+    }
+
+    std::unique_ptr<::Ort::Session> session_;
+    std::vector<std::string> output_names_;
+  };
+
+#else
+
+  class ONNXRuntime {
+  public:
+    ONNXRuntime(const std::string& model_path, const ::Ort::SessionOptions* = nullptr) {
+      throw cms::Exception("Configuration") << "cannot load " << model_path
+                                            << ", built without ONNX runtime (make ORT_DIR=...)";
+    }
+
+    FloatArrays run(const std::vector<std::string>&,
+                    FloatArrays&,
+                    const std::vector<std::string>& = {},
+                    int64_t = 1) const {
+      return {};
+    }
+  };
+
+#endif
+
+}  // namespace cms::Ort
+
+#endif
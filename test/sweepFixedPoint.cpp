@@ -0,0 +1,180 @@
+/*
+Precision sweep of the fixed point emulation: synthetic tracks are digitised into track words,
+scored by the GBDT and NN in fixed point from the word bits, and compared with the float
+engines run on features decoded from the same bits. For each precision prints the largest and
+mean score difference, the tracks classified differently at 0.5 and the tracks/s scored in events
+of event_size tracks as FixedPointEngine does, from the word bits to the scores. The tracks/s of
+the float engines and of ONNX runtime (skipped in a standalone build without it) are printed for
+comparison, from the decoded features. Returns 1 if the batched scores differ from those of one
+track at a time, or if the mean difference at the default precision of Classifier_cff.py is above
+the tolerance
+  sweepFixedPoint [n_tracks] [tolerance] [csv_file]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModel.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// Track words drawn from rough approximations of the PU200 track distributions
+static std::vector<TrackWordBits> generate(const TrackWordFormat& format, unsigned int n_tracks) {
+  std::mt19937 rng(12345);
+  std::exponential_distribution<double> chi2rphi(0.15), chi2rz(0.25), bendchi2(0.7);
+  std::uniform_real_distribution<double> rinv(-0.0057, 0.0057);  // pt above 2 GeV
+  std::normal_distribution<double> tanl(0., 1.8), z0(0., 6.);
+  std::bernoulli_distribution hit(0.75);
+
+  std::vector<TrackWordBits> words;
+  for (unsigned int i = 0; i < n_tracks; ++i) {
+    unsigned int hitpattern = 0;
+    for (int bit = 0; bit < 7; ++bit)
+      hitpattern |= hit(rng) << bit;
+    words.push_back(format.digitize(
+        rinv(rng), tanl(rng), z0(rng), chi2rphi(rng), chi2rz(rng), bendchi2(rng), hitpattern));
+  }
+  return words;
+}
+
+static const unsigned int event_size = 200;
+
+// Tracks/s of score(first, n) called on events of event_size tracks
+template <typename Score>
+static double rate(size_t n_tracks, Score score) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t first = 0; first < n_tracks; first += event_size)
+    score(first, std::min<size_t>(event_size, n_tracks - first));
+  return n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Comparison {
+  double max_diff = 0;
+  double mean_diff = 0;
+  unsigned int flips = 0;
+  unsigned int batch_differ = 0;  // scores other than those of one track at a time
+  double rate = 0;                // fixed point tracks/s
+};
+
+static Comparison compare(const TrackWordFeatures& features,
+                          const FixedPointModel& model,
+                          const std::vector<TrackWordBits>& words,
+                          const std::vector<float>& reference) {
+  Comparison result;
+  unsigned int n_features = features.nFeatures();
+  std::vector<int64_t> rows(size_t(event_size) * n_features);
+  std::vector<float> scores(words.size());
+  result.rate = rate(words.size(), [&](size_t first, size_t n) {
+    for (size_t i = 0; i < n; ++i)
+      features.fixedPoint(words[first + i], &rows[i * n_features]);
+    model.predict(rows.data(), n, &scores[first]);
+  });
+
+  for (size_t i = 0; i < words.size(); ++i) {
+    features.fixedPoint(words[i], rows.data());
+    result.batch_differ += model.predict(rows.data()) != scores[i];
+    double diff = std::abs(scores[i] - reference[i]);
+    result.max_diff = std::max(result.max_diff, diff);
+    result.mean_diff += diff / words.size();
+    result.flips += (scores[i] >= 0.5) != (reference[i] >= 0.5);
+  }
+  return result;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 100000;
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 0.01;
+  FILE* csv = argc > 3 ? fopen(argv[3], "w") : nullptr;
+
+  TreeEnsemble gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath());
+  DenseNetwork nn(
+      edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath(), "input_1", "Sigmoid_Output_Layer");
+
+  TrackWordFormat format;
+  std::vector<TrackWordBits> words = generate(format, n_tracks);
+
+  // Float reference from the decoded word fields
+  TrackWordFeatures float_features(in_features, FixedPointType("ap_fixed<16,6>"), format);
+  std::vector<float> rows(size_t(n_tracks) * in_features.size());
+  for (unsigned int i = 0; i < n_tracks; ++i)
+    float_features.floatingPoint(words[i], &rows[size_t(i) * in_features.size()]);
+  std::vector<float> gbdt_reference(n_tracks), nn_reference(n_tracks);
+  gbdt.predict(rows.data(), n_tracks, gbdt_reference.data());
+  nn.predict(rows.data(), n_tracks, nn_reference.data());
+
+  // The float engines and ONNX runtime on the same events
+  std::vector<float> scores(n_tracks);
+  size_t n_features = in_features.size();
+  printf("float engines from the decoded features, tracks/s: GBDTNative %.3g, NNNative %.3g",
+         rate(n_tracks, [&](size_t first, size_t n) { gbdt.predict(&rows[first * n_features], n, &scores[first]); }),
+         rate(n_tracks, [&](size_t first, size_t n) { nn.predict(&rows[first * n_features], n, &scores[first]); }));
+  try {
+    ONNXModel ort_gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath(),
+                       "feature_input", {}, 1, 2);
+    ONNXModel ort_nn(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath(), "input_1",
+                     {"Sigmoid_Output_Layer"}, 0, 1);
+    cms::Ort::FloatArrays input(1);
+    auto ort = [&](const ONNXModel& model) {
+      return rate(n_tracks, [&](size_t first, size_t n) {
+        input[0].assign(rows.begin() + first * n_features, rows.begin() + (first + n) * n_features);
+        std::vector<float> output = model.predict(input, n);
+        std::copy(output.begin(), output.end(), &scores[first]);
+      });
+    };
+    printf(", GBDT %.3g, NN %.3g (ONNX runtime)\n", ort(ort_gbdt), ort(ort_nn));
+  } catch (const cms::Exception& exception) {
+    printf(", ONNX runtime skipped: %s\n", exception.message().c_str());
+  }
+
+  // Widths swept with fixed integer bits, the default of Classifier_cff.py is W = 16
+  printf("%u tracks, scores compared with the float engines on the decoded track words\n", n_tracks);
+  printf("%-4s %-16s | %-10s %-10s %-7s %-10s | %-10s %-10s %-7s %-10s\n", "W", "input", "GBDT max", "mean", "flips",
+         "tracks/s", "NN max", "mean", "flips", "tracks/s");
+  if (csv)
+    fprintf(csv, "width,input,weight,accum,result,gbdt_max,gbdt_mean,gbdt_flips,nn_max,nn_mean,nn_flips\n");
+
+  bool failed = false;
+  for (int width : {8, 10, 12, 14, 16, 18, 20, 24}) {
+    FixedPointPrecision precision = {FixedPointType(width, 6),
+                                     FixedPointType(width, 5),
+                                     FixedPointType(width + 8, 8),
+                                     FixedPointType(width, 0, false)};
+    TrackWordFeatures features(in_features, precision.input, format);
+    Comparison g = compare(features, FixedPointModel(gbdt, precision), words, gbdt_reference);
+    Comparison n = compare(features, FixedPointModel(nn, precision), words, nn_reference);
+    printf("%-4d %-16s | %-10.3g %-10.3g %-7u %-10.3g | %-10.3g %-10.3g %-7u %-10.3g\n", width,
+           precision.input.str().c_str(), g.max_diff, g.mean_diff, g.flips, g.rate, n.max_diff, n.mean_diff, n.flips,
+           n.rate);
+    if (csv)
+      fprintf(csv, "%d,%s,%s,%s,%s,%g,%g,%u,%g,%g,%u\n", width, precision.input.str().c_str(),
+              precision.weight.str().c_str(), precision.accum.str().c_str(), precision.result.str().c_str(), g.max_diff,
+              g.mean_diff, g.flips, n.max_diff, n.mean_diff, n.flips);
+    if (width == 16 && (g.mean_diff > tolerance || n.mean_diff > tolerance))
+      failed = true;
+    if (g.batch_differ || n.batch_differ) {
+      printf("FAILED: %u GBDT and %u NN batched scores differ from one track at a time\n", g.batch_differ,
+             n.batch_differ);
+      failed = true;
+    }
+  }
+  if (csv)
+    fclose(csv);
+
+  if (failed) {
+    printf("FAILED: batched scores differ or scores at W = 16 differ by more than %g on average\n", tolerance);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,161 @@
+/*
+The engines of L1TrackClassifier (ClassifierEngine) on synthetic events: checks that CutEngine and
+the native model engines score exactly as the cuts and models called directly, and times the Cut
+and GBDTNative classification of an event through an engine against the previous loop, which
+compared the algorithm name and set the MVA field for each track. Returns 1 if an engine scores
+differently
+  testClassifierEngine [pileup] [n_events]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/ClassifierEngine.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace FeatureTransform;
+
+typedef SyntheticTracks::Track Track;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+static double since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The fastest of a few runs of classify over every event
+template <typename Classify>
+static double fastest(const std::vector<std::vector<Track>>& events, const Classify& classify) {
+  double best = 0;
+  for (int repeat = 0; repeat < 5; ++repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for (const std::vector<Track>& event : events)
+      classify(event);
+    double seconds = since(start);
+    best = repeat ? std::min(best, seconds) : seconds;
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 500;
+
+  std::mt19937 rng(12345);
+  std::vector<std::vector<Track>> events;
+  size_t n_tracks = 0;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    events.push_back(SyntheticTracks::event(pileup, rng));
+    n_tracks += events.back().size();
+  }
+
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan plan(in_features, options);
+  TrackColumns columns;
+
+  std::string gbdt_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  std::string nn_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath();
+  const TreeEnsemble gbdt(gbdt_model);
+  const QuickScorer quickscorer{TreeEnsemble(gbdt_model)};
+  const DenseNetwork nn(nn_model, "input_1", "Sigmoid_Output_Layer");
+  const TrackCuts cuts = {2., 15., 2.4, 40., 2.4, 4};
+
+  const CutEngine cutEngine(cuts);
+  std::vector<std::unique_ptr<const ClassifierEngine>> models;
+  models.push_back(std::make_unique<NativeEngine<TreeEnsemble>>("GBDTNative", gbdt));
+  models.push_back(std::make_unique<NativeEngine<QuickScorer>>("GBDTQuickScorer", quickscorer));
+  models.push_back(std::make_unique<NativeEngine<DenseNetwork>>("NNNative", nn));
+  auto direct = [&](const std::string& name, const float* x, size_t n, float* out) {
+    if (name == "GBDTNative")
+      gbdt.predict(x, n, out);
+    else if (name == "GBDTQuickScorer")
+      quickscorer.predict(x, n, out);
+    else
+      nn.predict(x, n, out);
+  };
+
+  bool ok = true;
+  unsigned int n_cut_differ = 0, n_model_differ = 0;
+  std::vector<float> features, scores, expected;
+  for (const std::vector<Track>& event : events) {
+    scores.resize(event.size());
+    cutEngine.scoreTracks(event.data(), event.size(), scores.data());
+    for (size_t i = 0; i < event.size(); ++i)
+      n_cut_differ += scores[i] != (cuts.pass(event[i]) ? 1.0 : 0.0);
+    if (event.empty())
+      continue;
+    features.resize(event.size() * plan.nFeatures());
+    plan.transformBatch(event.data(), event.size(), features.data(), Layout::RowMajor, columns);
+    expected.resize(event.size());
+    for (const auto& engine : models) {
+      engine->predict(features, event.size(), scores);
+      direct(engine->name(), features.data(), event.size(), expected.data());
+      for (size_t i = 0; i < event.size(); ++i)
+        n_model_differ += scores[i] != expected[i];
+    }
+  }
+  printf("%u events at pileup %g, %.1f tracks per event\n", n_events, pileup, double(n_tracks) / n_events);
+  printf("%u tracks scored differently by the cut engine, %u by the model engines\n", n_cut_differ, n_model_differ);
+  ok &= n_cut_differ == 0 && n_model_differ == 0;
+
+  // The previous loop of the producer, the name compared and the field chosen for every track
+  const std::string algorithm = "Cut";
+  std::vector<Track> output;
+  auto copy = [&](const std::vector<Track>& event) {
+    output.clear();
+    output.insert(output.end(), event.begin(), event.end());
+  };
+  double byName = fastest(events, [&](const std::vector<Track>& event) {
+    copy(event);
+    for (size_t i = 0; i < output.size(); ++i) {
+      if ((algorithm == "Cut") | (algorithm == "All"))
+        output[i].settrkMVA1(cuts.pass(output[i]) ? 1.0 : 0.0);
+      else if (algorithm == "None")
+        output[i].settrkMVA1(-999);
+    }
+  });
+  const ClassifierEngine* engine = &cutEngine;
+  double byEngine = fastest(events, [&](const std::vector<Track>& event) {
+    copy(event);
+    scores.resize(output.size());
+    engine->scoreTracks(output.data(), output.size(), scores.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      output[i].settrkMVA1(scores[i]);
+  });
+  printf("Cut with the copy, per track: %.2f ns comparing names, %.2f ns through the engine\n", 1e9 * byName / n_tracks,
+         1e9 * byEngine / n_tracks);
+
+  byName = fastest(events, [&](const std::vector<Track>& event) {
+    features.resize(event.size() * plan.nFeatures());
+    scores.resize(event.size());
+    plan.transformBatch(event.data(), event.size(), features.data(), Layout::RowMajor, columns);
+    direct(algorithm == "Cut" ? "GBDTNative" : "", features.data(), event.size(), scores.data());
+  });
+  engine = models.front().get();
+  byEngine = fastest(events, [&](const std::vector<Track>& event) {
+    features.resize(event.size() * plan.nFeatures());
+    plan.transformBatch(event.data(), event.size(), features.data(), Layout::RowMajor, columns);
+    engine->predict(features, event.size(), scores);
+  });
+  printf("GBDTNative with the transform, per track: %.2f ns called directly, %.2f ns through the engine\n",
+         1e9 * byName / n_tracks, 1e9 * byEngine / n_tracks);
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+Checks the ClassifierStats histograms: every value falls in the bucket whose edges hold it, the
+quantiles of log-normal samples are within 6% of the exact ones, merging two halves gives the
+histogram of the whole, engine timings are merged by engine, and the JSON file is written.
+Returns 1 on failure
+*/
+
+#include "L1Trigger/TrackQuality/interface/ClassifierStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+
+int main() {
+  using Histogram = ClassifierStats::Histogram;
+  bool ok = true;
+
+  unsigned int n_outside = 0;
+  std::mt19937_64 rng(12345);
+  for (unsigned int i = 0; i < 100000; ++i) {
+    uint64_t value = rng() >> (rng() % 64);
+    unsigned int bucket = Histogram::bucket(value);
+    n_outside += bucket >= Histogram::n_buckets || value < Histogram::lowerEdge(bucket) ||
+                 value - Histogram::lowerEdge(bucket) >= Histogram::width(bucket);
+  }
+  printf("%u values outside their bucket\n", n_outside);
+  ok &= n_outside == 0;
+
+  // Durations around 20 us with a long tail
+  std::lognormal_distribution<double> duration(std::log(20000.), 0.8);
+  std::vector<uint64_t> values;
+  ClassifierStats first, second, all;
+  for (unsigned int i = 0; i < 200000; ++i) {
+    uint64_t value = duration(rng);
+    values.push_back(value);
+    (i % 2 ? first : second).add(ClassifierStats::Inference, value);
+    all.add(ClassifierStats::Inference, value);
+  }
+  std::sort(values.begin(), values.end());
+  double max_error = 0;
+  for (double q : {0.01, 0.1, 0.5, 0.9, 0.99, 0.999}) {
+    double exact = values[std::ceil(q * values.size()) - 1];
+    double error = std::abs(all.stage(ClassifierStats::Inference).quantile(q) / exact - 1);
+    printf("q%-6g exact %8.0f ns, histogram %8.0f ns\n", q, exact, all.stage(ClassifierStats::Inference).quantile(q));
+    max_error = std::max(max_error, error);
+  }
+  printf("max quantile error %.2f%%\n", 100 * max_error);
+  ok &= max_error < 0.06;
+
+  first.merge(second);
+  const Histogram& merged = first.stage(ClassifierStats::Inference);
+  const Histogram& whole = all.stage(ClassifierStats::Inference);
+  bool same = merged.count() == whole.count() && merged.sum() == whole.sum() && merged.max() == whole.max();
+  for (unsigned int i = 0; i < Histogram::n_buckets; ++i)
+    same &= merged.bucketCount(i) == whole.bucketCount(i);
+  printf("merged halves %s the whole\n", same ? "give" : "DO NOT give");
+  ok &= same;
+
+  // The job stats only learn the engine names from the first stream merged into them
+  ClassifierStats combined, stream;
+  stream.setEngines({"Cut MVA1", "NN MVA2", "GBDT MVA3"});
+  for (unsigned int engine = 0; engine < 3; ++engine) {
+    StageTimer timer(&stream, engine);
+  }
+  stream.addEngine(2, 1000);
+  combined.merge(stream);
+  combined.merge(stream);
+  bool engines_ok = combined.nEngines() == 3 && combined.engineName(1) == "NN MVA2" && combined.engine(0).count() == 2 &&
+                    combined.engine(2).count() == 4 && combined.engine(2).max() >= 1000;
+  printf("engine timings %s\n", engines_ok ? "merged" : "NOT merged");
+  ok &= engines_ok;
+  all.setEngines({"Cut MVA1", "NN MVA2", "GBDT MVA3"});
+  all.addEngine(1, 5000);
+
+  all.addEvent(250);
+  std::ostringstream table;
+  all.print(table);
+  printf("%s", table.str().c_str());
+  all.writeJson("testClassifierStats.json");
+  std::ifstream json("testClassifierStats.json");
+  std::string text((std::istreambuf_iterator<char>(json)), std::istreambuf_iterator<char>());
+  bool json_ok = text.find("\"inference\": {\"unit\": \"ns\", \"count\": 200000") != std::string::npos &&
+                 text.find("\"tracks_per_event\"") != std::string::npos &&
+                 text.find("\"NN MVA2\": {\"unit\": \"ns\", \"count\": 1") != std::string::npos;
+  printf("JSON %s\n", json_ok ? "written" : "NOT written");
+  ok &= json_ok;
+  std::remove("testClassifierStats.json");
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
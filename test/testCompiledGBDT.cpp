@@ -0,0 +1,71 @@
+/*
+Checks the GBDT compiled into the binary (interface/FakeIDGBDTModel.h) against ONNX runtime and
+the native evaluator on GBDT_model.onnx, on synthetic tracks and on uniformly random rows with
+some missing and infinite values. Fails if the header is stale or the scores differ
+  testCompiledGBDT [n_tracks] [tolerance]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/FakeIDGBDTModel.h"
+#include "L1Trigger/TrackQuality/interface/ONNXModelCache.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticFeatures.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+typedef CompiledTreeEnsemble<FakeIDGBDTModel> CompiledGBDT;
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 100000;
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 1e-6;
+  unsigned int n_features = SyntheticFeatures::n_features;
+
+  std::string path = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  ONNXModel ort(path, "feature_input", {}, 1, 2);
+  TreeEnsemble native(path);
+  if (native.nTrees() != CompiledGBDT::nTrees() || native.nFeatures() != CompiledGBDT::nFeatures()) {
+    printf("FAILED: FakeIDGBDTModel.h has %u trees and %u features but %s has %u and %u, run make -C util\n",
+           CompiledGBDT::nTrees(), CompiledGBDT::nFeatures(), path.c_str(), native.nTrees(), native.nFeatures());
+    return 1;
+  }
+
+  // Half synthetic tracks, half uniform rows, with NaN and infinite values sprinkled in
+  std::vector<float> features = SyntheticFeatures::generate(n_tracks);
+  std::mt19937 rng(2020);
+  std::uniform_real_distribution<float> uniform(-20., 20.);
+  std::uniform_int_distribution<unsigned int> column(0, n_features - 1);
+  for (size_t i = features.size() / 2; i < features.size(); ++i)
+    features[i] = uniform(rng);
+  for (unsigned int i = 0; i < n_tracks; i += 97)
+    features[size_t(i) * n_features + column(rng)] =
+        i % 2 ? std::numeric_limits<float>::quiet_NaN() : -std::numeric_limits<float>::infinity();
+
+  cms::Ort::FloatArrays input(1, features);
+  std::vector<float> ort_scores = ort.predict(input, n_tracks);
+  std::vector<float> native_scores(n_tracks), compiled_scores(n_tracks);
+  native.predict(features.data(), n_tracks, native_scores.data());
+
+  auto start = std::chrono::steady_clock::now();
+  CompiledGBDT::predict(features.data(), n_tracks, compiled_scores.data());
+  double rate = n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  double ort_diff = 0;
+  unsigned int n_native_differ = 0;
+  for (unsigned int i = 0; i < n_tracks; ++i) {
+    ort_diff = std::max(ort_diff, double(std::abs(compiled_scores[i] - ort_scores[i])));
+    n_native_differ += compiled_scores[i] != native_scores[i];
+  }
+  printf("compiled GBDT: %u trees, %.3g tracks/s\n", CompiledGBDT::nTrees(), rate);
+  printf("max |compiled - ORT| = %g, %u / %u scores differ from the native evaluator\n", ort_diff, n_native_differ, n_tracks);
+
+  if (ort_diff > tolerance || n_native_differ) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
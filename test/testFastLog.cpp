@@ -0,0 +1,196 @@
+/*
+Accuracy of FastLog: every float in [1e-30, 1e30] (or every stride-th one) is compared with the
+double precision log, printing the largest error in ulp and the largest absolute error for
+results in [-1, 1], then the guard is checked on 0, negative, denormal, NaN and infinite inputs.
+Synthetic tracks, some with zero chi2, are then transformed with FastLog and with std::log and
+scored by the GBDT and NN, printing the largest score deviation and the tracks classified
+differently at 0.5. The per track transform is compared with transformBatch for both logs, also
+with logChi2Floor 0 where the features have to stay finite. Returns 1 if the log errors are above
+the bounds documented in FastLog.h, the scores differ by more than the tolerance or the two
+transforms differ
+  testFastLog [stride] [n_tracks] [tolerance]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FastLog.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace FeatureTransform;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// Bounds documented in FastLog.h
+static const double max_ulp = 1., max_abs = 5e-8;
+
+static float fromBits(uint32_t bits) {
+  float x;
+  memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+static uint32_t toBits(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+// Distance of value from the exact result in units of the float spacing at the exact result
+static double ulps(float value, double exact) {
+  if (std::isinf(exact))
+    return value == exact ? 0 : std::numeric_limits<double>::infinity();
+  float rounded = float(exact);
+  double ulp = std::nextafter(std::abs(rounded), std::numeric_limits<float>::infinity()) - std::abs(rounded);
+  return std::abs(value - exact) / ulp;
+}
+
+static bool sweep(uint32_t stride) {
+  const uint32_t first = toBits(1e-30f), last = toBits(1e30f), chunk = 65536;
+  std::vector<float> in(chunk), out(chunk);
+  double worst_ulp = 0, worst_abs = 0;
+  float worst_ulp_x = 0, worst_abs_x = 0;
+  uint64_t n_checked = 0;
+  for (uint64_t bits = first; bits <= last;) {
+    size_t n = 0;
+    for (; n < chunk && bits <= last; ++n, bits += stride)
+      in[n] = fromBits(bits);
+    FastLog::log(in.data(), out.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      double exact = std::log(double(in[i]));
+      double error = ulps(out[i], exact);
+      if (error > worst_ulp) {
+        worst_ulp = error;
+        worst_ulp_x = in[i];
+      }
+      if (std::abs(exact) <= 1 && std::abs(out[i] - exact) > worst_abs) {
+        worst_abs = std::abs(out[i] - exact);
+        worst_abs_x = in[i];
+      }
+    }
+    n_checked += n;
+  }
+  printf("%llu floats in [1e-30, 1e30], %u lanes: max error %.3g ulp at %g, %.3g for results in [-1, 1] at %g\n",
+         (unsigned long long)n_checked, FastLog::lanes(), worst_ulp, worst_ulp_x, worst_abs, worst_abs_x);
+  return worst_ulp <= max_ulp && worst_abs <= max_abs;
+}
+
+static bool guard() {
+  const float floor = 1e-3f, inf = std::numeric_limits<float>::infinity();
+  std::vector<float> in = {0.f, -0.f, -1.f, -inf, FLT_TRUE_MIN, 1e-10f, floor, 1.f, inf, std::nanf("")};
+  std::vector<float> out(in.size()), out_no_floor(in.size());
+  FastLog::log(in.data(), out.data(), in.size(), floor);
+  FastLog::log(in.data(), out_no_floor.data(), in.size());
+
+  bool ok = true;
+  for (size_t i = 0; i < in.size(); ++i) {
+    double expected = std::isnan(in[i]) ? NAN : std::log(double(std::max(in[i], floor)));
+    double expected_no_floor = std::isnan(in[i]) ? NAN : std::log(double(std::max(in[i], FLT_MIN)));
+    bool same = std::isnan(expected) ? std::isnan(out[i]) && std::isnan(out_no_floor[i])
+                                     : ulps(out[i], expected) <= max_ulp && ulps(out_no_floor[i], expected_no_floor) <= max_ulp;
+    if (!same) {
+      printf("log(%g) = %g with floor %g and %g without, expected %g and %g\n", in[i], out[i], floor, out_no_floor[i],
+             expected, expected_no_floor);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  uint32_t stride = argc > 1 ? std::atoi(argv[1]) : 1;
+  unsigned int n_tracks = argc > 2 ? std::atoi(argv[2]) : 100000;
+  double tolerance = argc > 3 ? std::atof(argv[3]) : 1e-4;
+
+  bool log_ok = sweep(stride);
+  log_ok &= guard();
+
+  // Every 16th track with zero chi2, which the log floor has to keep finite
+  std::vector<SyntheticTracks::Track> tracks = SyntheticTracks::generate(n_tracks);
+  for (unsigned int i = 0; i < n_tracks; i += 16) {
+    const SyntheticTracks::Track& track = tracks[i];
+    SyntheticTracks::Track perfect(
+        track.rInv(), 0., track.tanL(), track.z0(), 0., 0., 0., 0., 0., 0., track.hitPattern(), 4, 3.8112);
+    perfect.setStubPtConsistency(0.);
+    tracks[i] = perfect;
+  }
+
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  FeaturePlan std_plan(in_features, options);
+  options.fast_log = true;
+  FeaturePlan fast_plan(in_features, options);
+  TrackColumns columns;
+  std::vector<float> std_rows(size_t(n_tracks) * in_features.size()), fast_rows(std_rows.size());
+  std_plan.transformBatch(tracks.data(), n_tracks, std_rows.data(), Layout::RowMajor, columns);
+  fast_plan.transformBatch(tracks.data(), n_tracks, fast_rows.data(), Layout::RowMajor, columns);
+
+  // Each track through transform against the batch, with the floor and with 0 as the floor
+  unsigned int n_transform_differ = 0, n_not_finite = 0;
+  std::vector<float> row(in_features.size()), batch_rows(std_rows.size());
+  for (float log_floor : {1e-3f, 0.f}) {
+    for (bool fast_log : {false, true}) {
+      options.log_floor = log_floor;
+      options.fast_log = fast_log;
+      FeaturePlan plan(in_features, options);
+      plan.transformBatch(tracks.data(), n_tracks, batch_rows.data(), Layout::RowMajor, columns);
+      for (unsigned int i = 0; i < n_tracks; ++i) {
+        plan.transform(tracks[i], row.data());
+        for (size_t f = 0; f < row.size(); ++f) {
+          n_transform_differ += row[f] != batch_rows[i * row.size() + f];
+          n_not_finite += !std::isfinite(row[f]);
+        }
+      }
+    }
+  }
+  printf("%u features differ between transform and transformBatch, %u are not finite\n", n_transform_differ,
+         n_not_finite);
+  bool transform_ok = !n_transform_differ && !n_not_finite;
+
+  TreeEnsemble gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath());
+  DenseNetwork nn(
+      edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath(), "input_1", "Sigmoid_Output_Layer");
+
+  bool scores_ok = true;
+  for (int model = 0; model < 2; ++model) {
+    std::vector<float> std_scores(n_tracks), fast_scores(n_tracks);
+    if (model == 0) {
+      gbdt.predict(std_rows.data(), n_tracks, std_scores.data());
+      gbdt.predict(fast_rows.data(), n_tracks, fast_scores.data());
+    } else {
+      nn.predict(std_rows.data(), n_tracks, std_scores.data());
+      nn.predict(fast_rows.data(), n_tracks, fast_scores.data());
+    }
+    double max_diff = 0;
+    unsigned int flips = 0, n_finite = 0;
+    for (unsigned int i = 0; i < n_tracks; ++i) {
+      max_diff = std::max(max_diff, double(std::abs(fast_scores[i] - std_scores[i])));
+      flips += (fast_scores[i] >= 0.5) != (std_scores[i] >= 0.5);
+      n_finite += std::isfinite(fast_scores[i]);
+    }
+    printf("%s: %u tracks, max score deviation %.3g, %u classified differently at 0.5, %u finite scores\n",
+           model ? "NN" : "GBDT", n_tracks, max_diff, flips, n_finite);
+    scores_ok &= max_diff <= tolerance && n_finite == n_tracks;
+  }
+
+  if (!log_ok)
+    printf("FAILED: log error above %g ulp or %g absolute in [-1, 1], or wrong guarded values\n", max_ulp, max_abs);
+  if (!scores_ok)
+    printf("FAILED: scores with FastLog differ by more than %g or are not finite\n", tolerance);
+  if (!transform_ok)
+    printf("FAILED: the per track and batch transforms differ or give features that are not finite\n");
+  return log_ok && scores_ok && transform_ok ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/*
+Checks the feature scaling read from a sidecar file: FeaturePlan with the scaling fused in must
+give bitwise the scaled features of the plain transform, per track and in batches, the GBDT and
+QuickScorer with the scaling folded into their thresholds must give on raw features bitwise the
+scores of the original ensemble on scaled features, and the NN with the scaling folded into its
+first layer must agree within the tolerance. Malformed files must throw. Returns 1 on failure
+  testFeatureScaling [n_tracks] [tolerance]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FeatureScaling.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace FeatureTransform;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// Wide enough clips and ranges that some GBDT thresholds fall outside them
+static const char* scaling_file =
+    "# feature    method    parameters\n"
+    "log_chi2     standard  1.2 1.7 -3 4  # clipped\n"
+    "log_bendchi2 standard  -0.4 1.3\n"
+    "log_chi2rphi standard  1.0 1.5 -2 3\n"
+    "log_chi2rz   standard  0.3 1.4\n"
+    "nstubs       minmax    0 7\n"
+    "rinv         minmax    0 2.5\n"
+    "tanl         standard  1.4 1.1 0 2.4\n"
+    "z0           minmax    0 15\n"
+    "dtot         minmax    0 5\n"
+    "ltot         standard  4 1.5\n";
+
+static std::string writeFile(const std::string& name, const std::string& content) {
+  std::ofstream(name) << content;
+  return name;
+}
+
+static bool throws(const std::string& content) {
+  std::string path = writeFile("testFeatureScaling_bad.txt", content);
+  bool thrown = false;
+  try {
+    FeatureScaling(path, in_features);
+  } catch (const cms::Exception&) {
+    thrown = true;
+  }
+  std::remove(path.c_str());
+  return thrown;
+}
+
+static bool same(const std::vector<float>& a, const std::vector<float>& b) {
+  return a.size() == b.size() && !memcmp(a.data(), b.data(), a.size() * sizeof(float));
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 100000;
+  double tolerance = argc > 2 ? std::atof(argv[2]) : 1e-5;
+  unsigned int n_features = in_features.size();
+  bool ok = true;
+
+  std::string path = writeFile("testFeatureScaling.txt", scaling_file);
+  FeatureScaling scaling(path, in_features);
+  std::remove(path.c_str());
+
+  // Fused scaling against the plain transform scaled afterwards
+  std::vector<SyntheticTracks::Track> tracks = SyntheticTracks::generate(n_tracks);
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  FeaturePlan raw_plan(in_features, options);
+  options.scaling = scaling;
+  FeaturePlan scaled_plan(in_features, options);
+  options.scaling = scaling.clipping();
+  FeaturePlan clipped_plan(in_features, options);
+
+  TrackColumns columns;
+  std::vector<float> raw(size_t(n_tracks) * n_features), expected(raw.size()), fused(raw.size()), per_track(raw.size()),
+      clipped(raw.size());
+  raw_plan.transformBatch(tracks.data(), n_tracks, raw.data(), Layout::RowMajor, columns);
+  scaled_plan.transformBatch(tracks.data(), n_tracks, fused.data(), Layout::RowMajor, columns);
+  clipped_plan.transformBatch(tracks.data(), n_tracks, clipped.data(), Layout::RowMajor, columns);
+  for (unsigned int i = 0; i < n_tracks; ++i)
+    scaled_plan.transform(tracks[i], &per_track[size_t(i) * n_features]);
+  for (size_t i = 0; i < raw.size(); ++i)
+    expected[i] = scaling[i % n_features].apply(raw[i]);
+  bool fused_ok = same(expected, fused) && same(expected, per_track);
+  printf("fused scaling %s the scaled transform\n", fused_ok ? "matches" : "DIFFERS from");
+  ok &= fused_ok;
+
+  // GBDT thresholds moved to the raw features
+  std::string gbdt_path = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  TreeEnsemble gbdt(gbdt_path), folded_gbdt(gbdt_path);
+  folded_gbdt.foldScaling(scaling);
+  QuickScorer folded_quickscorer(folded_gbdt);
+  std::vector<float> gbdt_scores(n_tracks), folded_scores(n_tracks), quickscorer_scores(n_tracks);
+  gbdt.predict(fused.data(), n_tracks, gbdt_scores.data());
+  folded_gbdt.predict(raw.data(), n_tracks, folded_scores.data());
+  folded_quickscorer.predict(raw.data(), n_tracks, quickscorer_scores.data());
+  unsigned int n_infinite = 0;
+  for (const TreeEnsemble::Node& node : folded_gbdt.nodes())
+    n_infinite += std::isinf(node.threshold);
+  bool gbdt_ok = same(gbdt_scores, folded_scores) && same(gbdt_scores, quickscorer_scores);
+  printf("GBDT with folded thresholds (%u moved outside the clips) %s\n", n_infinite,
+         gbdt_ok ? "matches" : "DIFFERS");
+  ok &= gbdt_ok;
+
+  // NN offsets and scales in the first layer, clipping left to the transform
+  std::string nn_path = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath();
+  DenseNetwork nn(nn_path, "input_1", "Sigmoid_Output_Layer"), folded_nn(nn_path, "input_1", "Sigmoid_Output_Layer");
+  folded_nn.foldScaling(scaling);
+  std::vector<float> nn_scores(n_tracks), folded_nn_scores(n_tracks);
+  nn.predict(fused.data(), n_tracks, nn_scores.data());
+  folded_nn.predict(clipped.data(), n_tracks, folded_nn_scores.data());
+  double max_diff = 0;
+  for (unsigned int i = 0; i < n_tracks; ++i)
+    max_diff = std::max(max_diff, double(std::abs(nn_scores[i] - folded_nn_scores[i])));
+  printf("NN with folded first layer: max score deviation %.3g\n", max_diff);
+  ok &= max_diff <= tolerance;
+
+  bool errors_ok = throws("pt standard 0 1\n") && throws("z0 standard 0 0\n") && throws("z0 minmax 2 1\n") &&
+                   throws("z0 minmax 0\n") && throws("z0 log 0 1\n") && throws("z0 standard 0 one\n");
+  printf("malformed files %s\n", errors_ok ? "throw" : "DO NOT all throw");
+  ok &= errors_ok;
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
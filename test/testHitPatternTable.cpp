@@ -0,0 +1,107 @@
+/*
+Exhaustive check of the compile time HitPatternTable against the loop based hit pattern
+expansion FeatureTransform used before it, for every 7 bit hit pattern in every eta bin, at the
+bin edges and outside the acceptance. Returns 1 on any difference
+  testHitPatternTable
+*/
+
+#include "L1Trigger/TrackQuality/interface/HitPatternTable.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+// Evaluated by the compiler
+static_assert(HitPatternTable::table[0 * 128 + 0x7f].expanded == 0x3f, "central tracks expand to the six layers");
+static_assert(HitPatternTable::table[7 * 128 + 0x3f].nstubs == 6, "forward tracks expand to layer 1 and the disks");
+static_assert(HitPatternTable::table[8 * 128 + 0x7f].nstubs == 0, "no expected hits outside the acceptance");
+static_assert(HitPatternTable::table[0 * 128 + 0x45].nlaymiss_interior == 4, "0b1000101 misses four interior layers");
+
+struct Reference {
+  int expanded[11];
+  int ltot;
+  int dtot;
+  int nlaymiss_interior;
+};
+
+// The loops of FeatureTransform::Transform, with the counters initialised and the eta bin loop
+// kept within eta_bins
+static Reference reference(int tmp_trk_hitpattern, float eta) {
+  std::vector<int> hitpattern_binary = {0, 0, 0, 0, 0, 0, 0};
+  std::vector<int> hitpattern_expanded_binary = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  std::vector<float> eta_bins = {0.0, 0.2, 0.41, 0.62, 0.9, 1.26, 1.68, 2.08, 2.4};
+  int hitmap[8][7] = {{0, 1, 2, 3, 4, 5, 11},
+                      {0, 1, 2, 3, 4, 5, 11},
+                      {0, 1, 2, 3, 4, 5, 11},
+                      {0, 1, 2, 3, 4, 5, 11},
+                      {0, 1, 2, 3, 4, 5, 11},
+                      {0, 1, 2, 6, 7, 8, 9},
+                      {0, 1, 7, 8, 9, 10, 11},
+                      {0, 6, 7, 8, 9, 10, 11}};
+
+  for (int i = 6; i >= 0; i--) {
+    int k = tmp_trk_hitpattern >> i;
+    if (k & 1)
+      hitpattern_binary[i] = 1;
+  }
+
+  Reference result = {};
+  int nbits = tmp_trk_hitpattern ? int(floor(log2(tmp_trk_hitpattern))) + 1 : 0;
+  bool seq = 0;
+  for (int i = 0; i < nbits; i++) {
+    int lay_i = ((1 << i) & tmp_trk_hitpattern) >> i;
+    if (lay_i && !seq)
+      seq = 1;
+    if (!lay_i && seq)
+      result.nlaymiss_interior++;
+  }
+
+  for (int j = 0; j + 1 < int(eta_bins.size()); j++)
+    if (eta >= eta_bins[j] && eta < eta_bins[j + 1])
+      for (int k = 0; k < 6; k++)
+        hitpattern_expanded_binary[hitmap[j][k]] = hitpattern_binary[k];
+
+  for (int i = 0; i < 11; ++i)
+    result.expanded[i] = hitpattern_expanded_binary[i];
+  for (int i = 0; i < 6; ++i)
+    result.ltot += hitpattern_expanded_binary[i];
+  for (int i = 6; i < 11; ++i)
+    result.dtot += hitpattern_expanded_binary[i];
+  return result;
+}
+
+int main() {
+  // Each bin at its lower edge, centre and just below its upper edge, then outside the acceptance
+  std::vector<float> etas;
+  for (int bin = 0; bin < HitPatternTable::n_eta_bins; ++bin) {
+    float low = HitPatternTable::eta_bins[bin], high = HitPatternTable::eta_bins[bin + 1];
+    etas.insert(etas.end(), {low, 0.5f * (low + high), std::nextafter(high, 0.f)});
+  }
+  etas.insert(etas.end(), {2.4f, 3.f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()});
+
+  unsigned int n_checked = 0, n_failed = 0;
+  for (float eta : etas) {
+    for (unsigned int hitpattern = 0; hitpattern < 128; ++hitpattern) {
+      const HitPatternTable::Entry& entry = HitPatternTable::lookup(hitpattern, eta);
+      Reference expected = reference(hitpattern, eta);
+      bool same = entry.ltot == expected.ltot && entry.dtot == expected.dtot &&
+                  entry.nstubs == expected.ltot + expected.dtot &&
+                  entry.nlaymiss_interior == expected.nlaymiss_interior && !(entry.expanded >> 11);
+      for (int i = 0; i < 11; ++i)
+        same &= int((entry.expanded >> i) & 1) == expected.expanded[i];
+      if (!same && n_failed++ < 10)
+        printf("eta %g hit pattern 0x%02x: expanded 0x%03x ltot %d dtot %d nlaymiss %d, expected ltot %d dtot %d nlaymiss %d\n",
+               eta, hitpattern, entry.expanded, entry.ltot, entry.dtot, entry.nlaymiss_interior, expected.ltot,
+               expected.dtot, expected.nlaymiss_interior);
+      ++n_checked;
+    }
+  }
+
+  printf("%u / %u (eta, hit pattern) combinations differ\n", n_failed, n_checked);
+  if (n_failed) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
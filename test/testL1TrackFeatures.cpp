@@ -0,0 +1,110 @@
+/*
+Checks the L1TrackFeatures product as L1TrackFeatureProducer fills it: all features of synthetic
+tracks written column by column, then the classifier in_features gathered back into rows must be
+bitwise the rows FeaturePlan computes for in_features directly, and a reader with another chi2
+floor or log must be refused. Prints the tracks/sec of the gather and of the transform it
+replaces. Returns 1 on any difference
+  testL1TrackFeatures [n_tracks]
+*/
+
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/L1TrackFeatures.h"
+#include "SyntheticTracks.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+using namespace FeatureTransform;
+
+static const std::vector<std::string> all_features = {
+    "log_chi2",   "log_chi2rphi", "log_chi2rz", "log_bendchi2", "chi2",       "chi2rphi",   "chi2rz",
+    "bendchi2",   "nstubs",       "lay1_hits",  "lay2_hits",    "lay3_hits",  "lay4_hits",  "lay5_hits",
+    "lay6_hits",  "disk1_hits",   "disk2_hits", "disk3_hits",   "disk4_hits", "disk5_hits", "rinv",
+    "tanl",       "z0",           "dtot",       "ltot",         "pt",         "eta",        "nlaymiss_interior"};
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// tracks/sec of run(), best of three
+static double throughput(unsigned int n_tracks, const std::function<void()>& run) {
+  double best = 0;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    best = std::max(best, n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 200000;
+  std::vector<SyntheticTracks::Track> tracks = SyntheticTracks::generate(n_tracks);
+
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan all_plan(all_features, options), plan(in_features, options);
+  TrackColumns columns;
+
+  // As L1TrackFeatureProducer
+  L1TrackFeatures product(all_features, n_tracks, options.log_floor, options.fast_log);
+  all_plan.transformBatch(tracks.data(), n_tracks, product.data(), Layout::ColumnMajor, columns);
+
+  // As L1TrackClassifier with L1TrackFeaturesInputTag
+  std::vector<unsigned int> indices;
+  for (const std::string& name : in_features)
+    indices.push_back(product.index(name));
+  std::vector<float> gathered(size_t(n_tracks) * in_features.size()), direct(gathered.size());
+  product.rows(indices, gathered.data());
+  plan.transformBatch(tracks.data(), n_tracks, direct.data(), Layout::RowMajor, columns);
+  bool same = !memcmp(gathered.data(), direct.data(), gathered.size() * sizeof(float));
+
+  bool thrown = false;
+  try {
+    product.index("d0");
+  } catch (const cms::Exception&) {
+    thrown = true;
+  }
+
+  // A reader configured with another floor or log must be refused
+  unsigned int n_refused = 0;
+  for (auto [log_floor, fast_log] : {std::pair<float, bool>(options.log_floor, options.fast_log),
+                                     std::pair<float, bool>(1e-2, options.fast_log),
+                                     std::pair<float, bool>(options.log_floor, !options.fast_log)}) {
+    try {
+      product.checkTransform(log_floor, fast_log);
+    } catch (const cms::Exception&) {
+      ++n_refused;
+    }
+  }
+  bool checked = n_refused == 2;
+  try {
+    product.checkTransform(options.log_floor, options.fast_log);
+  } catch (const cms::Exception&) {
+    checked = false;
+  }
+
+  double gather_rate = throughput(n_tracks, [&] { product.rows(indices, gathered.data()); });
+  double transform_rate = throughput(n_tracks, [&] {
+    plan.transformBatch(tracks.data(), n_tracks, direct.data(), Layout::RowMajor, columns);
+  });
+  printf("%u tracks, %u features in the product, %zu gathered\n", n_tracks, product.nFeatures(), in_features.size());
+  printf("%-40s %10.3g tracks/s\n", "L1TrackFeatures::rows", gather_rate);
+  printf("%-40s %10.3g tracks/s\n", "FeaturePlan::transformBatch", transform_rate);
+  printf("gathered rows %s the transform, unknown names %s\n", same ? "match" : "DIFFER from",
+         thrown ? "throw" : "DO NOT throw");
+  printf("readers with another logChi2Floor or fastLog %s\n", checked ? "are refused" : "ARE NOT refused");
+
+  if (!same || !thrown || !checked) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
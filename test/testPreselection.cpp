@@ -0,0 +1,162 @@
+/*
+The preselection cascade of L1TrackClassifier (usePreselection) on synthetic events: tracks
+failing the cuts get the fixed score 0 and only the others are transformed and classified. For
+the preselection defaults of Classifier_cff.py and for the Cut values, prints for each native
+engine the fraction of tracks skipped, the speedup of the whole classification over running the
+model on every track, and the tracks above the working point with and without the cascade.
+Returns 1 if the preselected tracks are not scored exactly as without the cascade, or if the
+default preselection changes the tracks above the working point by more than 0.1%
+  testPreselection [pileup] [n_events] [working point]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TrackCuts.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+
+using namespace FeatureTransform;
+
+typedef std::function<void(const float*, size_t, float*)> Model;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+struct Run {
+  double seconds = 0;
+  size_t n_tracks = 0, n_inferred = 0, n_above = 0;
+  std::vector<std::vector<float>> scores;
+};
+
+// Classifies every event as the producer does, copying the tracks and, with the cascade when
+// cuts is given, selecting them in the same loop
+static Run classify(const FeaturePlan& plan,
+                    const Model& model,
+                    const std::vector<std::vector<SyntheticTracks::Track>>& events,
+                    const TrackCuts* cuts,
+                    double working_point) {
+  Run run;
+  TrackColumns columns;
+  std::vector<float> features, scores;
+  std::vector<unsigned int> selected;
+  for (const std::vector<SyntheticTracks::Track>& input : events) {
+    run.scores.emplace_back(input.size());
+    std::vector<float>& out = run.scores.back();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SyntheticTracks::Track> tracks;
+    tracks.reserve(input.size());
+    selected.clear();
+    for (const SyntheticTracks::Track& track : input) {
+      tracks.push_back(track);
+      if (cuts && cuts->pass(track))
+        selected.push_back(tracks.size() - 1);
+    }
+    if (cuts) {
+      features.resize(selected.size() * plan.nFeatures());
+      scores.resize(selected.size());
+      if (!selected.empty()) {
+        plan.transformBatch(tracks.data(), selected.data(), selected.size(), features.data(), Layout::RowMajor, columns);
+        model(features.data(), selected.size(), scores.data());
+      }
+      std::fill(out.begin(), out.end(), 0.f);
+      for (size_t j = 0; j < selected.size(); ++j)
+        out[selected[j]] = scores[j];
+      run.n_inferred += selected.size();
+    } else {
+      features.resize(tracks.size() * plan.nFeatures());
+      if (!tracks.empty()) {
+        plan.transformBatch(tracks.data(), tracks.size(), features.data(), Layout::RowMajor, columns);
+        model(features.data(), tracks.size(), out.data());
+      }
+      run.n_inferred += tracks.size();
+    }
+    run.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    run.n_tracks += tracks.size();
+    for (float score : out)
+      run.n_above += score > working_point;
+  }
+  return run;
+}
+
+// The fastest of a few runs, the timing of a shared machine only ever gets slower
+static Run fastest(const FeaturePlan& plan,
+                   const Model& model,
+                   const std::vector<std::vector<SyntheticTracks::Track>>& events,
+                   const TrackCuts* cuts,
+                   double working_point) {
+  Run best = classify(plan, model, events, cuts, working_point);
+  for (int i = 0; i < 4; ++i)
+    best.seconds = std::min(best.seconds, classify(plan, model, events, cuts, working_point).seconds);
+  return best;
+}
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 500;
+  double working_point = argc > 3 ? std::atof(argv[3]) : 0.5;
+
+  std::mt19937 rng(12345);
+  std::vector<std::vector<SyntheticTracks::Track>> events;
+  for (unsigned int i = 0; i < n_events; ++i)
+    events.push_back(SyntheticTracks::event(pileup, rng));
+
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan plan(in_features, options);
+
+  std::string gbdt_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  std::string nn_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath();
+  auto gbdt = std::make_shared<const TreeEnsemble>(gbdt_model);
+  auto quickscorer = std::make_shared<const QuickScorer>(TreeEnsemble(gbdt_model));
+  auto nn = std::make_shared<const DenseNetwork>(nn_model, "input_1", "Sigmoid_Output_Layer");
+  std::vector<std::pair<std::string, Model>> models = {
+      {"GBDTNative", [gbdt](const float* x, size_t n, float* out) { gbdt->predict(x, n, out); }},
+      {"GBDTQuickScorer", [quickscorer](const float* x, size_t n, float* out) { quickscorer->predict(x, n, out); }},
+      {"NNNative", [nn](const float* x, size_t n, float* out) { nn->predict(x, n, out); }}};
+
+  // The preselection defaults of Classifier_cff.py, and the Cut values
+  std::vector<std::pair<std::string, TrackCuts>> preselections = {{"default", {2., 20., 2.5, 100., 20., 0}},
+                                                                  {"Cut", {2., 15., 2.4, 40., 2.4, 4}}};
+
+  bool ok = true;
+  printf("%u events at pileup %g, working point %g\n", n_events, pileup, working_point);
+  printf("%-16s %-8s %8s %8s %12s %12s %8s\n", "", "cuts", "skipped", "speedup", "above full", "above casc", "change");
+  for (const auto& model : models) {
+    Run full = fastest(plan, model.second, events, nullptr, working_point);
+    for (const auto& preselection : preselections) {
+      Run cascade = fastest(plan, model.second, events, &preselection.second, working_point);
+      unsigned int n_differ = 0;
+      for (unsigned int i = 0; i < n_events; ++i)
+        for (size_t track = 0; track < events[i].size(); ++track)
+          n_differ += preselection.second.pass(events[i][track]) && cascade.scores[i][track] != full.scores[i][track];
+      double change = (double(cascade.n_above) - full.n_above) / std::max<size_t>(full.n_above, 1);
+      printf("%-16s %-8s %7.1f%% %8.2f %12zu %12zu %7.2f%%\n", model.first.c_str(), preselection.first.c_str(),
+             100. * (1 - double(cascade.n_inferred) / cascade.n_tracks), full.seconds / cascade.seconds, full.n_above,
+             cascade.n_above, 100 * change);
+      if (n_differ)
+        printf("  %u preselected tracks scored differently\n", n_differ);
+      ok &= n_differ == 0;
+      if (preselection.first == "default")
+        ok &= std::abs(change) <= 0.001;
+    }
+  }
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
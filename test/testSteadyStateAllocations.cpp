@@ -0,0 +1,175 @@
+/*
+Counts the heap allocations (global operator new) of the classification of an event once the
+buffers have grown, for each model engine of L1TrackClassifier on synthetic events: the features
+are transformed into a reused buffer and scored by the engine, as in acquire. The events are run
+once to grow the buffers, then the allocations of a second pass are counted. The allocations of
+the NN and GBDT through cms::Ort::ONNXRuntime::run are printed next to those of the native engines.
+Returns 1 if a native engine allocates in the second pass. Returns 77 (skipped) when the ONNX
+runtime engines cannot be run, as in the standalone build without ORT_DIR
+  testSteadyStateAllocations [pileup] [n_events]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/ClassifierEngine.h"
+#include "L1Trigger/TrackQuality/interface/DenseNetwork.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/QuickScorer.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+static std::atomic<bool> counting(false);
+static std::atomic<uint64_t> n_allocations(0);
+
+static void* allocate(size_t size, size_t alignment = 0) {
+  if (counting)
+    ++n_allocations;
+  void* p = nullptr;
+  if (alignment > sizeof(void*)) {
+    if (posix_memalign(&p, alignment, size ? size : 1))
+      p = nullptr;
+  } else
+    p = std::malloc(size ? size : 1);
+  return p;
+}
+
+// Out of line, so the compiler does not pair the free of a delete with the operator new that
+// allocated the pointer and warn of a mismatch
+__attribute__((noinline)) static void deallocate(void* p) noexcept { std::free(p); }
+
+void* operator new(size_t size) {
+  if (void* p = allocate(size))
+    return p;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, std::align_val_t alignment) {
+  if (void* p = allocate(size, size_t(alignment)))
+    return p;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t alignment) { return operator new(size, alignment); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, size_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { deallocate(p); }
+
+using namespace FeatureTransform;
+
+typedef SyntheticTracks::Track Track;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// The buffers of one stream and the transform of acquire
+struct Stream {
+  explicit Stream(const ClassifierEngine& engine) : engine(engine) {}
+
+  void classify(const FeaturePlan& plan, const std::vector<Track>& event) {
+    features.resize(event.size() * plan.nFeatures());
+    scores.resize(event.size());
+    if (event.empty())
+      return;
+    plan.transformBatch(event.data(), event.size(), features.data(), Layout::RowMajor, columns);
+    engine.predict(features, event.size(), scores);
+  }
+
+  const ClassifierEngine& engine;
+  TrackColumns columns;
+  std::vector<float> features, scores;
+};
+
+// Allocations of the second pass over the events
+static uint64_t steadyState(Stream& stream, const FeaturePlan& plan, const std::vector<std::vector<Track>>& events) {
+  for (const std::vector<Track>& event : events)
+    stream.classify(plan, event);
+  uint64_t n = 0;
+  for (const std::vector<Track>& event : events) {
+    n_allocations = 0;
+    counting = true;
+    stream.classify(plan, event);
+    counting = false;
+    n += n_allocations;
+  }
+  return n;
+}
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 200;
+
+  std::mt19937 rng(12345);
+  std::vector<std::vector<Track>> events;
+  for (unsigned int i = 0; i < n_events; ++i)
+    events.push_back(SyntheticTracks::event(pileup, rng));
+
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan plan(in_features, options);
+
+  std::string gbdt_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath();
+  std::string nn_model = edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDNN/NN_model.onnx").fullPath();
+  const TreeEnsemble gbdt(gbdt_model);
+  const QuickScorer quickscorer{TreeEnsemble(gbdt_model)};
+  const DenseNetwork nn(nn_model, "input_1", "Sigmoid_Output_Layer");
+
+  bool ok = true, skipped = false;
+  printf("%u events at pileup %g, allocations per event once the buffers have grown\n", n_events, pileup);
+  std::vector<std::unique_ptr<const ClassifierEngine>> natives;
+  natives.push_back(std::make_unique<NativeEngine<TreeEnsemble>>("GBDTNative", gbdt));
+  natives.push_back(std::make_unique<NativeEngine<QuickScorer>>("GBDTQuickScorer", quickscorer));
+  natives.push_back(std::make_unique<NativeEngine<DenseNetwork>>("NNNative", nn));
+  for (const auto& engine : natives) {
+    Stream stream(*engine);
+    uint64_t n = steadyState(stream, plan, events);
+    printf("%-16s %10.2f\n", engine->name().c_str(), double(n) / n_events);
+    ok &= n == 0;
+  }
+
+  // The ONNX runtime engines, as loaded by ONNXModelCache
+  struct Model {
+    std::string name, path, input;
+    std::vector<std::string> outputs;
+    unsigned int score_output, score_columns;
+  };
+  for (const Model& model : {Model{"NN", nn_model, "input_1", {"Sigmoid_Output_Layer"}, 0, 1},
+                             Model{"GBDT", gbdt_model, "feature_input", {}, 1, 2}}) {
+    std::unique_ptr<ONNXModel> onnx;
+    try {
+      onnx = std::make_unique<ONNXModel>(model.path, model.input, model.outputs, model.score_output, model.score_columns);
+    } catch (const cms::Exception& exception) {
+      printf("%s SKIPPED: %s\n", model.name.c_str(), exception.message().c_str());
+      skipped = true;
+      continue;
+    }
+    ONNXEngine engine(model.name, *onnx);
+    Stream stream(engine);
+    uint64_t n = steadyState(stream, plan, events);
+    printf("%-16s %10.2f\n", engine.name().c_str(), double(n) / n_events);
+  }
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  if (skipped) {
+    printf("SKIPPED: the ONNX runtime engines were not checked\n");
+    return 77;
+  }
+  return 0;
+}
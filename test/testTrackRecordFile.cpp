@@ -0,0 +1,164 @@
+/*
+Checks the track record file: synthetic events written compressed and uncompressed must read
+back as the same records, and as TTTracks giving bitwise the features of the tracks they were
+made from. Files that are not records, of another version, not closed or with an index giving
+more tracks than an event's bytes can hold must throw. Prints the bytes per track and the read
+rate of both. With a file name, keeps a compressed record of the events scored by GBDTNative, for
+replayTracks. Returns 1 on failure
+  testTrackRecordFile [n_events] [pileup] [file]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/TrackRecordFile.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace FeatureTransform;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot",
+    "pt",       "eta"};
+
+static bool throws(const std::string& path) {
+  try {
+    TrackRecordReader reader(path);
+  } catch (const cms::Exception&) {
+    return true;
+  }
+  return false;
+}
+
+static bool same(const std::vector<float>& a, const std::vector<float>& b) {
+  return a.size() == b.size() && !memcmp(a.data(), b.data(), a.size() * sizeof(float));
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_events = argc > 1 ? std::atoi(argv[1]) : 200;
+  double pileup = argc > 2 ? std::atof(argv[2]) : 200;
+  std::string keep = argc > 3 ? argv[3] : "";
+  const double bfield = 3.8112;
+  bool ok = true;
+
+  // Scored as the classifier would, so the record can be replayed
+  std::mt19937 rng(12345);
+  std::vector<std::vector<SyntheticTracks::Track>> events;
+  TreeEnsemble gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath());
+  TransformOptions options;
+  options.log_floor = 1e-3;
+  options.fast_log = true;
+  FeaturePlan gbdt_plan(std::vector<std::string>(in_features.begin(), in_features.end() - 2), options);
+  TrackColumns columns;
+  std::vector<float> features, scores;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    events.push_back(SyntheticTracks::event(pileup, rng));
+    std::vector<SyntheticTracks::Track>& tracks = events.back();
+    features.resize(tracks.size() * gbdt_plan.nFeatures());
+    scores.resize(tracks.size());
+    if (tracks.empty())
+      continue;
+    gbdt_plan.transformBatch(tracks.data(), tracks.size(), features.data(), Layout::RowMajor, columns);
+    gbdt.predict(features.data(), tracks.size(), scores.data());
+    for (size_t track = 0; track < tracks.size(); ++track)
+      tracks[track].settrkMVA1(scores[track]);
+  }
+
+  FeaturePlan plan(in_features, options);
+  for (bool compress : {false, true}) {
+    std::string path = compress && !keep.empty() ? keep : "testTrackRecordFile.bin";
+    {
+      TrackRecordWriter writer(path, bfield, "GBDTNative", compress);
+      for (unsigned int i = 0; i < n_events; ++i)
+        writer.write(1000 + i, events[i]);
+    }
+
+    TrackRecordReader reader(path);
+    size_t n_tracks = 0;
+    unsigned int n_differ = 0;
+    std::vector<RecordedTrack> buffer;
+    std::vector<SyntheticTracks::Track> tracks;
+    std::vector<float> expected, replayed;
+    for (unsigned int i = 0; i < n_events; ++i) {
+      const std::vector<SyntheticTracks::Track>& original = events[i];
+      const TrackRecordIndex& index = reader.index(i);
+      const RecordedTrack* records = reader.tracks(i, buffer);
+      n_differ += index.event != 1000 + i || index.n_tracks != original.size();
+      for (size_t track = 0; track < original.size() && index.n_tracks == original.size(); ++track) {
+        RecordedTrack record = RecordedTrack::fromTrack(original[track]);
+        n_differ += memcmp(&record, &records[track], sizeof(RecordedTrack)) != 0;
+      }
+
+      reader.read(i, tracks);
+      expected.resize(original.size() * plan.nFeatures());
+      replayed.resize(tracks.size() * plan.nFeatures());
+      if (!original.empty())
+        plan.transformBatch(original.data(), original.size(), expected.data(), Layout::RowMajor, columns);
+      if (!tracks.empty())
+        plan.transformBatch(tracks.data(), tracks.size(), replayed.data(), Layout::RowMajor, columns);
+      n_differ += !same(expected, replayed);
+      n_tracks += original.size();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_events; ++i)
+      reader.read(i, tracks);
+    double rate = n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    double bytes_per_track = double(file.tellg()) / n_tracks;
+    printf("%-12s %6.1f bytes per track, read at %.3g tracks/s, %u events differ\n",
+           compress ? "compressed" : "uncompressed", bytes_per_track, rate, n_differ);
+    ok &= n_differ == 0 && reader.nEvents() == n_events && reader.algorithm() == "GBDTNative" &&
+          reader.bfield() == bfield && reader.compressed() == compress;
+    if (path != keep)
+      std::remove(path.c_str());
+  }
+
+  // Damaged files
+  std::string path = "testTrackRecordFile_bad.bin";
+  TrackRecordHeader header;
+  memset(&header, 0, sizeof(header));
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(&header), sizeof(header));
+  bool not_record = throws(path);
+  memcpy(header.magic, TrackRecordHeader::magic_value, sizeof(header.magic));
+  header.version = TrackRecordHeader::current_version + 1;
+  header.index_offset = sizeof(header);
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(&header), sizeof(header));
+  bool newer = throws(path);
+  header.version = TrackRecordHeader::current_version;
+  header.n_events = 3;
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(&header), sizeof(header));
+  bool not_closed = throws(path);
+  // A compressed event whose index claims more tracks than its bytes can inflate to
+  {
+    TrackRecordWriter writer(path, bfield, "GBDTNative", true);
+    writer.write(1000, events[0]);
+  }
+  uint32_t n_tracks = 0xffffffff;
+  std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  file.seekp(header.index_offset + offsetof(TrackRecordIndex, n_tracks));
+  file.write(reinterpret_cast<const char*>(&n_tracks), sizeof(n_tracks));
+  file.close();
+  bool corrupted = throws(path);
+  std::remove(path.c_str());
+  bool errors_ok = not_record && newer && not_closed && corrupted && throws("testTrackRecordFile_missing.bin");
+  printf("damaged files %s\n", errors_ok ? "throw" : "DO NOT all throw");
+  ok &= errors_ok;
+
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,98 @@
+/*
+Checks the features decoded from packed track words: TrackWordFormat::pack and unpack round trip,
+and TrackWordFeatures::floatingPoint over packed words gives bitwise the features of the per track
+floatingPoint, for synthetic tracks and for every tanl field value. Prints the tracks/sec of both
+and of FeaturePlan::transformBatch on the TTTracks the words were digitised from. Returns 1 on
+any difference
+  testTrackWordFeatures [n_tracks]
+*/
+
+#include "L1Trigger/TrackQuality/interface/FeatureTransform.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include "SyntheticTracks.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// tracks/sec of run(), best of three
+static double throughput(unsigned int n_tracks, const std::function<void()>& run) {
+  double best = 0;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    best = std::max(best, n_tracks / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+static bool sameBits(const TrackWordBits& a, const TrackWordBits& b) {
+  return a.rinv == b.rinv && a.tanl == b.tanl && a.z0 == b.z0 && a.chi2rphi == b.chi2rphi && a.chi2rz == b.chi2rz &&
+         a.bendchi2 == b.bendchi2 && a.hitpattern == b.hitpattern;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n_tracks = argc > 1 ? std::atoi(argv[1]) : 200000;
+  TrackWordFormat format;
+  TrackWordFeatures features(in_features, FixedPointType("ap_fixed<16,6>"), format);
+  unsigned int n_features = features.nFeatures();
+
+  // Synthetic tracks digitised, then every tanl field with random other fields
+  std::vector<SyntheticTracks::Track> tracks = SyntheticTracks::generate(n_tracks);
+  std::vector<TrackWordBits> bits;
+  for (const SyntheticTracks::Track& track : tracks)
+    bits.push_back(format.digitize(track));
+  std::mt19937 rng(54321);
+  for (unsigned int tanl = 0; tanl < (1u << format.tanl_bits); ++tanl)
+    bits.push_back({unsigned(rng()) & 0x7fff, tanl, unsigned(rng()) & 0xfff, unsigned(rng()) & 0xf,
+                    unsigned(rng()) & 0xf, unsigned(rng()) & 0x7, unsigned(rng()) & 0x7f});
+
+  unsigned int n_round_trip = 0;
+  std::vector<uint64_t> words;
+  for (const TrackWordBits& word : bits) {
+    words.push_back(format.pack(word));
+    n_round_trip += !sameBits(format.unpack(words.back()), word);
+  }
+
+  std::vector<float> per_track(bits.size() * n_features), packed(per_track.size());
+  for (size_t i = 0; i < bits.size(); ++i)
+    features.floatingPoint(bits[i], &per_track[i * n_features]);
+  features.floatingPoint(words.data(), words.size(), packed.data());
+  unsigned int n_differ = 0;
+  for (size_t i = 0; i < bits.size(); ++i)
+    n_differ += memcmp(&per_track[i * n_features], &packed[i * n_features], n_features * sizeof(float)) != 0;
+
+  // Throughput on the synthetic tracks only
+  FeatureTransform::FeaturePlan plan(in_features);
+  FeatureTransform::TrackColumns columns;
+  std::vector<float> rows(size_t(n_tracks) * n_features);
+  double plan_rate = throughput(n_tracks, [&] {
+    plan.transformBatch(tracks.data(), n_tracks, rows.data(), FeatureTransform::Layout::RowMajor, columns);
+  });
+  double bits_rate = throughput(n_tracks, [&] {
+    for (unsigned int i = 0; i < n_tracks; ++i)
+      features.floatingPoint(bits[i], &rows[size_t(i) * n_features]);
+  });
+  double packed_rate = throughput(n_tracks, [&] { features.floatingPoint(words.data(), n_tracks, rows.data()); });
+
+  printf("%u synthetic tracks and %u tanl values, %u bit packed words\n", n_tracks, 1u << format.tanl_bits,
+         format.packedBits());
+  printf("%-42s %10.3g tracks/s\n", "FeaturePlan::transformBatch on TTTracks", plan_rate);
+  printf("%-42s %10.3g tracks/s\n", "TrackWordFeatures::floatingPoint per track", bits_rate);
+  printf("%-42s %10.3g tracks/s\n", "TrackWordFeatures::floatingPoint packed", packed_rate);
+  printf("%u words do not round trip, %u differ from the per track features\n", n_round_trip, n_differ);
+
+  if (n_round_trip || n_differ) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,114 @@
+/*
+Checks that the track word engines of L1TrackClassifier score a track the same in every
+outputMode, on synthetic events where some tracks have no split chi2 (chi2XY and chi2Z -999, as
+from the TTTrack constructor taking the total chi2 only). With Tracks the fields are read from the
+track word of the output copy, set by TTTrack::setTrackWordBits (util/TTTrack.h), which stores
+the total chi2 and 0 for such tracks; with ValueMap and Selected the const input tracks are
+digitised by TrackWordFormat::digitize. Compares the fixed point GBDT and the float GBDT on the
+decoded fields, the scores of every track for ValueMap and the tracks accepted above the working
+point for Selected. Returns 1 on any difference
+  testTrackWordModes [pileup] [n_events] [working point]
+*/
+
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "L1Trigger/TrackQuality/interface/FixedPointModel.h"
+#include "L1Trigger/TrackQuality/interface/TrackWordFeatures.h"
+#include "L1Trigger/TrackQuality/interface/TreeEnsemble.h"
+#include "SyntheticTracks.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+typedef SyntheticTracks::Track Track;
+
+static const std::vector<std::string> in_features = {
+    "log_chi2", "log_bendchi2", "log_chi2rphi", "log_chi2rz", "nstubs",     "lay1_hits", "lay2_hits",
+    "lay3_hits", "lay4_hits",   "lay5_hits",    "lay6_hits",  "disk1_hits", "disk2_hits", "disk3_hits",
+    "disk4_hits", "disk5_hits", "rinv",         "tanl",       "z0",         "dtot",       "ltot"};
+
+// The track word fields as TTTrack::setTrackWordBits sets them on the output copy
+static TrackWordBits setTrackWordBits(const TrackWordFormat& format, const Track& track) {
+  if (track.chi2Z() < 0)
+    return format.digitize(track.rInv(), track.tanL(), track.z0(), track.chi2(), 0, track.stubPtConsistency(),
+                           track.hitPattern());
+  return format.digitize(track.rInv(), track.tanL(), track.z0(), track.chi2XY(), track.chi2Z(),
+                         track.stubPtConsistency(), track.hitPattern());
+}
+
+int main(int argc, char** argv) {
+  double pileup = argc > 1 ? std::atof(argv[1]) : 200;
+  unsigned int n_events = argc > 2 ? std::atoi(argv[2]) : 100;
+  float working_point = argc > 3 ? std::atof(argv[3]) : 0.5;
+
+  // One track in four refitted without the split chi2
+  std::mt19937 rng(12345);
+  std::vector<std::vector<Track>> events;
+  size_t n_tracks = 0, n_unsplit = 0;
+  for (unsigned int i = 0; i < n_events; ++i) {
+    events.push_back(SyntheticTracks::event(pileup, rng));
+    for (size_t k = 0; k < events.back().size(); k += 4) {
+      const Track& split = events.back()[k];
+      Track unsplit(split.rInv(), split.phi(), split.tanL(), split.z0(), split.d0(), split.chi2(), 0., 0., 0.,
+                    split.hitPattern(), split.nFitPars(), 3.8112);
+      unsplit.setStubPtConsistency(split.stubPtConsistency());
+      for (const auto& stub : split.getStubRefs())
+        unsplit.addStubRef(stub);
+      events.back()[k] = unsplit;
+      ++n_unsplit;
+    }
+    n_tracks += events.back().size();
+  }
+
+  TreeEnsemble gbdt(edm::FileInPath("L1Trigger/TrackQuality/data/FakeIDGBDT/GBDT_model.onnx").fullPath());
+  FixedPointPrecision precision = {FixedPointType("ap_fixed<16,6>"), FixedPointType("ap_fixed<16,5>"),
+                                   FixedPointType("ap_fixed<24,8>"), FixedPointType("ap_ufixed<16,0>")};
+  FixedPointModel fixed(gbdt, precision);
+  TrackWordFormat format;
+  TrackWordFeatures features(in_features, precision.input, format);
+
+  // Fixed point and float GBDT scores of one track from its fields
+  std::vector<int64_t> fixed_row(features.nFeatures());
+  std::vector<float> float_row(features.nFeatures());
+  auto score = [&](const TrackWordBits& bits, float* scores) {
+    features.fixedPoint(bits, fixed_row.data());
+    scores[0] = fixed.predict(fixed_row.data());
+    features.floatingPoint(bits, float_row.data());
+    gbdt.predict(float_row.data(), 1, &scores[1]);
+  };
+
+  unsigned int n_differ = 0, n_selected_differ = 0, n_chi2_fields = 0;
+  for (const std::vector<Track>& event : events) {
+    std::vector<unsigned int> accepted_tracks, accepted_selected;
+    for (unsigned int i = 0; i < event.size(); ++i) {
+      float tracks_scores[2], valuemap_scores[2];
+      TrackWordBits word = setTrackWordBits(format, event[i]);
+      TrackWordBits digitised = format.digitize(event[i]);
+      score(word, tracks_scores);
+      score(digitised, valuemap_scores);
+      n_differ += tracks_scores[0] != valuemap_scores[0] || tracks_scores[1] != valuemap_scores[1];
+      if (tracks_scores[0] > working_point)
+        accepted_tracks.push_back(i);
+      if (valuemap_scores[0] > working_point)
+        accepted_selected.push_back(i);
+      // The fields the raw chi2 members would give, as digitised before the track word branch
+      if (event[i].chi2Z() < 0) {
+        TrackWordBits raw = format.digitize(event[i].rInv(), event[i].tanL(), event[i].z0(), event[i].chi2XY(),
+                                            event[i].chi2Z(), event[i].stubPtConsistency(), event[i].hitPattern());
+        n_chi2_fields += raw.chi2rphi != word.chi2rphi || raw.chi2rz != word.chi2rz;
+      }
+    }
+    n_selected_differ += accepted_tracks != accepted_selected;
+  }
+
+  printf("%u events at pileup %g, %zu tracks of which %zu without the split chi2\n", n_events, pileup, n_tracks,
+         n_unsplit);
+  printf("%u of these have other chi2 fields in the track word than their chi2XY and chi2Z members\n", n_chi2_fields);
+  printf("%u tracks scored differently with ValueMap than with Tracks, %u events select other tracks\n", n_differ,
+         n_selected_differ);
+
+  if (n_differ || n_selected_differ || !n_chi2_fields) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
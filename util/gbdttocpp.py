@@ -0,0 +1,149 @@
+'''
+Helper script that generates the C++ header of a GBDT compiled into the binary
+The trees are written as constexpr node tables, evaluated by interface/CompiledTreeEnsemble.h
+with the thresholds inlined by the compiler, so no model is loaded at run time
+Reads the TreeEnsembleClassifier of an onnx model, or an XGBoost model saved in the pkl format
+which is first converted to onnx as in xgboosttoonnx.py
+
+python gbdttocpp.py ../data/FakeIDGBDT/GBDT_model.onnx ../interface/FakeIDGBDTModel.h
+The Makefile in this directory regenerates the header whenever the model changes
+'''
+
+import argparse
+import collections
+import os
+
+import numpy as np
+import onnx
+from onnx import helper
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument("model", help="GBDT_model.onnx or an XGBoost pkl")
+parser.add_argument("header", help="C++ header to write")
+parser.add_argument("--name", default=None, help="name of the model struct, defaults to the header name")
+parser.add_argument("--num_features", type=int, default=21, help="number of input features of a pkl model")
+args = parser.parse_args()
+
+name = args.name or os.path.splitext(os.path.basename(args.header))[0]
+
+if args.model.endswith(".pkl"):
+    import joblib
+    import onnxmltools
+    from onnxmltools.convert.common.data_types import FloatTensorType
+    initial_type = [('feature_input', FloatTensorType([None, args.num_features]))]
+    model = onnxmltools.convert.convert_xgboost(joblib.load(args.model), initial_types=initial_type)
+else:
+    model = onnx.load(args.model)
+
+ensembles = [node for node in model.graph.node if node.op_type == "TreeEnsembleClassifier"]
+if len(ensembles) != 1:
+    raise ValueError("%s does not hold a single TreeEnsembleClassifier" % args.model)
+attributes = {a.name: helper.get_attribute_value(a) for a in ensembles[0].attribute}
+
+def decoded(values):
+    return [v.decode() if isinstance(v, bytes) else v for v in values]
+
+# Only the binary case written by XGBoost is supported, as in TreeEnsemble
+labels = attributes.get("classlabels_int64s") or attributes.get("classlabels_strings") or []
+if len(labels) != 2 or len(set(attributes["class_ids"])) != 1:
+    raise ValueError("%s is not a binary classifier with a single weighted class" % args.model)
+base_values = attributes.get("base_values", [])
+if len(base_values) > 1:
+    raise ValueError("per class base_values are not supported")
+base_value = base_values[0] if base_values else 0.
+post_transform = attributes.get("post_transform", b"NONE")
+post_transform = post_transform.decode() if isinstance(post_transform, bytes) else post_transform
+if post_transform not in ("NONE", "LOGISTIC"):
+    raise ValueError("unsupported post_transform " + post_transform)
+
+# Gather the nodes tree by tree
+missing = attributes.get("nodes_missing_value_tracks_true", [])
+trees = collections.defaultdict(dict)
+for i, (tree, node) in enumerate(zip(attributes["nodes_treeids"], attributes["nodes_nodeids"])):
+    trees[tree][node] = dict(mode=decoded(attributes["nodes_modes"])[i],
+                             feature=attributes["nodes_featureids"][i],
+                             threshold=np.float32(attributes["nodes_values"][i]),
+                             true_id=attributes["nodes_truenodeids"][i],
+                             false_id=attributes["nodes_falsenodeids"][i],
+                             missing_tracks_true=i < len(missing) and missing[i] != 0,
+                             weight=np.float32(0))
+for tree, node, weight in zip(attributes["class_treeids"], attributes["class_nodeids"], attributes["class_weights"]):
+    trees[tree][node]["weight"] += np.float32(weight)
+
+n_features = max(node["feature"] + 1 for tree in trees.values() for node in tree.values() if node["mode"] != "LEAF")
+inputs = [i for i in model.graph.input if i.name == ensembles[0].input[0]]
+if inputs and len(inputs[0].type.tensor_type.shape.dim) == 2:
+    n_features = max(n_features, inputs[0].type.tensor_type.shape.dim[1].dim_value)
+
+# Flatten each tree breadth first, as TreeEnsemble does, comparisons are rewritten as
+# feature < threshold taking the next float above the threshold for the inclusive modes
+nodes = []
+roots = []
+for tree_id in sorted(trees):
+    tree = trees[tree_id]
+    root = len(nodes)
+    roots.append(root)
+    order = []
+    queue = collections.deque([min(tree)])
+    while queue:
+        node_id = queue.popleft()
+        if node_id in order:
+            continue
+        order.append(node_id)
+        if tree[node_id]["mode"] != "LEAF":
+            queue.append(tree[node_id]["true_id"])
+            queue.append(tree[node_id]["false_id"])
+    index = {node_id: root + i for i, node_id in enumerate(order)}
+    for node_id in order:
+        node = tree[node_id]
+        mode = node["mode"]
+        if mode == "LEAF":
+            nodes.append(dict(leaf=True, threshold=np.float32(0), feature=0, nan_to_lt=False,
+                              below=index[node_id], above=index[node_id], value=node["weight"]))
+            continue
+        if mode not in ("BRANCH_LT", "BRANCH_LEQ", "BRANCH_GT", "BRANCH_GTE"):
+            raise ValueError("unsupported node mode " + mode)
+        inclusive = mode in ("BRANCH_LEQ", "BRANCH_GT")
+        true_below = mode in ("BRANCH_LT", "BRANCH_LEQ")
+        threshold = np.nextafter(node["threshold"], np.float32(np.inf)) if inclusive else node["threshold"]
+        true_index, false_index = index[node["true_id"]], index[node["false_id"]]
+        nodes.append(dict(leaf=False, threshold=threshold, feature=node["feature"],
+                          nan_to_lt=node["missing_tracks_true"] == true_below,
+                          below=true_index if true_below else false_index,
+                          above=false_index if true_below else true_index, value=np.float32(0)))
+
+def literal(value):
+    # Hexadecimal float literals keep every value bit exact
+    value = float(np.float32(value))
+    if value == 0:
+        return "-0.0f" if np.signbit(value) else "0.0f"
+    mantissa, exponent = value.hex().split("p")
+    return mantissa.rstrip("0").rstrip(".") + "p" + exponent + "f"
+
+def boolean(value):
+    return "true" if value else "false"
+
+source = os.path.basename(args.model)
+with open(args.header, "w") as f:
+    f.write("#ifndef %s_HH\n#define %s_HH\n\n" % (name, name))
+    f.write("/*\nGenerated by util/gbdttocpp.py from %s, do not edit\n" % source)
+    f.write("%d trees, %d nodes, %d features\n*/\n\n" % (len(roots), len(nodes), n_features))
+    f.write('#include "L1Trigger/TrackQuality/interface/CompiledTreeEnsemble.h"\n\n')
+    f.write("struct %s {\n" % name)
+    f.write("  static constexpr unsigned int n_features = %d;\n" % n_features)
+    f.write("  static constexpr unsigned int n_trees = %d;\n" % len(roots))
+    f.write("  static constexpr float base_value = %s;\n" % literal(base_value))
+    f.write("  static constexpr bool logistic = %s;\n\n" % boolean(post_transform == "LOGISTIC"))
+    f.write("  static constexpr uint32_t roots[n_trees] = {\n")
+    for i in range(0, len(roots), 16):
+        f.write("      " + ", ".join(str(r) for r in roots[i:i + 16]) + ",\n")
+    f.write("  };\n\n")
+    f.write("  // threshold, feature, nan_to_lt, leaf, below, above, value\n")
+    f.write("  static constexpr CompiledTreeNode nodes[%d] = {\n" % len(nodes))
+    for node in nodes:
+        f.write("      {%s, %d, %s, %s, %d, %d, %s},\n" % (literal(node["threshold"]), node["feature"],
+                                                        boolean(node["nan_to_lt"]), boolean(node["leaf"]),
+                                                        node["below"], node["above"], literal(node["value"])))
+    f.write("  };\n};\n\n#endif\n")
+
+print("wrote %s: %d trees, %d nodes, %d features" % (args.header, len(roots), len(nodes), n_features))
@@ -34,7 +34,16 @@ print(label_name)
 # The name of the output is needed in Clasifier_cff as NNIdONNXOutputName
 
 # predict on random input and compare to previous keras model
+pred_single = []
 for i in range(len(X)):
     pred_onx = sess.run([label_name], {input_name: X[i:i+1]})[0]
     print(pred_onx)
+    pred_single.append(pred_onx[0])
+
+# keras2onnx leaves the batch dimension dynamic so the whole input can be run as one batch,
+# this must match the track by track predictions
+pred_batch = sess.run([label_name], {input_name: X})[0]
+print(pred_batch)
+if not np.allclose(pred_batch, np.array(pred_single), atol=1e-6):
+    raise RuntimeError("batched predictions of " + temp_model_file + " differ from the single track ones")
 
@@ -16,7 +16,8 @@ model = joblib.load("GBDTClassv1.pkl")
 #print(model.predict(X))
 
 # The name of the input is needed in Clasifier_cff as GBDTIdONNXInputName
-initial_type = [('feature_input', FloatTensorType([1, num_features]))]
+# The first dimension is left dynamic so all the tracks of an event can be classified in one batch
+initial_type = [('feature_input', FloatTensorType([None, num_features]))]
 
  
 onx = onnxmltools.convert.convert_xgboost(model, initial_types=initial_type)
@@ -42,6 +43,15 @@ print(sess.get_inputs()[0].name)
 print(label_name)
 
 # predict on random input and compare to previous XGBoost model
+pred_single = []
 for i in range(len(X)):
     pred_onx = sess.run([], {input_name: X[i:i+1]})[1]
     print(pred_onx)
+    pred_single.append(pred_onx[0])
+
+# predict on the whole input as one batch, this must match the track by track predictions or
+# the batch dimension was not left dynamic
+pred_batch = sess.run([], {input_name: X})[1]
+print(pred_batch)
+if not np.allclose(pred_batch, np.array(pred_single), atol=1e-6):
+    raise RuntimeError("batched predictions of GBDT_model.onnx differ from the single track ones")